@@ -29,13 +29,28 @@
 
 #include "adler32.h"
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 
-typedef union
-{
-	uint8_t vector __attribute__ ((vector_size (8)));
-	uint8_t integer[ 8 ];
+#if defined( ADLER32_HAVE_SSSE3 ) || defined( ADLER32_HAVE_AVX2 )
+#include <immintrin.h>
+#include <tmmintrin.h>
+#endif
+
+#if defined( ADLER32_HAVE_NEON )
+#include <arm_neon.h>
+#endif
 
-} adler32_8byte_vector_t;
+#if defined( ADLER32_HAVE_SSSE3 ) && defined( __GNUC__ )
+#define ADLER32_TARGET_SSSE3	__attribute__(( target( "ssse3" ) ))
+#else
+#define ADLER32_TARGET_SSSE3
+#endif
+
+#if defined( ADLER32_HAVE_AVX2 ) && defined( __GNUC__ )
+#define ADLER32_TARGET_AVX2	__attribute__(( target( "avx2" ) ))
+#else
+#define ADLER32_TARGET_AVX2
+#endif
 
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
@@ -101,9 +116,8 @@ int adler32_calculate_checksum_basic1(
 		lower_word += buffer[ buffer_index ];
 		upper_word += lower_word;
 
-		if( ( buffer_index != 0 )
-		 && ( ( ( buffer_index % 0x15b0 ) == 0 )
-		  || ( buffer_index == size - 1 ) ) )
+		if( ( ( ( buffer_index + 1 ) % 0x15b0 ) == 0 )
+		 || ( buffer_index == size - 1 ) )
 		{
 			lower_word = lower_word % 0xfff1;
 			upper_word = upper_word % 0xfff1;
@@ -173,14 +187,17 @@ int adler32_calculate_checksum_basic2(
 			lower_word += buffer[ buffer_offset ];
 			upper_word += lower_word;
 
-			if( ( buffer_offset != 0 )
-			 && ( ( buffer_offset % 0x15b0 ) == 0 ) )
+			buffer_offset++;
+			size--;
+
+			/* Reduce after every 0x15b0 bytes to prevent the upper word from
+			 * overflowing when a previous key is used
+			 */
+			if( ( buffer_offset % 0x15b0 ) == 0 )
 			{
 				lower_word %= 0xfff1;
 				upper_word %= 0xfff1;
 			}
-			buffer_offset++;
-			size--;
 		}
 		lower_word %= 0xfff1;
 		upper_word %= 0xfff1;
@@ -242,19 +259,12 @@ int adler32_calculate_checksum_unfolded4_1(
 	lower_word = initial_value & 0xffff;
 	upper_word = ( initial_value >> 16 ) & 0xffff;
 
-	while( ( buffer_offset + 3 ) < ( size - 4 ) )
+	while( ( size - buffer_offset ) >= 4 )
 	{
 		lower_word += buffer[ buffer_offset ];
 
 		upper_word += lower_word;
 
-		if( ( buffer_offset != 0 )
-		 && ( ( buffer_offset % 0x15b0 == 0 )
-		  || ( buffer_offset == size - 1 ) ) )
-		{
-			lower_word %= 0xfff1;
-			upper_word %= 0xfff1;
-		}
 		upper_word += ( 3 * lower_word )
 			    + ( 3 * buffer[ buffer_offset + 1 ] )
 			    + ( 2 * buffer[ buffer_offset + 2 ] )
@@ -265,21 +275,25 @@ int adler32_calculate_checksum_unfolded4_1(
 			    + buffer[ buffer_offset + 3 ];
 
 		buffer_offset += 4;
+
+		/* 0x15b0 is a multiple of 4
+		 */
+		if( ( buffer_offset % 0x15b0 ) == 0 )
+		{
+			lower_word %= 0xfff1;
+			upper_word %= 0xfff1;
+		}
 	}
 	while( buffer_offset < size )
 	{
 		lower_word += buffer[ buffer_offset ];
 		upper_word += lower_word;
 
-		if( ( buffer_offset != 0 )
-		 && ( ( ( buffer_offset % 0x15b0 ) == 0 )
-		  || ( buffer_offset == size - 1 ) ) )
-		{
-			lower_word %= 0xfff1;
-			upper_word %= 0xfff1;
-		}
 		buffer_offset++;
 	}
+	lower_word %= 0xfff1;
+	upper_word %= 0xfff1;
+
 	*checksum_value = ( upper_word << 16 ) | lower_word;
 
 	return( 1 );
@@ -340,20 +354,13 @@ int adler32_calculate_checksum_unfolded4_2(
 
 	buffer_index = (uint8_t *) buffer;
 
-	while( ( buffer_offset + 3 ) < ( size - 4 ) )
+	while( ( size - buffer_offset ) >= 4 )
 	{
 		lower_word += *buffer_index;
 		upper_word += lower_word;
 
 		buffer_index++;
 
-		if( ( buffer_offset != 0 )
-		 && ( ( buffer_offset % 0x15b0 == 0 )
-		  || ( buffer_offset == size - 1 ) ) )
-		{
-			lower_word %= 0xfff1;
-			upper_word %= 0xfff1;
-		}
 		upper_word += ( 3 * lower_word )
 		            + ( 3 * *buffer_index );
 
@@ -372,22 +379,26 @@ int adler32_calculate_checksum_unfolded4_2(
 		buffer_index++;
 
 		buffer_offset += 4;
+
+		/* 0x15b0 is a multiple of 4
+		 */
+		if( ( buffer_offset % 0x15b0 ) == 0 )
+		{
+			lower_word %= 0xfff1;
+			upper_word %= 0xfff1;
+		}
 	}
 	while( buffer_offset < size )
 	{
 		lower_word += *buffer_index;
 		upper_word += lower_word;
 
-		if( ( buffer_offset != 0 )
-		 && ( ( ( buffer_offset % 0x15b0 ) == 0 )
-		  || ( buffer_offset == size - 1 ) ) )
-		{
-			lower_word %= 0xfff1;
-			upper_word %= 0xfff1;
-		}
 		buffer_index++;
 		buffer_offset++;
 	}
+	lower_word %= 0xfff1;
+	upper_word %= 0xfff1;
+
 	*checksum_value = ( upper_word << 16 ) | lower_word;
 
 	return( 1 );
@@ -1357,6 +1368,8 @@ int adler32_calculate_checksum_cpu_aligned(
 }
 
 /* Calculates the Adler-32 of a buffer
+ * Uses the AVX2, SSSE3 or NEON engine if supported by the CPU,
+ * the remaining bytes are calculated without SIMD
  * It uses the initial value to calculate a new Adler-32
  * Returns 1 if successful or -1 on error
  */
@@ -1367,16 +1380,12 @@ int adler32_calculate_checksum_simd(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	adler32_8byte_vector_t value_8byte;
-	adler32_8byte_vector_t upper_word_8byte_multiplier;
-	adler32_8byte_vector_t upper_word_8byte_value;
-
 	static char *function = "adler32_calculate_checksum_simd";
+	size_t block_size     = 0;
 	size_t buffer_offset  = 0;
+	size_t simd_size      = 0;
 	uint32_t lower_word   = 0;
 	uint32_t upper_word   = 0;
-	int block_index       = 0;
-	int number_of_blocks  = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -1411,144 +1420,506 @@ int adler32_calculate_checksum_simd(
 
 		return( -1 );
 	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
+	/* The SIMD engines expect reduced words
+	 */
+	lower_word = ( initial_value & 0xffff ) % 0xfff1;
+	upper_word = ( ( initial_value >> 16 ) & 0xffff ) % 0xfff1;
+
+#if defined( ADLER32_HAVE_AVX2 )
+	if( ( size >= 32 )
+	 && ( cpu_features_has_support( CPU_FEATURE_FLAG_AVX2 ) != 0 ) )
+	{
+		simd_size = size & ~( (size_t) 31 );
 
-	upper_word_8byte_multiplier.integer[ 0 ] = 8;
-	upper_word_8byte_multiplier.integer[ 1 ] = 7;
-	upper_word_8byte_multiplier.integer[ 2 ] = 6;
-	upper_word_8byte_multiplier.integer[ 3 ] = 5;
-	upper_word_8byte_multiplier.integer[ 4 ] = 4;
-	upper_word_8byte_multiplier.integer[ 5 ] = 3;
-	upper_word_8byte_multiplier.integer[ 6 ] = 2;
-	upper_word_8byte_multiplier.integer[ 7 ] = 1;
-
-	upper_word_8byte_value.integer[ 0 ] = 0;
-	upper_word_8byte_value.integer[ 1 ] = 0;
-	upper_word_8byte_value.integer[ 2 ] = 0;
-	upper_word_8byte_value.integer[ 3 ] = 0;
-	upper_word_8byte_value.integer[ 4 ] = 0;
-	upper_word_8byte_value.integer[ 5 ] = 0;
-	upper_word_8byte_value.integer[ 6 ] = 0;
-	upper_word_8byte_value.integer[ 7 ] = 0;
+		adler32_calculate_avx2(
+		 &lower_word,
+		 &upper_word,
+		 buffer,
+		 simd_size );
 
-	while( size >= 0x15b0 )
+		buffer_offset += simd_size;
+		size          -= simd_size;
+	}
+#endif
+#if defined( ADLER32_HAVE_SSSE3 )
+	if( ( size >= 16 )
+	 && ( cpu_features_has_support( CPU_FEATURE_FLAG_SSSE3 ) != 0 ) )
+	{
+		simd_size = size & ~( (size_t) 15 );
+
+		adler32_calculate_ssse3(
+		 &lower_word,
+		 &upper_word,
+		 &( buffer[ buffer_offset ] ),
+		 simd_size );
+
+		buffer_offset += simd_size;
+		size          -= simd_size;
+	}
+#endif
+#if defined( ADLER32_HAVE_NEON )
+	if( ( size >= 16 )
+	 && ( cpu_features_has_support( CPU_FEATURE_FLAG_NEON ) != 0 ) )
+	{
+		simd_size = size & ~( (size_t) 15 );
+
+		adler32_calculate_neon(
+		 &lower_word,
+		 &upper_word,
+		 &( buffer[ buffer_offset ] ),
+		 simd_size );
+
+		buffer_offset += simd_size;
+		size          -= simd_size;
+	}
+#endif
+	while( size > 0 )
 	{
 		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
 		 */
-		number_of_blocks = 347 * 2;
+		block_size = size;
 
-		for( block_index = 0;
-		     block_index < number_of_blocks;
-		     block_index++ )
+		if( block_size > 0x15b0 )
+		{
+			block_size = 0x15b0;
+		}
+		size -= block_size;
+
+		while( block_size > 0 )
 		{
-			value_8byte.integer[ 0 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 1 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 2 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 3 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 4 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 5 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 6 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 7 ] = buffer[ buffer_offset++ ];
-
-/* TODO
-			upper_word_8byte_value.vector = __builtin_mulv8qi(
-			                                 value_8byte.vector,
-			                                 upper_word_8byte_multiplier.vector );
-*/
-
-			upper_word += 8 * lower_word
-			            + upper_word_8byte_value.integer[ 0 ]
-			            + upper_word_8byte_value.integer[ 1 ]
-			            + upper_word_8byte_value.integer[ 2 ]
-			            + upper_word_8byte_value.integer[ 3 ]
-			            + upper_word_8byte_value.integer[ 4 ]
-			            + upper_word_8byte_value.integer[ 5 ]
-			            + upper_word_8byte_value.integer[ 6 ]
-			            + upper_word_8byte_value.integer[ 7 ];
-
-			lower_word += value_8byte.integer[ 0 ]
-			            + value_8byte.integer[ 1 ]
-			            + value_8byte.integer[ 2 ]
-			            + value_8byte.integer[ 3 ]
-			            + value_8byte.integer[ 4 ]
-			            + value_8byte.integer[ 5 ]
-			            + value_8byte.integer[ 6 ]
-			            + value_8byte.integer[ 7 ];
+			lower_word += buffer[ buffer_offset++ ];
+			upper_word += lower_word;
 
+			block_size--;
 		}
 		lower_word %= 0xfff1;
 		upper_word %= 0xfff1;
-
-		size -= 0x15b0;
 	}
-	if( size > 0 )
+	*checksum_value = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+#if defined( ADLER32_HAVE_SSSE3 )
+
+/* Calculates the Adler-32 lower and upper words of a buffer using SSSE3
+ * Per 16-byte block the lower word is summed with PSADBW and the upper word
+ * with PMADDUBSW using the weights 16 to 1
+ * The words must be reduced modulo 65521 and the size must be a multiple of 16
+ * The words are reduced at least once per 5552 (0x15b0) bytes
+ */
+ADLER32_TARGET_SSSE3
+void adler32_calculate_ssse3(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size )
+{
+	__m128i lower_word_sums  = _mm_setzero_si128();
+	__m128i multipliers      = _mm_setzero_si128();
+	__m128i ones             = _mm_setzero_si128();
+	__m128i previous_sums    = _mm_setzero_si128();
+	__m128i upper_word_sums  = _mm_setzero_si128();
+	__m128i value_128bit     = _mm_setzero_si128();
+	__m128i zero             = _mm_setzero_si128();
+	size_t buffer_offset     = 0;
+	uint32_t safe_lower_word = 0;
+	uint32_t safe_upper_word = 0;
+	int block_index          = 0;
+	int number_of_blocks     = 0;
+
+	safe_lower_word = *lower_word;
+	safe_upper_word = *upper_word;
+
+	multipliers = _mm_setr_epi8(
+	               16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+
+	ones = _mm_set1_epi16(
+	        1 );
+
+	while( size > 0 )
 	{
-		while( size > 16 )
-		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 16 = 347
+		 */
+		number_of_blocks = 347;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		if( size < ( 347 * 16 ) )
+		{
+			number_of_blocks = (int) ( size / 16 );
+		}
+		size -= (size_t) number_of_blocks * 16;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		/* The lower word at the start of the window contributes once per byte
+		 */
+		safe_upper_word += safe_lower_word * (uint32_t) ( number_of_blocks * 16 );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		lower_word_sums = _mm_setzero_si128();
+		previous_sums   = _mm_setzero_si128();
+		upper_word_sums = _mm_setzero_si128();
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			value_128bit = _mm_loadu_si128(
+			                (const __m128i *) &( buffer[ buffer_offset ] ) );
+
+			previous_sums = _mm_add_epi32(
+			                 previous_sums,
+			                 lower_word_sums );
+
+			lower_word_sums = _mm_add_epi32(
+			                   lower_word_sums,
+			                   _mm_sad_epu8(
+			                    value_128bit,
+			                    zero ) );
+
+			upper_word_sums = _mm_add_epi32(
+			                   upper_word_sums,
+			                   _mm_madd_epi16(
+			                    _mm_maddubs_epi16(
+			                     value_128bit,
+			                     multipliers ),
+			                    ones ) );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			buffer_offset += 16;
+		}
+		/* The lower word sums of the previous blocks contribute 16 times each
+		 */
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_slli_epi32(
+		                    previous_sums,
+		                    4 ) );
+
+		lower_word_sums = _mm_add_epi32(
+		                   lower_word_sums,
+		                   _mm_shuffle_epi32(
+		                    lower_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		safe_lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                               lower_word_sums );
+
+		safe_upper_word += (uint32_t) _mm_cvtsi128_si32(
+		                               upper_word_sums );
+
+		safe_lower_word %= 0xfff1;
+		safe_upper_word %= 0xfff1;
+	}
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+#endif /* defined( ADLER32_HAVE_SSSE3 ) */
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+#if defined( ADLER32_HAVE_AVX2 )
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Calculates the Adler-32 lower and upper words of a buffer using AVX2
+ * Per 32-byte block the lower word is summed with VPSADBW and the upper word
+ * with VPMADDUBSW using the weights 32 to 1
+ * The words must be reduced modulo 65521 and the size must be a multiple of 32
+ * The words are reduced at least once per 5552 (0x15b0) bytes
+ */
+ADLER32_TARGET_AVX2
+void adler32_calculate_avx2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size )
+{
+	__m256i lower_word_sums  = _mm256_setzero_si256();
+	__m256i multipliers      = _mm256_setzero_si256();
+	__m256i ones             = _mm256_setzero_si256();
+	__m256i previous_sums    = _mm256_setzero_si256();
+	__m256i upper_word_sums  = _mm256_setzero_si256();
+	__m256i value_256bit     = _mm256_setzero_si256();
+	__m256i zero             = _mm256_setzero_si256();
+	__m128i value_128bit     = _mm_setzero_si128();
+	size_t buffer_offset     = 0;
+	uint32_t safe_lower_word = 0;
+	uint32_t safe_upper_word = 0;
+	int block_index          = 0;
+	int number_of_blocks     = 0;
+
+	safe_lower_word = *lower_word;
+	safe_upper_word = *upper_word;
+
+	multipliers = _mm256_setr_epi8(
+	               32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	               16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+
+	ones = _mm256_set1_epi16(
+	        1 );
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = 173;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		if( size < ( 173 * 32 ) )
+		{
+			number_of_blocks = (int) ( size / 32 );
+		}
+		size -= (size_t) number_of_blocks * 32;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		/* The lower word at the start of the window contributes once per byte
+		 */
+		safe_upper_word += safe_lower_word * (uint32_t) ( number_of_blocks * 32 );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		lower_word_sums = _mm256_setzero_si256();
+		previous_sums   = _mm256_setzero_si256();
+		upper_word_sums = _mm256_setzero_si256();
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			value_256bit = _mm256_loadu_si256(
+			                (const __m256i *) &( buffer[ buffer_offset ] ) );
+
+			previous_sums = _mm256_add_epi32(
+			                 previous_sums,
+			                 lower_word_sums );
+
+			lower_word_sums = _mm256_add_epi32(
+			                   lower_word_sums,
+			                   _mm256_sad_epu8(
+			                    value_256bit,
+			                    zero ) );
+
+			upper_word_sums = _mm256_add_epi32(
+			                   upper_word_sums,
+			                   _mm256_madd_epi16(
+			                    _mm256_maddubs_epi16(
+			                     value_256bit,
+			                     multipliers ),
+			                    ones ) );
+
+			buffer_offset += 32;
+		}
+		/* The lower word sums of the previous blocks contribute 32 times each
+		 */
+		upper_word_sums = _mm256_add_epi32(
+		                   upper_word_sums,
+		                   _mm256_slli_epi32(
+		                    previous_sums,
+		                    5 ) );
+
+		value_128bit = _mm_add_epi32(
+		                _mm256_castsi256_si128(
+		                 lower_word_sums ),
+		                _mm256_extracti128_si256(
+		                 lower_word_sums,
+		                 1 ) );
+
+		value_128bit = _mm_add_epi32(
+		                value_128bit,
+		                _mm_shuffle_epi32(
+		                 value_128bit,
+		                 _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		safe_lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                               value_128bit );
+
+		value_128bit = _mm_add_epi32(
+		                _mm256_castsi256_si128(
+		                 upper_word_sums ),
+		                _mm256_extracti128_si256(
+		                 upper_word_sums,
+		                 1 ) );
+
+		value_128bit = _mm_add_epi32(
+		                value_128bit,
+		                _mm_shuffle_epi32(
+		                 value_128bit,
+		                 _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		value_128bit = _mm_add_epi32(
+		                value_128bit,
+		                _mm_shuffle_epi32(
+		                 value_128bit,
+		                 _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		safe_upper_word += (uint32_t) _mm_cvtsi128_si32(
+		                               value_128bit );
+
+		safe_lower_word %= 0xfff1;
+		safe_upper_word %= 0xfff1;
+	}
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+#endif /* defined( ADLER32_HAVE_AVX2 ) */
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+#if defined( ADLER32_HAVE_NEON )
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Calculates the Adler-32 lower and upper words of a buffer using NEON
+ * Per 16-byte block the lower word is summed with pairwise additions and
+ * the upper word with widening multiplications using the weights 16 to 1
+ * The words must be reduced modulo 65521 and the size must be a multiple of 16
+ * The words are reduced at least once per 5552 (0x15b0) bytes
+ */
+void adler32_calculate_neon(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size )
+{
+	static const uint8_t multipliers_data[ 16 ] = {
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+	uint32x4_t lower_word_sums = vdupq_n_u32( 0 );
+	uint32x4_t previous_sums   = vdupq_n_u32( 0 );
+	uint32x4_t upper_word_sums = vdupq_n_u32( 0 );
+	uint8x16_t multipliers     = vdupq_n_u8( 0 );
+	uint8x16_t value_128bit    = vdupq_n_u8( 0 );
+	size_t buffer_offset       = 0;
+	uint32_t safe_lower_word   = 0;
+	uint32_t safe_upper_word   = 0;
+	int block_index            = 0;
+	int number_of_blocks       = 0;
+
+	safe_lower_word = *lower_word;
+	safe_upper_word = *upper_word;
+
+	multipliers = vld1q_u8(
+	               multipliers_data );
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 16 = 347
+		 */
+		number_of_blocks = 347;
 
-			size          -= 16;
+		if( size < ( 347 * 16 ) )
+		{
+			number_of_blocks = (int) ( size / 16 );
 		}
-		while( size > 0 )
+		size -= (size_t) number_of_blocks * 16;
+
+		/* The lower word at the start of the window contributes once per byte
+		 */
+		safe_upper_word += safe_lower_word * (uint32_t) ( number_of_blocks * 16 );
+
+		lower_word_sums = vdupq_n_u32( 0 );
+		previous_sums   = vdupq_n_u32( 0 );
+		upper_word_sums = vdupq_n_u32( 0 );
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
 		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			value_128bit = vld1q_u8(
+			                &( buffer[ buffer_offset ] ) );
+
+			previous_sums = vaddq_u32(
+			                 previous_sums,
+			                 lower_word_sums );
+
+			lower_word_sums = vpadalq_u16(
+			                   lower_word_sums,
+			                   vpaddlq_u8(
+			                    value_128bit ) );
+
+			upper_word_sums = vpadalq_u16(
+			                   upper_word_sums,
+			                   vmull_u8(
+			                    vget_low_u8(
+			                     value_128bit ),
+			                    vget_low_u8(
+			                     multipliers ) ) );
+
+			upper_word_sums = vpadalq_u16(
+			                   upper_word_sums,
+			                   vmull_u8(
+			                    vget_high_u8(
+			                     value_128bit ),
+			                    vget_high_u8(
+			                     multipliers ) ) );
 
-			size--;
+			buffer_offset += 16;
 		}
-		lower_word %= 0xfff1;
-		upper_word %= 0xfff1;
+		/* The lower word sums of the previous blocks contribute 16 times each
+		 */
+		upper_word_sums = vaddq_u32(
+		                   upper_word_sums,
+		                   vshlq_n_u32(
+		                    previous_sums,
+		                    4 ) );
+
+		safe_lower_word += vaddvq_u32(
+		                    lower_word_sums );
+
+		safe_upper_word += vaddvq_u32(
+		                    upper_word_sums );
+
+		safe_lower_word %= 0xfff1;
+		safe_upper_word %= 0xfff1;
 	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	*lower_word = safe_lower_word;
+	*upper_word = safe_upper_word;
+}
+
+#endif /* defined( ADLER32_HAVE_NEON ) */
+
+/* Combines the Adler-32 of two consecutive buffers into the Adler-32 of both buffers
+ * The second Adler-32 must be calculated with an initial value of 0
+ * The lower word of the second Adler-32 is the sum of the bytes of the second
+ * buffer and the upper word the sum of the lower words, which are offset by the
+ * lower word of the first Adler-32 for every byte of the second buffer
+ * Returns 1 if successful or -1 on error
+ */
+int adler32_combine_checksums(
+     uint32_t *checksum_value,
+     uint32_t first_checksum_value,
+     uint32_t second_checksum_value,
+     size64_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function = "adler32_combine_checksums";
+	uint64_t lower_word   = 0;
+	uint64_t upper_word   = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = (uint64_t) ( first_checksum_value & 0xffff );
+	upper_word = (uint64_t) ( ( first_checksum_value >> 16 ) & 0xffff );
+
+	upper_word += ( second_size % 0xfff1 ) * ( lower_word % 0xfff1 );
+	upper_word += (uint64_t) ( ( second_checksum_value >> 16 ) & 0xffff );
+	lower_word += (uint64_t) ( second_checksum_value & 0xffff );
+
+	lower_word %= 0xfff1;
+	upper_word %= 0xfff1;
+
+	*checksum_value = ( (uint32_t) upper_word << 16 ) | (uint32_t) lower_word;
 
 	return( 1 );
 }
-
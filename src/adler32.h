@@ -31,6 +31,20 @@
 extern "C" {
 #endif
 
+/* The SSSE3 and AVX2 engines are available on x86 and x86-64,
+ * support by the CPU is determined at run-time
+ */
+#if ( defined( __GNUC__ ) && ( defined( __i386__ ) || defined( __x86_64__ ) ) ) || ( defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) ) )
+#define ADLER32_HAVE_SSSE3
+#define ADLER32_HAVE_AVX2
+#endif
+
+/* The NEON engine is available on AArch64, where NEON is always supported
+ */
+#if defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __ARM_NEON )
+#define ADLER32_HAVE_NEON
+#endif
+
 int adler32_calculate_checksum_basic1(
      uint32_t *checksum_value,
      const uint8_t *buffer,
@@ -101,6 +115,43 @@ int adler32_calculate_checksum_simd(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+#if defined( ADLER32_HAVE_SSSE3 )
+
+void adler32_calculate_ssse3(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size );
+
+#endif /* defined( ADLER32_HAVE_SSSE3 ) */
+
+#if defined( ADLER32_HAVE_AVX2 )
+
+void adler32_calculate_avx2(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size );
+
+#endif /* defined( ADLER32_HAVE_AVX2 ) */
+
+#if defined( ADLER32_HAVE_NEON )
+
+void adler32_calculate_neon(
+      uint32_t *lower_word,
+      uint32_t *upper_word,
+      const uint8_t *buffer,
+      size_t size );
+
+#endif /* defined( ADLER32_HAVE_NEON ) */
+
+int adler32_combine_checksums(
+     uint32_t *checksum_value,
+     uint32_t first_checksum_value,
+     uint32_t second_checksum_value,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
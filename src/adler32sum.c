@@ -40,6 +40,10 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "block_reader.h"
+#include "checksum.h"
+#include "cpu_features.h"
+#include "parallel_checksum.h"
 
 /* Prints the executable usage information
  */
@@ -52,20 +56,34 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use adler32sum to calculate an Adler-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: adler32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                  [ -12345hvV ] source\n\n" );
+	fprintf( stream, "Usage: adler32sum [ -b block_size ] [ -f features ] [ -i initial_value ]\n"
+	                 "                  [ -o offset ] [ -s size ] [ -t threads ] [ -12345hvV ]\n"
+	                 "                  source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\tBy default the fastest calculation method supported by the CPU\n"
+	                 "\tis used\n\n" );
+
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
-	fprintf( stream, "\t-2:     use the unfolded calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the unfolded calculation method\n" );
 	fprintf( stream, "\t-3:     use the cpu-aligned calculation method\n" );
-	fprintf( stream, "\t-4:     use the SIMD calculation method\n" );
+	fprintf( stream, "\t-4:     use the SIMD calculation method, AVX2, SSSE3 or NEON\n"
+	                 "\t        if supported by the CPU\n" );
 	fprintf( stream, "\t-5:     use the zlib calculation method\n" );
+	fprintf( stream, "\t-b:     block size of the data read at once, must be a multiple\n"
+	                 "\t        of 512 and at most 1073741824 (default is 4194304)\n" );
+	fprintf( stream, "\t-f:     CPU features the default calculation method can use: auto\n"
+	                 "\t        (default), none or a comma separated list of: avx2,\n"
+	                 "\t        neon, ssse3. Overrides the ASSORTED_CPU_FEATURES\n"
+	                 "\t        environment variable\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial Adler-32 (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     number of threads to calculate the Adler-32 with, the data\n"
+	                 "\t        is split into a range per thread and the Adler-32s of the\n"
+	                 "\t        ranges are combined (default is 1)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -81,16 +99,21 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error     = NULL;
 	libcfile_file_t *source_file = NULL;
+	system_character_t *features = NULL;
 	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
+	block_reader_t *block_reader = NULL;
+	uint8_t *block_data          = NULL;
 	char *program                = "adler32sum";
 	system_integer_t option      = 0;
+	size_t block_data_size       = 0;
+	size_t block_size            = BLOCK_READER_DEFAULT_BLOCK_SIZE;
 	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
+	uint64_t combined_checksum   = 0;
 	off_t source_offset          = 0;
 	uint32_t checksum_value      = 0;
 	uint32_t initial_value       = 0;
-	int calculation_method       = 2;
+	int calculation_method       = 0;
+	int number_of_threads        = 1;
 	int result                   = 0;
 	int verbose                  = 0;
 
@@ -101,7 +124,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12345hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345b:f:hi:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -142,6 +165,19 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'b':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				block_size = (size_t) _wtol( optarg );
+#else
+				block_size = (size_t) atol( optarg );
+#endif
+				break;
+
+			case 'f':
+				features = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -172,6 +208,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -197,12 +241,63 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > PARALLEL_CHECKSUM_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( calculation_method != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Threads are only supported by the default calculation method.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( features != NULL )
+	{
+		if( cpu_features_set_mask(
+		     features,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported CPU features.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+	}
+	if( checksum_initialize(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize checksum calculation.\n" );
+
+		goto on_error;
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -258,52 +353,185 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
+	if( number_of_threads > 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( parallel_checksum_calculate(
+		     &combined_checksum,
+		     PARALLEL_CHECKSUM_TYPE_ADLER32,
+		     source,
+		     (off64_t) source_offset,
+		     source_size,
+		     block_size,
+		     number_of_threads,
+		     (uint64_t) initial_value,
+		     0,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Adler-32 in parallel.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		checksum_value = (uint32_t) combined_checksum;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		if( block_reader_initialize(
+		     &block_reader,
+		     block_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create block reader.\n" );
 
-		goto on_error;
-	}
-	/* Position the source file at the right offset
-	 */
-	if( libcfile_file_seek_offset(
-	     source_file,
-	     source_offset,
-	     SEEK_SET,
-	     &error ) == -1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to seek offset in source file.\n" );
+			goto on_error;
+		}
+		/* Position the source file at the right offset
+		 */
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     source_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
 
-		goto on_error;
-	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+			goto on_error;
+		}
+		if( block_reader_open(
+		     block_reader,
+		     source_file,
+		     source_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open block reader.\n" );
 
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+			goto on_error;
+		}
+		checksum_value = initial_value;
 
-		goto on_error;
+		/* Calculate the checksum block by block, using the checksum
+		 * of the previous blocks as the initial value
+		 */
+		while( ( result = block_reader_get_next_block(
+		                   block_reader,
+		                   &block_data,
+		                   &block_data_size,
+		                   &error ) ) == 1 )
+		{
+			if( calculation_method == 0 )
+			{
+				result = checksum_calculate_adler32(
+				          &checksum_value,
+				          block_data,
+				          block_data_size,
+				          checksum_value,
+				          &error );
+			}
+			else if( calculation_method == 1 )
+			{
+				result = adler32_calculate_checksum_basic2(
+				          &checksum_value,
+				          block_data,
+				          block_data_size,
+				          checksum_value,
+				          &error );
+			}
+			else if( calculation_method == 2 )
+			{
+				/* The unfolded4_2 variant is slower than the unfolded4_1 variant
+				 */
+				/* Fastest to slowest variant
+				 * - adler32_calculate_checksum_unfolded16_4
+				 * - adler32_calculate_checksum_unfolded16_2
+				 * - adler32_calculate_checksum_unfolded16_1
+				 * - adler32_calculate_checksum_unfolded16_3
+				 */
+				result = adler32_calculate_checksum_unfolded16_4(
+				          &checksum_value,
+				          block_data,
+				          block_data_size,
+				          checksum_value,
+				          &error );
+			}
+			else if( calculation_method == 3 )
+			{
+				/* The unfolded variants seems to be faster then the CPU aligned
+				 */
+				result = adler32_calculate_checksum_cpu_aligned(
+				          &checksum_value,
+				          block_data,
+				          block_data_size,
+				          checksum_value,
+				          &error );
+			}
+			else if( calculation_method == 4 )
+			{
+				result = adler32_calculate_checksum_simd(
+				          &checksum_value,
+				          block_data,
+				          block_data_size,
+				          checksum_value,
+				          &error );
+			}
+			else if( calculation_method == 5 )
+			{
+#if !defined( HAVE_ZLIB_ADLER32 )
+				fprintf(
+				 stderr,
+				 "Missing zlib Adler-32 support.\n" );
+
+				goto on_error;
+#else
+				checksum_value = adler32(
+				                  checksum_value,
+				                  block_data,
+				                  (uInt) block_data_size );
+
+				result = 1;
+#endif
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate Adler-32.\n" );
+
+				goto on_error;
+			}
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_data(
+				 block_data,
+				 block_data_size,
+				 0 );
+			}
+		}
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( block_reader_free(
+		     &block_reader,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free block reader.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -327,88 +555,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = adler32_calculate_checksum_basic2(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	else if( calculation_method == 2 )
-	{
-		/* The unfolded4_2 variant is slower than the unfolded4_1 variant
-		 */
-		/* Fastest to slowest variant
-		 * - adler32_calculate_checksum_unfolded16_4
-		 * - adler32_calculate_checksum_unfolded16_2
-		 * - adler32_calculate_checksum_unfolded16_1
-		 * - adler32_calculate_checksum_unfolded16_3
-		 */
-		result = adler32_calculate_checksum_unfolded16_4(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	else if( calculation_method == 3 )
-	{
-		/* The unfolded variants seems to be faster then the CPU aligned
-		 */
-		result = adler32_calculate_checksum_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	else if( calculation_method == 4 )
-	{
-/* TODO experimental */
-		result = adler32_calculate_checksum_simd(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	else if( calculation_method == 5 )
-	{
-#if !defined( HAVE_ZLIB_ADLER32 )
-		fprintf(
-		 stderr,
-		 "Missing zlib Adler-32 support.\n" );
-
-		goto on_error;
-#else
-		checksum_value = adler32(
-		                  initial_value,
-		                  buffer,
-		                  source_size );
-
-		result = 1;
-#endif
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate Adler-32.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	memory_free(
-	 buffer );
-
 	fprintf(
 	 stdout,
 	 "Calculated Adler-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
@@ -425,10 +571,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	if( block_reader != NULL )
 	{
-		memory_free(
-		 buffer );
+		block_reader_free(
+		 &block_reader,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
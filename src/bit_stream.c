@@ -20,14 +20,13 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "bit_stream.h"
 
-/* TODO use memory alignment in bit stream */
-
 /* Creates a bit stream
  * Make sure the value bit_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -145,9 +144,13 @@ int bit_stream_read(
      uint8_t number_of_bits,
      libcerror_error_t **error )
 {
-	static char *function          = "bit_stream_read";
-	uint8_t minimum_number_of_bits = 0;
-	int result                     = 0;
+	static char *function      = "bit_stream_read";
+	const uint8_t *byte_stream = NULL;
+	size_t byte_stream_offset  = 0;
+	size_t byte_stream_size    = 0;
+	uint64_t bit_buffer        = 0;
+	uint8_t bit_buffer_size    = 0;
+	int result                 = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -172,49 +175,208 @@ int bit_stream_read(
 
 		return( -1 );
 	}
-	if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN )
+	byte_stream        = bit_stream->byte_stream;
+	byte_stream_offset = bit_stream->byte_stream_offset;
+	byte_stream_size   = bit_stream->byte_stream_size;
+	bit_buffer         = bit_stream->bit_buffer;
+	bit_buffer_size    = bit_stream->bit_buffer_size;
+
+	switch( bit_stream->storage_type )
 	{
-		minimum_number_of_bits = 16;
+		case BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT:
+			while( ( bit_buffer_size < number_of_bits )
+			    && ( byte_stream_offset < byte_stream_size ) )
+			{
+				bit_buffer      |= (uint64_t) byte_stream[ byte_stream_offset++ ] << bit_buffer_size;
+				bit_buffer_size += 8;
+
+				result = 1;
+			}
+			break;
+
+		case BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK:
+			while( ( bit_buffer_size < number_of_bits )
+			    && ( byte_stream_offset < byte_stream_size ) )
+			{
+				bit_buffer     <<= 8;
+				bit_buffer      |= byte_stream[ byte_stream_offset++ ];
+				bit_buffer_size += 8;
+
+				result = 1;
+			}
+			break;
+
+		case BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN:
+			while( ( bit_buffer_size < number_of_bits )
+			    && ( byte_stream_offset < byte_stream_size )
+			    && ( ( byte_stream_size - byte_stream_offset ) >= 2 ) )
+			{
+				bit_buffer     <<= 8;
+				bit_buffer      |= byte_stream[ byte_stream_offset + 1 ];
+				bit_buffer     <<= 8;
+				bit_buffer      |= byte_stream[ byte_stream_offset ];
+				bit_buffer_size += 16;
+
+				byte_stream_offset += 2;
+
+				result = 1;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported storage type.",
+			 function );
+
+			return( -1 );
 	}
-	else
+	bit_stream->byte_stream_offset = byte_stream_offset;
+	bit_stream->bit_buffer         = bit_buffer;
+	bit_stream->bit_buffer_size    = bit_buffer_size;
+
+	return( result );
+}
+
+/* Refills the bit buffer from the underlying byte stream
+ * Whole words are read at a time as long as the byte stream contains sufficient data,
+ * afterwards the bit buffer contains at least BIT_STREAM_REFILL_MINIMUM_NUMBER_OF_BITS bits
+ * or the remaining bits of the byte stream. Near the end of the byte stream bytes are
+ * read one at a time.
+ * Returns 1 on success or -1 on error
+ */
+int bit_stream_refill(
+     bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function      = "bit_stream_refill";
+	const uint8_t *byte_stream = NULL;
+	size_t byte_stream_offset  = 0;
+	size_t byte_stream_size    = 0;
+	uint64_t bit_buffer        = 0;
+	uint64_t value_64bit       = 0;
+	uint16_t value_16bit       = 0;
+	uint8_t bit_buffer_size    = 0;
+	uint8_t number_of_bytes    = 0;
+
+	if( bit_stream == NULL )
 	{
-		minimum_number_of_bits = 8;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
 	}
-	while( bit_stream->bit_buffer_size < number_of_bits )
+	if( bit_stream->byte_stream_offset > bit_stream->byte_stream_size )
 	{
-		if( ( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-		 || ( ( minimum_number_of_bits >> 3 ) > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) ) )
-		{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit stream - byte stream offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream        = bit_stream->byte_stream;
+	byte_stream_offset = bit_stream->byte_stream_offset;
+	byte_stream_size   = bit_stream->byte_stream_size;
+	bit_buffer         = bit_stream->bit_buffer;
+	bit_buffer_size    = bit_stream->bit_buffer_size;
+
+	switch( bit_stream->storage_type )
+	{
+		case BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT:
+			if( ( byte_stream_size - byte_stream_offset ) >= 8 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 value_64bit );
+
+				number_of_bytes = ( 63 - bit_buffer_size ) >> 3;
+
+				bit_buffer         |= value_64bit << bit_buffer_size;
+				bit_buffer_size    += number_of_bytes << 3;
+				bit_buffer         &= bit_stream_mask_64bit( bit_buffer_size );
+				byte_stream_offset += number_of_bytes;
+			}
+			else
+			{
+				while( ( bit_buffer_size <= 56 )
+				    && ( byte_stream_offset < byte_stream_size ) )
+				{
+					bit_buffer      |= (uint64_t) byte_stream[ byte_stream_offset++ ] << bit_buffer_size;
+					bit_buffer_size += 8;
+				}
+			}
 			break;
-		}
-		if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
-		{
-			bit_stream->bit_buffer      |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
-			bit_stream->bit_buffer_size += 8;
 
-			bit_stream->byte_stream_offset += 1;
-		}
-		else if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-		{
-			bit_stream->bit_buffer     <<= 8;
-			bit_stream->bit_buffer      |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			bit_stream->bit_buffer_size += 8;
+		case BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK:
+			if( ( byte_stream_size - byte_stream_offset ) >= 8 )
+			{
+				number_of_bytes = ( 63 - bit_buffer_size ) >> 3;
+
+				if( number_of_bytes > 0 )
+				{
+					byte_stream_copy_to_uint64_big_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 value_64bit );
+
+					bit_buffer        <<= number_of_bytes << 3;
+					bit_buffer         |= value_64bit >> ( 64 - ( number_of_bytes << 3 ) );
+					bit_buffer_size    += number_of_bytes << 3;
+					byte_stream_offset += number_of_bytes;
+				}
+			}
+			else
+			{
+				while( ( bit_buffer_size <= 56 )
+				    && ( byte_stream_offset < byte_stream_size ) )
+				{
+					bit_buffer     <<= 8;
+					bit_buffer      |= byte_stream[ byte_stream_offset++ ];
+					bit_buffer_size += 8;
+				}
+			}
+			break;
 
-			bit_stream->byte_stream_offset += 1;
-		}
-		else if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN )
-		{
-			bit_stream->bit_buffer     <<= 8;
-			bit_stream->bit_buffer      |= bit_stream->byte_stream[ bit_stream->byte_stream_offset + 1 ];
-			bit_stream->bit_buffer     <<= 8;
-			bit_stream->bit_buffer      |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			bit_stream->bit_buffer_size += 16;
+		case BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN:
+			while( ( bit_buffer_size <= 48 )
+			    && ( byte_stream_offset < byte_stream_size )
+			    && ( ( byte_stream_size - byte_stream_offset ) >= 2 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 value_16bit );
+
+				bit_buffer     <<= 16;
+				bit_buffer      |= value_16bit;
+				bit_buffer_size += 16;
+
+				byte_stream_offset += 2;
+			}
+			break;
 
-			bit_stream->byte_stream_offset += 2;
-		}
-		result = 1;
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported storage type.",
+			 function );
+
+			return( -1 );
 	}
-	return( result );
+	bit_stream->byte_stream_offset = byte_stream_offset;
+	bit_stream->bit_buffer         = bit_buffer;
+	bit_stream->bit_buffer_size    = bit_buffer_size;
+
+	return( 1 );
 }
 
 /* Retrieves a value from the bit stream
@@ -226,9 +388,7 @@ int bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function             = "bit_stream_get_value";
-	uint32_t safe_value_32bit         = 0;
-	uint8_t remaining_bit_buffer_size = 0;
+	static char *function = "bit_stream_get_value";
 
 	if( bit_stream == NULL )
 	{
@@ -285,37 +445,37 @@ int bit_stream_get_value(
 
 			return( -1 );
 		}
-	}
-	safe_value_32bit = bit_stream->bit_buffer;
-
-	if( number_of_bits < 32 )
-	{
-		if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+		if( bit_stream->bit_buffer_size < number_of_bits )
 		{
-			/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-			 */
-			safe_value_32bit &= ~( 0xffffffffUL << number_of_bits );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bits - insufficient data.",
+			 function );
 
-			bit_stream->bit_buffer     >>= number_of_bits;
-			bit_stream->bit_buffer_size -= number_of_bits;
+			return( -1 );
 		}
-		else if( ( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-		      || ( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN ) )
-		{
-			safe_value_32bit >>= bit_stream->bit_buffer_size - number_of_bits;
+	}
+	if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		*value_32bit = bit_stream_back_to_front_peek_value(
+		                bit_stream,
+		                number_of_bits );
 
-			bit_stream->bit_buffer_size -= number_of_bits;
-			remaining_bit_buffer_size    = 32 - bit_stream->bit_buffer_size;
-			bit_stream->bit_buffer      &= 0xffffffffUL >> remaining_bit_buffer_size;
-		}
+		bit_stream_back_to_front_consume(
+		 bit_stream,
+		 number_of_bits );
 	}
 	else
 	{
-		bit_stream->bit_buffer      = 0;
-		bit_stream->bit_buffer_size = 0;
-	}
-	*value_32bit = safe_value_32bit;
+		*value_32bit = bit_stream_front_to_back_peek_value(
+		                bit_stream,
+		                number_of_bits );
 
+		bit_stream_front_to_back_consume(
+		 bit_stream,
+		 number_of_bits );
+	}
 	return( 1 );
 }
-
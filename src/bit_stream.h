@@ -41,11 +41,6 @@ enum BIT_STREAM_STORAGE_TYPES
 	BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN	= 0x03
 };
 
-/* The largest primary (or scalar) available
- * supported by a single load and store instruction
- */
-typedef unsigned long int bit_stream_aligned_t;
-
 typedef struct bit_stream bit_stream_t;
 
 struct bit_stream
@@ -54,10 +49,6 @@ struct bit_stream
 	 */
 	const uint8_t *byte_stream;
 
-	/* The aligned byte stream
-	 */
-	bit_stream_aligned_t *aligned_byte_stream;
-
 	/* The byte stream size
 	 */
 	size_t byte_stream_size;
@@ -71,14 +62,49 @@ struct bit_stream
 	uint8_t storage_type;
 
 	/* The bit buffer
+	 * Bits beyond the bit buffer size are always 0
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
 	uint8_t bit_buffer_size;
 };
 
+/* The minimum number of bits in the bit buffer after bit_stream_refill
+ * if the byte stream contains sufficient data
+ */
+#define BIT_STREAM_REFILL_MINIMUM_NUMBER_OF_BITS		48
+
+/* The peek and consume primitives operate on the bit buffer only,
+ * the caller must make sure the bit buffer contains at least the number of bits
+ * and that the number of bits is 32 or less
+ */
+#define bit_stream_mask_64bit( number_of_bits ) \
+	( ~( (uint64_t) 0xffffffffffffffffULL << ( number_of_bits ) ) )
+
+#define bit_stream_back_to_front_peek_value( bit_stream, number_of_bits ) \
+	( (uint32_t) ( ( bit_stream )->bit_buffer & bit_stream_mask_64bit( number_of_bits ) ) )
+
+#define bit_stream_back_to_front_consume( bit_stream, number_of_bits ) \
+	( bit_stream )->bit_buffer     >>= ( number_of_bits ); \
+	( bit_stream )->bit_buffer_size -= ( number_of_bits )
+
+#define bit_stream_front_to_back_peek_value( bit_stream, number_of_bits ) \
+	( (uint32_t) ( ( ( bit_stream )->bit_buffer >> ( ( bit_stream )->bit_buffer_size - ( number_of_bits ) ) ) & bit_stream_mask_64bit( number_of_bits ) ) )
+
+#define bit_stream_front_to_back_consume( bit_stream, number_of_bits ) \
+	( bit_stream )->bit_buffer_size -= ( number_of_bits ); \
+	( bit_stream )->bit_buffer      &= bit_stream_mask_64bit( ( bit_stream )->bit_buffer_size )
+
+/* The 16-bit little-endian storage type stores the bits in the same order as front-to-back
+ */
+#define bit_stream_16bit_little_endian_peek_value( bit_stream, number_of_bits ) \
+	bit_stream_front_to_back_peek_value( bit_stream, number_of_bits )
+
+#define bit_stream_16bit_little_endian_consume( bit_stream, number_of_bits ) \
+	bit_stream_front_to_back_consume( bit_stream, number_of_bits )
+
 int bit_stream_initialize(
      bit_stream_t **bit_stream,
      const uint8_t *byte_stream,
@@ -94,6 +120,10 @@ int bit_stream_read(
      uint8_t number_of_bits,
      libcerror_error_t **error );
 
+int bit_stream_refill(
+     bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
 int bit_stream_get_value(
      bit_stream_t *bit_stream,
      uint8_t number_of_bits,
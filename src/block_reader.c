@@ -0,0 +1,525 @@
+/*
+ * Double buffered block reader
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+#include "block_reader.h"
+
+/* Creates a block reader
+ * Make sure the value block_reader is referencing, is set to NULL
+ * The block size must be a multiple of 512
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_initialize(
+     block_reader_t **block_reader,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_initialize";
+	int buffer_index      = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) BLOCK_READER_MAXIMUM_BLOCK_SIZE )
+	 || ( ( block_size % 512 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*block_reader = memory_allocate_structure(
+	                 block_reader_t );
+
+	if( *block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_reader,
+	     0,
+	     sizeof( block_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block reader.",
+		 function );
+
+		memory_free(
+		 *block_reader );
+
+		*block_reader = NULL;
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		( *block_reader )->buffers[ buffer_index ] = (uint8_t *) memory_allocate(
+		                                                          sizeof( uint8_t ) * block_size );
+
+		if( ( *block_reader )->buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	( *block_reader )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *block_reader != NULL )
+	{
+		if( ( *block_reader )->buffers[ 0 ] != NULL )
+		{
+			memory_free(
+			 ( *block_reader )->buffers[ 0 ] );
+		}
+		memory_free(
+		 *block_reader );
+
+		*block_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block reader
+ * Waits for a pending read to complete
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_free(
+     block_reader_t **block_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reader != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *block_reader )->read_thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *block_reader )->read_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( buffer_index = 0;
+		     buffer_index < 2;
+		     buffer_index++ )
+		{
+			if( ( *block_reader )->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 ( *block_reader )->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 *block_reader );
+
+		*block_reader = NULL;
+	}
+	return( result );
+}
+
+/* Opens a block reader
+ * The file must be positioned at the start of the data
+ * The read of the first block is started in the background
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_open(
+     block_reader_t *block_reader,
+     libcfile_file_t *file,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_open";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->read_pending != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block reader - read already pending.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	block_reader->file           = file;
+	block_reader->remaining_size = size;
+	block_reader->read_index     = 0;
+
+	if( size > 0 )
+	{
+		if( block_reader_start_read(
+		     block_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to start read of first block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a block into the block buffer being read into
+ * This function is called from the read thread and therefore does not
+ * take an error argument
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_read_block(
+     block_reader_t *block_reader )
+{
+	ssize_t read_count = 0;
+	size_t read_size   = 0;
+
+	if( block_reader == NULL )
+	{
+		return( -1 );
+	}
+	read_size = block_reader->block_size;
+
+	if( (size64_t) read_size > block_reader->remaining_size )
+	{
+		read_size = (size_t) block_reader->remaining_size;
+	}
+	read_count = libcfile_file_read_buffer(
+	              block_reader->file,
+	              block_reader->buffers[ block_reader->read_index ],
+	              read_size,
+	              NULL );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		block_reader->read_result = -1;
+
+		return( -1 );
+	}
+	block_reader->data_sizes[ block_reader->read_index ] = read_size;
+	block_reader->remaining_size                        -= read_size;
+	block_reader->read_result                            = 1;
+
+	return( 1 );
+}
+
+/* The read thread function
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_read_thread_function(
+     void *arguments )
+{
+	return( block_reader_read_block(
+	         (block_reader_t *) arguments ) );
+}
+
+/* Starts the read of the next block
+ * With multi-thread support the block is read in a separate thread,
+ * otherwise the read is deferred until block_reader_finish_read is called
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_start_read(
+     block_reader_t *block_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_start_read";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	block_reader->read_result = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( block_reader->read_thread ),
+	     NULL,
+	     &block_reader_read_thread_function,
+	     (void *) block_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	block_reader->read_pending = 1;
+
+	return( 1 );
+}
+
+/* Finishes the pending read
+ * Returns 1 if successful or -1 on error
+ */
+int block_reader_finish_read(
+     block_reader_t *block_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_finish_read";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	block_reader->read_pending = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_join(
+	     &( block_reader->read_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join read thread.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	block_reader_read_block(
+	 block_reader );
+#endif
+	if( block_reader->read_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next block
+ * The block data remains valid until the next call to this function,
+ * in the meantime the following block is read into the other block buffer
+ * Returns 1 if successful, 0 if no more blocks are available or -1 on error
+ */
+int block_reader_get_next_block(
+     block_reader_t *block_reader,
+     uint8_t **block_data,
+     size_t *block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "block_reader_get_next_block";
+	int buffer_index      = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->read_pending == 0 )
+	{
+		return( 0 );
+	}
+	if( block_reader_finish_read(
+	     block_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = block_reader->read_index;
+
+	/* Read the next block into the other block buffer while the caller
+	 * processes the current block
+	 */
+	if( block_reader->remaining_size > 0 )
+	{
+		block_reader->read_index = 1 - buffer_index;
+
+		if( block_reader_start_read(
+		     block_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to start read of next block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*block_data      = block_reader->buffers[ buffer_index ];
+	*block_data_size = block_reader->data_sizes[ buffer_index ];
+
+	return( 1 );
+}
+
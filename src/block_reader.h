@@ -0,0 +1,122 @@
+/*
+ * Double buffered block reader
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BLOCK_READER_H )
+#define _BLOCK_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BLOCK_READER_DEFAULT_BLOCK_SIZE		( 4 * 1024 * 1024 )
+#define BLOCK_READER_MAXIMUM_BLOCK_SIZE		( 1024 * 1024 * 1024 )
+
+typedef struct block_reader block_reader_t;
+
+struct block_reader
+{
+	/* The file
+	 */
+	libcfile_file_t *file;
+
+	/* The remaining size
+	 */
+	size64_t remaining_size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The block buffers
+	 */
+	uint8_t *buffers[ 2 ];
+
+	/* The data sizes of the block buffers
+	 */
+	size_t data_sizes[ 2 ];
+
+	/* The index of the block buffer being read into
+	 */
+	int read_index;
+
+	/* Value to indicate a read is pending
+	 */
+	int read_pending;
+
+	/* The result of the last read
+	 */
+	int read_result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read thread
+	 */
+	libcthreads_thread_t *read_thread;
+#endif
+};
+
+int block_reader_initialize(
+     block_reader_t **block_reader,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int block_reader_free(
+     block_reader_t **block_reader,
+     libcerror_error_t **error );
+
+int block_reader_open(
+     block_reader_t *block_reader,
+     libcfile_file_t *file,
+     size64_t size,
+     libcerror_error_t **error );
+
+int block_reader_read_block(
+     block_reader_t *block_reader );
+
+int block_reader_read_thread_function(
+     void *arguments );
+
+int block_reader_start_read(
+     block_reader_t *block_reader,
+     libcerror_error_t **error );
+
+int block_reader_finish_read(
+     block_reader_t *block_reader,
+     libcerror_error_t **error );
+
+int block_reader_get_next_block(
+     block_reader_t *block_reader,
+     uint8_t **block_data,
+     size_t *block_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BLOCK_READER_H ) */
+
@@ -0,0 +1,348 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "adler32.h"
+#include "assorted_libcerror.h"
+#include "assorted_unused.h"
+#include "checksum.h"
+#include "cpu_features.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "fletcher32.h"
+#include "fletcher64.h"
+#include "xor32.h"
+#include "xor64.h"
+
+/* Value to indicate the calculation functions have been bound
+ */
+int checksum_functions_bound = 0;
+
+/* The calculation functions bound to the fastest implementation
+ * supported by the CPU
+ */
+int (*checksum_adler32_function)( uint32_t *, const uint8_t *, size_t, uint32_t, libcerror_error_t ** ) = NULL;
+int (*checksum_crc32_function)( uint32_t *, const uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t ** ) = NULL;
+int (*checksum_crc64_function)( uint64_t *, const uint8_t *, size_t, uint64_t, libcerror_error_t ** ) = NULL;
+int (*checksum_fletcher32_function)( uint32_t *, const uint8_t *, size_t, uint32_t, libcerror_error_t ** ) = NULL;
+int (*checksum_fletcher64_function)( uint64_t *, const uint8_t *, size_t, uint64_t, libcerror_error_t ** ) = NULL;
+int (*checksum_xor32_function)( uint32_t *, const uint8_t *, size_t, uint32_t, libcerror_error_t ** ) = NULL;
+int (*checksum_xor64_function)( uint64_t *, const uint8_t *, size_t, uint64_t, libcerror_error_t ** ) = NULL;
+
+/* Binds the calculation functions to the fastest implementation supported by the CPU
+ * The CPU features are restricted by cpu_features_set_mask or the ASSORTED_CPU_FEATURES
+ * environment variable, call this function again after changing the mask
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_initialize(
+     libcerror_error_t **error )
+{
+	uint32_t feature_flags = 0;
+
+	ASSORTED_UNREFERENCED_PARAMETER( error )
+
+	feature_flags = cpu_features_get_flags();
+
+	/* The SIMD calculation falls back to a plain loop without a SIMD engine,
+	 * which is slower than the unfolded calculation
+	 */
+	if( ( feature_flags & ( CPU_FEATURE_FLAG_SSSE3 | CPU_FEATURE_FLAG_AVX2 | CPU_FEATURE_FLAG_NEON ) ) != 0 )
+	{
+		checksum_adler32_function = &adler32_calculate_checksum_simd;
+	}
+	else
+	{
+		checksum_adler32_function = &adler32_calculate_checksum_unfolded16_4;
+	}
+	if( ( feature_flags & CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 )
+	{
+		checksum_crc32_function = &crc32_calculate_folding;
+	}
+	else
+	{
+		checksum_crc32_function = &crc32_calculate_slicing_by_16;
+	}
+	checksum_crc64_function      = &crc64_calculate_folding;
+	checksum_fletcher32_function = &fletcher32_calculate;
+	checksum_fletcher64_function = &fletcher64_calculate;
+	checksum_xor32_function      = &xor32_calculate_checksum_little_endian_cpu_aligned;
+	checksum_xor64_function      = &xor64_calculate_checksum_little_endian_cpu_aligned;
+
+	checksum_functions_bound = 1;
+
+	return( 1 );
+}
+
+/* Calculates the Adler-32 of a buffer
+ * It uses the initial value to calculate a new Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_adler32(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_adler32";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_adler32_function(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_crc32(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_crc32";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_crc32_function(
+	         crc32,
+	         buffer,
+	         size,
+	         initial_value,
+	         weak_crc,
+	         error ) );
+}
+
+/* Calculates the CRC-64 of a buffer
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_crc64(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_crc64";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_crc64_function(
+	         crc64,
+	         buffer,
+	         size,
+	         initial_value,
+	         error ) );
+}
+
+/* Calculates the Fletcher-32 of a buffer
+ * Use a previous key of 0 to calculate a new Fletcher-32
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_fletcher32(
+     uint32_t *fletcher32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t previous_key,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_fletcher32";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_fletcher32_function(
+	         fletcher32,
+	         buffer,
+	         size,
+	         previous_key,
+	         error ) );
+}
+
+/* Calculates the Fletcher-64 of a buffer
+ * Use a previous key of 0 to calculate a new Fletcher-64
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_fletcher64(
+     uint64_t *fletcher64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t previous_key,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_fletcher64";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_fletcher64_function(
+	         fletcher64,
+	         buffer,
+	         size,
+	         previous_key,
+	         error ) );
+}
+
+/* Calculates the little-endian XOR-32 of a buffer
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_xor32(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_xor32";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_xor32_function(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         error ) );
+}
+
+/* Calculates the little-endian XOR-64 of a buffer
+ * It uses the initial value to calculate a new XOR-64
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_xor64(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_xor64";
+
+	if( checksum_functions_bound == 0 )
+	{
+		if( checksum_initialize(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize calculation functions.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( checksum_xor64_function(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         error ) );
+}
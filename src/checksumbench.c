@@ -0,0 +1,876 @@
+/*
+ * Benchmarks the checksum calculation methods
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#elif defined( __GNUC__ ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#include <x86intrin.h>
+#endif
+
+#include "adler32.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "checksum.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "fletcher32.h"
+#include "fletcher64.h"
+#include "xor32.h"
+#include "xor64.h"
+
+#define CHECKSUMBENCH_DEFAULT_MINIMUM_SIZE	64
+#define CHECKSUMBENCH_DEFAULT_MAXIMUM_SIZE	( 64 * 1024 * 1024 )
+#define CHECKSUMBENCH_DEFAULT_TARGET_SIZE	( 256 * 1024 * 1024 )
+#define CHECKSUMBENCH_MAXIMUM_SIZE		( 1024 * 1024 * 1024 )
+
+typedef struct checksumbench_method checksumbench_method_t;
+
+struct checksumbench_method
+{
+	/* The algorithm
+	 */
+	const char *algorithm;
+
+	/* The calculation method
+	 */
+	const char *name;
+
+	/* The calculate function of a 32-bit checksum
+	 */
+	int (*calculate_32bit)(
+	       uint32_t *checksum_value,
+	       const uint8_t *buffer,
+	       size_t size,
+	       uint32_t initial_value,
+	       libcerror_error_t **error );
+
+	/* The calculate function of a 64-bit checksum
+	 */
+	int (*calculate_64bit)(
+	       uint64_t *checksum_value,
+	       const uint8_t *buffer,
+	       size_t size,
+	       uint64_t initial_value,
+	       libcerror_error_t **error );
+
+	/* The initial value
+	 */
+	uint64_t initial_value;
+};
+
+int checksumbench_crc32_calculate_modulo2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int checksumbench_crc32_calculate(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int checksumbench_crc32_calculate_slicing_by_8(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int checksumbench_crc32_calculate_slicing_by_16(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int checksumbench_crc32_calculate_folding(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int checksumbench_crc32_calculate_dispatch(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+/* The calculation methods, the first method of an algorithm is used
+ * as the reference to verify the other methods
+ */
+checksumbench_method_t checksumbench_methods[] = {
+	{ "adler32", "basic1", &adler32_calculate_checksum_basic1, NULL, 1 },
+	{ "adler32", "basic2", &adler32_calculate_checksum_basic2, NULL, 1 },
+	{ "adler32", "unfolded4_1", &adler32_calculate_checksum_unfolded4_1, NULL, 1 },
+	{ "adler32", "unfolded4_2", &adler32_calculate_checksum_unfolded4_2, NULL, 1 },
+	{ "adler32", "unfolded16_1", &adler32_calculate_checksum_unfolded16_1, NULL, 1 },
+	{ "adler32", "unfolded16_2", &adler32_calculate_checksum_unfolded16_2, NULL, 1 },
+	{ "adler32", "unfolded16_3", &adler32_calculate_checksum_unfolded16_3, NULL, 1 },
+	{ "adler32", "unfolded16_4", &adler32_calculate_checksum_unfolded16_4, NULL, 1 },
+	{ "adler32", "cpu_aligned", &adler32_calculate_checksum_cpu_aligned, NULL, 1 },
+	{ "adler32", "simd", &adler32_calculate_checksum_simd, NULL, 1 },
+	{ "adler32", "dispatch", &checksum_calculate_adler32, NULL, 1 },
+	{ "crc32", "modulo2", &checksumbench_crc32_calculate_modulo2, NULL, 0 },
+	{ "crc32", "table", &checksumbench_crc32_calculate, NULL, 0 },
+	{ "crc32", "slicing_by_8", &checksumbench_crc32_calculate_slicing_by_8, NULL, 0 },
+	{ "crc32", "slicing_by_16", &checksumbench_crc32_calculate_slicing_by_16, NULL, 0 },
+	{ "crc32", "folding", &checksumbench_crc32_calculate_folding, NULL, 0 },
+	{ "crc32", "dispatch", &checksumbench_crc32_calculate_dispatch, NULL, 0 },
+	{ "crc64", "table", NULL, &crc64_calculate_2, 0 },
+	{ "crc64", "slicing_by_8", NULL, &crc64_calculate_slicing_by_8, 0 },
+	{ "crc64", "folding", NULL, &crc64_calculate_folding, 0 },
+	{ "crc64", "dispatch", NULL, &checksum_calculate_crc64, 0 },
+	{ "fletcher32", "basic", &fletcher32_calculate, NULL, 0 },
+	{ "fletcher32", "dispatch", &checksum_calculate_fletcher32, NULL, 0 },
+	{ "fletcher64", "basic", NULL, &fletcher64_calculate, 0 },
+	{ "fletcher64", "dispatch", NULL, &checksum_calculate_fletcher64, 0 },
+	{ "xor32", "basic", &xor32_calculate_checksum_little_endian_basic, NULL, 0 },
+	{ "xor32", "cpu_aligned", &xor32_calculate_checksum_little_endian_cpu_aligned, NULL, 0 },
+	{ "xor32", "dispatch", &checksum_calculate_xor32, NULL, 0 },
+	{ "xor64", "basic", NULL, &xor64_calculate_checksum_little_endian_basic, 0 },
+	{ "xor64", "cpu_aligned", NULL, &xor64_calculate_checksum_little_endian_cpu_aligned, 0 },
+	{ "xor64", "dispatch", NULL, &checksum_calculate_xor64, 0 },
+	{ NULL, NULL, NULL, NULL, 0 } };
+
+/* Calculates the CRC-32 of a buffer using the modulo-2 calculation
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate_modulo2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( crc32_calculate_modulo2(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer using the table calculation
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( crc32_calculate(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer using the slicing-by-8 calculation
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate_slicing_by_8(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( crc32_calculate_slicing_by_8(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer using the slicing-by-16 calculation
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate_slicing_by_16(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( crc32_calculate_slicing_by_16(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer using the folding calculation
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate_folding(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( crc32_calculate_folding(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Calculates the CRC-32 of a buffer using the calculation bound by the dispatcher
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_crc32_calculate_dispatch(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	return( checksum_calculate_crc32(
+	         checksum_value,
+	         buffer,
+	         size,
+	         initial_value,
+	         0,
+	         error ) );
+}
+
+/* Determines if a system string matches a narrow string
+ * Returns 1 if the strings match or 0 if not
+ */
+int checksumbench_string_match(
+     const system_character_t *system_string,
+     const char *narrow_string )
+{
+	size_t string_index = 0;
+
+	if( ( system_string == NULL )
+	 || ( narrow_string == NULL ) )
+	{
+		return( 0 );
+	}
+	while( narrow_string[ string_index ] != 0 )
+	{
+		if( system_string[ string_index ] != (system_character_t) narrow_string[ string_index ] )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	if( system_string[ string_index ] != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a monotonic time in seconds
+ */
+double checksumbench_get_time(
+        void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	return( (double) counter.QuadPart / (double) frequency.QuadPart );
+
+#elif defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_value );
+
+	return( (double) time_value.tv_sec + ( (double) time_value.tv_nsec / 1000000000.0 ) );
+
+#else
+	return( (double) clock() / (double) CLOCKS_PER_SEC );
+
+#endif
+}
+
+/* Retrieves the CPU time stamp counter
+ * On x86 the counter ticks at a constant reference rate, which can
+ * differ from the actual clock rate when frequency scaling is active
+ * Returns the time stamp counter or 0 if not supported
+ */
+uint64_t checksumbench_get_cycles(
+          void )
+{
+#if defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) )
+	return( (uint64_t) __rdtsc() );
+
+#elif defined( __GNUC__ ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+	return( (uint64_t) __rdtsc() );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Measures a calculation method
+ * The calculation is repeated until at least target size bytes were processed
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_measure_method(
+     checksumbench_method_t *method,
+     const uint8_t *buffer,
+     size_t size,
+     size64_t target_size,
+     uint64_t *checksum_value,
+     uint64_t *number_of_iterations,
+     double *elapsed_time,
+     uint64_t *elapsed_cycles,
+     libcerror_error_t **error )
+{
+	static char *function   = "checksumbench_measure_method";
+	double start_time       = 0.0;
+	uint64_t checksum_64bit = 0;
+	uint64_t iteration      = 0;
+	uint64_t iterations     = 0;
+	uint64_t start_cycles   = 0;
+	uint32_t checksum_32bit = 0;
+	int result              = 0;
+
+	if( method == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid method.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_iterations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of iterations.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_cycles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed cycles.",
+		 function );
+
+		return( -1 );
+	}
+	iterations = (uint64_t) ( target_size / size );
+
+	if( iterations == 0 )
+	{
+		iterations = 1;
+	}
+	start_time   = checksumbench_get_time();
+	start_cycles = checksumbench_get_cycles();
+
+	for( iteration = 0;
+	     iteration < iterations;
+	     iteration++ )
+	{
+		if( method->calculate_32bit != NULL )
+		{
+			result = method->calculate_32bit(
+			          &checksum_32bit,
+			          buffer,
+			          size,
+			          (uint32_t) method->initial_value,
+			          error );
+
+			checksum_64bit = checksum_32bit;
+		}
+		else
+		{
+			result = method->calculate_64bit(
+			          &checksum_64bit,
+			          buffer,
+			          size,
+			          method->initial_value,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate %s checksum using method: %s.",
+			 function,
+			 method->algorithm,
+			 method->name );
+
+			return( -1 );
+		}
+	}
+	*elapsed_cycles       = checksumbench_get_cycles() - start_cycles;
+	*elapsed_time         = checksumbench_get_time() - start_time;
+	*checksum_value       = checksum_64bit;
+	*number_of_iterations = iterations;
+
+	return( 1 );
+}
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use checksumbench to benchmark and verify the checksum calculation\n"
+	                 "methods.\n\n" );
+
+	fprintf( stream, "Usage: checksumbench [ -a algorithm ] [ -m maximum_size ]\n"
+	                 "                     [ -n minimum_size ] [ -t target_size ] [ -hvV ]\n\n" );
+
+	fprintf( stream, "\t-a:     only benchmark the algorithm: adler32, crc32, crc64,\n"
+	                 "\t        fletcher32, fletcher64, xor32 or xor64\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     maximum buffer size (default is 67108864, maximum is\n"
+	                 "\t        1073741824)\n" );
+	fprintf( stream, "\t-n:     minimum buffer size (default is 64)\n" );
+	fprintf( stream, "\t-t:     number of bytes to process per measurement\n"
+	                 "\t        (default is 268435456)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The buffer size starts at the minimum size and is multiplied by 4\n"
+	                 "up to the maximum size. Every size is measured at an aligned and an\n"
+	                 "unaligned (offset 1) start of the buffer.\n\n" );
+	fprintf( stream, "The results are written to stdout as tab separated values:\n"
+	                 "algorithm, method, size, offset, iterations, seconds, GB/s,\n"
+	                 "cycles/byte, checksum and status. The status is ok if the\n"
+	                 "checksum matches that of the first method of the algorithm\n"
+	                 "and mismatch otherwise. The cycles/byte is 0 if the CPU time\n"
+	                 "stamp counter is not supported.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	checksumbench_method_t *method    = NULL;
+	libcerror_error_t *error          = NULL;
+	system_character_t *algorithm     = NULL;
+	uint8_t *buffer                   = NULL;
+	char *program                     = "checksumbench";
+	system_integer_t option           = 0;
+	size_t algorithm_length           = 0;
+	size_t buffer_index               = 0;
+	size_t buffer_offset              = 0;
+	size_t buffer_size                = 0;
+	size_t maximum_size               = CHECKSUMBENCH_DEFAULT_MAXIMUM_SIZE;
+	size_t minimum_size               = CHECKSUMBENCH_DEFAULT_MINIMUM_SIZE;
+	size64_t target_size              = CHECKSUMBENCH_DEFAULT_TARGET_SIZE;
+	double bytes_per_second           = 0.0;
+	double cycles_per_byte            = 0.0;
+	double elapsed_time               = 0.0;
+	uint64_t checksum_value           = 0;
+	uint64_t elapsed_cycles           = 0;
+	uint64_t number_of_iterations     = 0;
+	uint64_t reference_checksum_value = 0;
+	uint32_t random_value             = 0;
+	int algorithm_index               = 0;
+	int method_index                  = 0;
+	int number_of_mismatches          = 0;
+	int verbose                       = 0;
+
+	/* Print the version to stderr to keep stdout machine-readable
+	 */
+	assorted_output_version_fprint(
+	 stderr,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "a:hm:n:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'a':
+				algorithm = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				maximum_size = (size_t) _wtol( optarg );
+#else
+				maximum_size = (size_t) atol( optarg );
+#endif
+				break;
+
+			case 'n':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				minimum_size = (size_t) _wtol( optarg );
+#else
+				minimum_size = (size_t) atol( optarg );
+#endif
+				break;
+
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				target_size = (size64_t) _wtol( optarg );
+#else
+				target_size = (size64_t) atol( optarg );
+#endif
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( ( minimum_size == 0 )
+	 || ( minimum_size > maximum_size ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid minimum size value out of bounds.\n" );
+
+		goto on_error;
+	}
+	if( maximum_size > (size_t) CHECKSUMBENCH_MAXIMUM_SIZE )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid maximum size value exceeds maximum.\n" );
+
+		goto on_error;
+	}
+	if( algorithm != NULL )
+	{
+		for( method_index = 0;
+		     checksumbench_methods[ method_index ].algorithm != NULL;
+		     method_index++ )
+		{
+			if( checksumbench_string_match(
+			     algorithm,
+			     checksumbench_methods[ method_index ].algorithm ) != 0 )
+			{
+				break;
+			}
+		}
+		if( checksumbench_methods[ method_index ].algorithm == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported algorithm: %" PRIs_SYSTEM "\n",
+			 algorithm );
+
+			goto on_error;
+		}
+	}
+	/* Allocate an additional byte to measure an unaligned start of the buffer
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ( maximum_size + 1 ) );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	/* Fill the buffer with reproducible pseudo random data
+	 */
+	random_value = 0x12345678UL;
+
+	for( buffer_index = 0;
+	     buffer_index <= maximum_size;
+	     buffer_index++ )
+	{
+		random_value ^= random_value << 13;
+		random_value ^= random_value >> 17;
+		random_value ^= random_value << 5;
+
+		buffer[ buffer_index ] = (uint8_t) ( random_value >> 24 );
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	fprintf(
+	 stdout,
+	 "algorithm\tmethod\tsize\toffset\titerations\tseconds\tGB/s\tcycles/byte\tchecksum\tstatus\n" );
+
+	/* The methods of an algorithm are consecutive
+	 */
+	algorithm_index = 0;
+
+	while( checksumbench_methods[ algorithm_index ].algorithm != NULL )
+	{
+		algorithm_length = narrow_string_length(
+		                    checksumbench_methods[ algorithm_index ].algorithm );
+
+		for( method_index = algorithm_index;
+		     checksumbench_methods[ method_index ].algorithm != NULL;
+		     method_index++ )
+		{
+			/* Compare the lengths first since narrow_string_compare
+			 * can be memcmp, which must not read past the shorter string
+			 */
+			if( narrow_string_length(
+			     checksumbench_methods[ method_index ].algorithm ) != algorithm_length )
+			{
+				break;
+			}
+			if( narrow_string_compare(
+			     checksumbench_methods[ method_index ].algorithm,
+			     checksumbench_methods[ algorithm_index ].algorithm,
+			     algorithm_length ) != 0 )
+			{
+				break;
+			}
+		}
+		if( ( algorithm != NULL )
+		 && ( checksumbench_string_match(
+		       algorithm,
+		       checksumbench_methods[ algorithm_index ].algorithm ) == 0 ) )
+		{
+			algorithm_index = method_index;
+
+			continue;
+		}
+		for( buffer_size = minimum_size;
+		     buffer_size <= maximum_size;
+		     buffer_size *= 4 )
+		{
+			for( buffer_offset = 0;
+			     buffer_offset <= 1;
+			     buffer_offset++ )
+			{
+				for( method = &( checksumbench_methods[ algorithm_index ] );
+				     method < &( checksumbench_methods[ method_index ] );
+				     method++ )
+				{
+					if( checksumbench_measure_method(
+					     method,
+					     &( buffer[ buffer_offset ] ),
+					     buffer_size,
+					     target_size,
+					     &checksum_value,
+					     &number_of_iterations,
+					     &elapsed_time,
+					     &elapsed_cycles,
+					     &error ) != 1 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to measure method.\n" );
+
+						goto on_error;
+					}
+					if( method == &( checksumbench_methods[ algorithm_index ] ) )
+					{
+						reference_checksum_value = checksum_value;
+					}
+					else if( checksum_value != reference_checksum_value )
+					{
+						number_of_mismatches++;
+					}
+					bytes_per_second = 0.0;
+					cycles_per_byte  = 0.0;
+
+					if( elapsed_time > 0.0 )
+					{
+						bytes_per_second = (double) ( buffer_size * number_of_iterations ) / elapsed_time;
+					}
+					if( elapsed_cycles > 0 )
+					{
+						cycles_per_byte = (double) elapsed_cycles / (double) ( buffer_size * number_of_iterations );
+					}
+					fprintf(
+					 stdout,
+					 "%s\t%s\t%" PRIzd "\t%" PRIzd "\t%" PRIu64 "\t%.6f\t%.3f\t%.3f\t0x%08" PRIx64 "\t%s\n",
+					 method->algorithm,
+					 method->name,
+					 buffer_size,
+					 buffer_offset,
+					 number_of_iterations,
+					 elapsed_time,
+					 bytes_per_second / 1000000000.0,
+					 cycles_per_byte,
+					 checksum_value,
+					 ( checksum_value == reference_checksum_value ) ? "ok" : "mismatch" );
+				}
+			}
+			/* Prevent the buffer size from overflowing
+			 */
+			if( buffer_size > ( maximum_size / 4 ) )
+			{
+				break;
+			}
+		}
+		algorithm_index = method_index;
+	}
+	memory_free(
+	 buffer );
+
+	if( number_of_mismatches != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Found %d mismatching checksums.\n",
+		 number_of_mismatches );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
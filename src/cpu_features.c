@@ -0,0 +1,319 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "cpu_features.h"
+
+#if defined( CPU_FEATURES_HAVE_CPUID )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/* The names of the CPU features as used in the mask string
+ */
+const char *cpu_features_names[ 4 ] = {
+	"ssse3", "avx2", "pclmulqdq", "neon" };
+
+const uint32_t cpu_features_name_flags[ 4 ] = {
+	CPU_FEATURE_FLAG_SSSE3, CPU_FEATURE_FLAG_AVX2, CPU_FEATURE_FLAG_PCLMULQDQ, CPU_FEATURE_FLAG_NEON };
+
+/* The CPU features supported by the CPU and operating system
+ */
+uint32_t cpu_features_flags = 0;
+
+/* Value to indicate the CPU features have been detected
+ */
+int cpu_features_detected = 0;
+
+/* The CPU features that are allowed to be used
+ */
+uint32_t cpu_features_mask = 0xffffffffUL;
+
+/* Value to indicate the mask has been set
+ */
+int cpu_features_mask_set = 0;
+
+/* Retrieves the CPU features that can be used
+ * The CPU features are detected once and restricted by the mask, if the mask
+ * was not set the environment variable ASSORTED_CPU_FEATURES is used
+ * Returns the CPU feature flags
+ */
+uint32_t cpu_features_get_flags(
+          void )
+{
+	const system_character_t *string = NULL;
+
+	if( cpu_features_detected == 0 )
+	{
+		cpu_features_flags    = cpu_features_detect();
+		cpu_features_detected = 1;
+	}
+	if( cpu_features_mask_set == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		string = _wgetenv(
+		          _SYSTEM_STRING( "ASSORTED_CPU_FEATURES" ) );
+#else
+		string = getenv(
+		          "ASSORTED_CPU_FEATURES" );
+#endif
+		/* An invalid environment variable is ignored
+		 */
+		if( ( string == NULL )
+		 || ( cpu_features_set_mask(
+		       string,
+		       NULL ) != 1 ) )
+		{
+			cpu_features_mask     = 0xffffffffUL;
+			cpu_features_mask_set = 1;
+		}
+	}
+	return( cpu_features_flags & cpu_features_mask );
+}
+
+/* Determines if a CPU feature can be used
+ * Returns 1 if supported or 0 if not
+ */
+int cpu_features_has_support(
+     uint32_t feature_flag )
+{
+	if( ( cpu_features_get_flags() & feature_flag ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the CPU features that are allowed to be used
+ * The string contains "auto" to use all supported features, "none" to use
+ * none or a comma separated list of feature names, such as "ssse3,pclmulqdq"
+ * Returns 1 if successful or -1 on error
+ */
+int cpu_features_set_mask(
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "cpu_features_set_mask";
+	const char *name      = NULL;
+	size_t name_index     = 0;
+	size_t string_index   = 0;
+	size_t token_index    = 0;
+	uint32_t mask         = 0;
+	int feature_index     = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string or feature name is not supported
+	 */
+	do
+	{
+		token_index = string_index;
+
+		while( ( string[ string_index ] != 0 )
+		    && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			string_index++;
+		}
+		for( feature_index = -2;
+		     feature_index < 4;
+		     feature_index++ )
+		{
+			if( feature_index == -2 )
+			{
+				name = "auto";
+			}
+			else if( feature_index == -1 )
+			{
+				name = "none";
+			}
+			else
+			{
+				name = cpu_features_names[ feature_index ];
+			}
+			for( name_index = 0;
+			     ( token_index + name_index ) < string_index;
+			     name_index++ )
+			{
+				if( string[ token_index + name_index ] != (system_character_t) name[ name_index ] )
+				{
+					break;
+				}
+			}
+			if( ( ( token_index + name_index ) == string_index )
+			 && ( name[ name_index ] == 0 ) )
+			{
+				break;
+			}
+		}
+		if( feature_index >= 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported CPU feature.",
+			 function );
+
+			return( -1 );
+		}
+		if( feature_index == -2 )
+		{
+			mask = 0xffffffffUL;
+		}
+		else if( feature_index >= 0 )
+		{
+			mask |= cpu_features_name_flags[ feature_index ];
+		}
+	}
+	while( string[ string_index++ ] != 0 );
+
+	cpu_features_mask     = mask;
+	cpu_features_mask_set = 1;
+
+	return( 1 );
+}
+
+/* Detects the CPU features supported by the CPU and operating system
+ * Returns the CPU feature flags
+ */
+uint32_t cpu_features_detect(
+          void )
+{
+#if defined( CPU_FEATURES_HAVE_CPUID )
+#if defined( _MSC_VER )
+	int cpu_information[ 4 ];
+#endif
+	unsigned int register_eax = 0;
+	unsigned int register_ebx = 0;
+	unsigned int register_ecx = 0;
+	unsigned int register_edx = 0;
+	uint32_t maximum_leaf     = 0;
+	uint32_t xcr0             = 0;
+#endif
+	uint32_t feature_flags    = 0;
+
+#if defined( CPU_FEATURES_HAVE_CPUID )
+#if defined( _MSC_VER )
+	__cpuid(
+	 cpu_information,
+	 0 );
+
+	maximum_leaf = (uint32_t) cpu_information[ 0 ];
+
+	if( maximum_leaf >= 1 )
+	{
+		__cpuid(
+		 cpu_information,
+		 1 );
+
+		register_ecx = (unsigned int) cpu_information[ 2 ];
+	}
+#else
+	maximum_leaf = (uint32_t) __get_cpuid_max(
+	                           0,
+	                           NULL );
+
+	if( maximum_leaf >= 1 )
+	{
+		__cpuid(
+		 1,
+		 register_eax,
+		 register_ebx,
+		 register_ecx,
+		 register_edx );
+	}
+#endif
+	if( ( register_ecx & 0x00000002UL ) != 0 )
+	{
+		feature_flags |= CPU_FEATURE_FLAG_PCLMULQDQ;
+	}
+	if( ( register_ecx & 0x00000200UL ) != 0 )
+	{
+		feature_flags |= CPU_FEATURE_FLAG_SSSE3;
+	}
+	/* AVX2 requires that the operating system saves the YMM registers,
+	 * which is indicated by OSXSAVE, AVX and XCR0
+	 */
+	if( ( maximum_leaf >= 7 )
+	 && ( ( register_ecx & 0x18000000UL ) == 0x18000000UL ) )
+	{
+#if defined( _MSC_VER )
+		xcr0 = (uint32_t) _xgetbv(
+		                   0 );
+#else
+		__asm__ __volatile__ (
+		 "xgetbv"
+		 : "=a" ( xcr0 ), "=d" ( register_edx )
+		 : "c" ( 0 ) );
+#endif
+		if( ( xcr0 & 0x00000006UL ) == 0x00000006UL )
+		{
+#if defined( _MSC_VER )
+			__cpuidex(
+			 cpu_information,
+			 7,
+			 0 );
+
+			register_ebx = (unsigned int) cpu_information[ 1 ];
+#else
+			__cpuid_count(
+			 7,
+			 0,
+			 register_eax,
+			 register_ebx,
+			 register_ecx,
+			 register_edx );
+#endif
+			if( ( register_ebx & 0x00000020UL ) != 0 )
+			{
+				feature_flags |= CPU_FEATURE_FLAG_AVX2;
+			}
+		}
+	}
+#endif /* defined( CPU_FEATURES_HAVE_CPUID ) */
+
+#if defined( __aarch64__ ) && defined( __ARM_NEON )
+	/* NEON is always supported on AArch64
+	 */
+	feature_flags |= CPU_FEATURE_FLAG_NEON;
+#endif
+	return( feature_flags );
+}
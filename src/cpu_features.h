@@ -0,0 +1,65 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CPU_FEATURES_H )
+#define _CPU_FEATURES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The CPU identification (CPUID) instruction is available on x86 and x86-64
+ */
+#if ( defined( __GNUC__ ) && ( defined( __i386__ ) || defined( __x86_64__ ) ) ) || ( defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) ) )
+#define CPU_FEATURES_HAVE_CPUID
+#endif
+
+enum CPU_FEATURE_FLAGS
+{
+	CPU_FEATURE_FLAG_SSSE3		= 0x00000001UL,
+	CPU_FEATURE_FLAG_AVX2		= 0x00000002UL,
+	CPU_FEATURE_FLAG_PCLMULQDQ	= 0x00000004UL,
+	CPU_FEATURE_FLAG_NEON		= 0x00000008UL
+};
+
+uint32_t cpu_features_get_flags(
+          void );
+
+int cpu_features_has_support(
+     uint32_t feature_flag );
+
+int cpu_features_set_mask(
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+uint32_t cpu_features_detect(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CPU_FEATURES_H ) */
@@ -20,11 +20,24 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "crc32.h"
 
+#if defined( CRC32_HAVE_PCLMULQDQ )
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#if defined( CRC32_HAVE_PCLMULQDQ ) && defined( __GNUC__ )
+#define CRC32_TARGET_PCLMULQDQ	__attribute__(( target( "sse2,pclmul" ) ))
+#else
+#define CRC32_TARGET_PCLMULQDQ
+#endif
+
 /* Polynomials
  *
  * RFC 1952
@@ -47,10 +60,39 @@
  */
 uint32_t crc32_table[ 256 ];
 
+/* Tables of the CRC-32 of all 8-bit messages followed by 1 to 15 zero bytes
+ * used by the slicing-by-8 and slicing-by-16 calculations
+ */
+uint32_t crc32_slicing_table[ 16 ][ 256 ];
+
 /* Value to indicate the CRC-32 table been computed
  */
 int crc32_table_computed = 0;
 
+/* The polynomial of the computed CRC-32 table
+ */
+uint32_t crc32_table_polynomial = 0;
+
+#if defined( CRC32_HAVE_PCLMULQDQ )
+
+/* The bit-reflected folding and Barrett reduction constants for polynomial 0xedb88320
+ * k1 = x^(4*128+32) mod P, k2 = x^(4*128-32) mod P, k3 = x^(128+32) mod P, k4 = x^(128-32) mod P,
+ * k5 = x^64 mod P, mu = x^64 / P and P
+ */
+const uint64_t crc32_pclmulqdq_fold_by_4_constants[ 2 ] = {
+	0x0154442bd4ULL, 0x01c6e41596ULL };
+
+const uint64_t crc32_pclmulqdq_fold_by_1_constants[ 2 ] = {
+	0x01751997d0ULL, 0x00ccaa009eULL };
+
+const uint64_t crc32_pclmulqdq_fold_64bit_constants[ 2 ] = {
+	0x0163cd6124ULL, 0x0000000000ULL };
+
+const uint64_t crc32_pclmulqdq_barrett_constants[ 2 ] = {
+	0x01db710641ULL, 0x01f7011641ULL };
+
+#endif /* defined( CRC32_HAVE_PCLMULQDQ ) */
+
 /* Initializes the internal CRC-32 table
  * The table speeds up the CRC-32 calculation
  * Use the reversed polynomial
@@ -61,6 +103,7 @@ void initialize_crc32_table(
 	uint32_t crc32             = 0;
 	uint32_t crc32_table_index = 0;
 	uint8_t bit_iterator       = 0;
+	uint8_t slice_index        = 0;
 
 	for( crc32_table_index = 0;
 	     crc32_table_index < 256;
@@ -82,8 +125,26 @@ void initialize_crc32_table(
 			}
 		}
 		crc32_table[ crc32_table_index ] = crc32;
+
+		crc32_slicing_table[ 0 ][ crc32_table_index ] = crc32;
+	}
+	for( crc32_table_index = 0;
+	     crc32_table_index < 256;
+	     crc32_table_index++ )
+	{
+		crc32 = crc32_table[ crc32_table_index ];
+
+		for( slice_index = 1;
+		     slice_index < 16;
+		     slice_index++ )
+		{
+			crc32 = crc32_table[ crc32 & 0x000000ffUL ] ^ ( crc32 >> 8 );
+
+			crc32_slicing_table[ slice_index ][ crc32_table_index ] = crc32;
+		}
 	}
-	crc32_table_computed = 1;
+	crc32_table_polynomial = polynomial;
+	crc32_table_computed   = 1;
 }
 
 /* Calculates the CRC-32 of a buffer
@@ -147,9 +208,23 @@ int crc32_calculate_modulo2(
 	{
 		*crc32 ^= (uint32_t) 0xffffffffUL;
 	}
+	/* Mirror the bit order of the initial value from the center
+	 */
+	for( bit_index = 0;
+	     bit_index < 32;
+	     bit_index++ )
+	{
+		if( ( *crc32 & 0x00000001UL ) != 0 )
+		{
+			mirror_value |= (uint32_t) 1UL << ( 31 - bit_index );
+		}
+		*crc32 = *crc32 >> 1;
+	}
+	*crc32 = mirror_value;
+
 	/* Perform a byte for byte modulo-2 division
 	 */
-        for( buffer_offset = 0;
+	for( buffer_offset = 0;
 	     buffer_offset < size;
 	     buffer_offset++ )
 	{
@@ -189,13 +264,15 @@ int crc32_calculate_modulo2(
 	}
 	/* Mirror the bit order of the CRC-32 value from the center
 	 */
+	mirror_value = 0;
+
 	for( bit_index = 0;
 	     bit_index < 32;
 	     bit_index++ )
 	{
 		if( ( *crc32 & 0x00000001UL ) != 0 )
 		{
-			mirror_value |= ( 1 << ( 31 - bit_index ) );
+			mirror_value |= (uint32_t) 1UL << ( 31 - bit_index );
 		}
 		*crc32 = *crc32 >> 1;
 	}
@@ -283,6 +360,616 @@ int crc32_calculate(
 	return( 1 );
 }
 
+/* Calculates the CRC-32 of a buffer
+ * Uses 8 lookup tables to process 8 bytes per iteration
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_calculate_slicing_by_8";
+	size_t buffer_offset  = 0;
+	uint32_t value_32bit  = 0;
+	uint32_t safe_crc32   = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32_table_computed == 0 )
+	{
+		initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		safe_crc32 ^= value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset + 4 ] ),
+		 value_32bit );
+
+		safe_crc32 = crc32_slicing_table[ 7 ][ safe_crc32 & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 6 ][ ( safe_crc32 >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 5 ][ ( safe_crc32 >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 4 ][ safe_crc32 >> 24 ]
+		           ^ crc32_slicing_table[ 3 ][ value_32bit & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 2 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 1 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 0 ][ value_32bit >> 24 ];
+
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+		safe_crc32 = crc32_table[ ( safe_crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL ] ^ ( safe_crc32 >> 8 );
+
+		buffer_offset++;
+	}
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of a buffer
+ * Uses 16 lookup tables to process 16 bytes per iteration
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function  = "crc32_calculate_slicing_by_16";
+	size_t buffer_offset   = 0;
+	uint32_t value_32bit_1 = 0;
+	uint32_t value_32bit_2 = 0;
+	uint32_t value_32bit_3 = 0;
+	uint32_t safe_crc32    = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32_table_computed == 0 )
+	{
+		initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit_1 );
+
+		safe_crc32 ^= value_32bit_1;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset + 4 ] ),
+		 value_32bit_1 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset + 8 ] ),
+		 value_32bit_2 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset + 12 ] ),
+		 value_32bit_3 );
+
+		safe_crc32 = crc32_slicing_table[ 15 ][ safe_crc32 & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 14 ][ ( safe_crc32 >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 13 ][ ( safe_crc32 >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 12 ][ safe_crc32 >> 24 ]
+		           ^ crc32_slicing_table[ 11 ][ value_32bit_1 & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 10 ][ ( value_32bit_1 >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 9 ][ ( value_32bit_1 >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 8 ][ value_32bit_1 >> 24 ]
+		           ^ crc32_slicing_table[ 7 ][ value_32bit_2 & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 6 ][ ( value_32bit_2 >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 5 ][ ( value_32bit_2 >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 4 ][ value_32bit_2 >> 24 ]
+		           ^ crc32_slicing_table[ 3 ][ value_32bit_3 & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 2 ][ ( value_32bit_3 >> 8 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 1 ][ ( value_32bit_3 >> 16 ) & 0x000000ffUL ]
+		           ^ crc32_slicing_table[ 0 ][ value_32bit_3 >> 24 ];
+
+		buffer_offset += 16;
+	}
+	while( buffer_offset < size )
+	{
+		safe_crc32 = crc32_table[ ( safe_crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL ] ^ ( safe_crc32 >> 8 );
+
+		buffer_offset++;
+	}
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of a buffer
+ * Uses carry-less multiplication (PCLMULQDQ) folding if supported by the CPU
+ * and the table was computed for polynomial 0xedb88320, otherwise falls back
+ * to the slicing-by-16 calculation
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_calculate_folding(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_calculate_folding";
+	size_t buffer_offset  = 0;
+	uint32_t safe_crc32   = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32_table_computed == 0 )
+	{
+		initialize_crc32_table(
+		 0xedb88320UL );
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+#if defined( CRC32_HAVE_PCLMULQDQ )
+	/* The folding constants are specific to the polynomial
+	 */
+	if( ( size >= 64 )
+	 && ( crc32_table_polynomial == 0xedb88320UL )
+	 && ( cpu_features_has_support( CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc32 = crc32_fold_pclmulqdq(
+		              safe_crc32,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+	/* Calculate the remainder as a weak CRC-32 to continue from the intermediate value
+	 */
+	if( crc32_calculate_slicing_by_16(
+	     &safe_crc32,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     safe_crc32,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+#if defined( CRC32_HAVE_PCLMULQDQ )
+
+/* Folds a buffer into an intermediate CRC-32 using carry-less multiplication
+ * Based on "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * by Intel for the bit-reflected polynomial 0xedb88320
+ * The size must be a multiple of 16 and at least 64
+ * Returns the intermediate CRC-32
+ */
+CRC32_TARGET_PCLMULQDQ
+uint32_t crc32_fold_pclmulqdq(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size )
+{
+	__m128i constants = _mm_setzero_si128();
+	__m128i fold1     = _mm_setzero_si128();
+	__m128i fold2     = _mm_setzero_si128();
+	__m128i fold3     = _mm_setzero_si128();
+	__m128i fold4     = _mm_setzero_si128();
+	__m128i mask      = _mm_setzero_si128();
+	__m128i product1  = _mm_setzero_si128();
+	__m128i product2  = _mm_setzero_si128();
+	__m128i product3  = _mm_setzero_si128();
+	__m128i product4  = _mm_setzero_si128();
+	__m128i value     = _mm_setzero_si128();
+
+	fold1 = _mm_loadu_si128(
+	         (const __m128i *) buffer );
+	fold2 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 16 ] ) );
+	fold3 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 32 ] ) );
+	fold4 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 48 ] ) );
+
+	fold1 = _mm_xor_si128(
+	         fold1,
+	         _mm_cvtsi32_si128( (int) crc32 ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	/* Fold 4 x 128-bit in parallel
+	 */
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc32_pclmulqdq_fold_by_4_constants );
+
+	while( size >= 64 )
+	{
+		product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+		product2 = _mm_clmulepi64_si128( fold2, constants, 0x00 );
+		product3 = _mm_clmulepi64_si128( fold3, constants, 0x00 );
+		product4 = _mm_clmulepi64_si128( fold4, constants, 0x00 );
+
+		fold1 = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+		fold2 = _mm_clmulepi64_si128( fold2, constants, 0x11 );
+		fold3 = _mm_clmulepi64_si128( fold3, constants, 0x11 );
+		fold4 = _mm_clmulepi64_si128( fold4, constants, 0x11 );
+
+		fold1 = _mm_xor_si128( fold1, product1 );
+		fold2 = _mm_xor_si128( fold2, product2 );
+		fold3 = _mm_xor_si128( fold3, product3 );
+		fold4 = _mm_xor_si128( fold4, product4 );
+
+		fold1 = _mm_xor_si128( fold1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		fold2 = _mm_xor_si128( fold2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		fold3 = _mm_xor_si128( fold3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		fold4 = _mm_xor_si128( fold4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc32_pclmulqdq_fold_by_1_constants );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold2 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold3 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold4 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	/* Fold the remaining 128-bit blocks
+	 */
+	while( size >= 16 )
+	{
+		value = _mm_loadu_si128(
+		         (const __m128i *) buffer );
+
+		product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+		fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+		fold1    = _mm_xor_si128( fold1, value );
+		fold1    = _mm_xor_si128( fold1, product1 );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* Fold 128-bit into 64-bit
+	 */
+	mask = _mm_setr_epi32( -1, 0, -1, 0 );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x10 );
+	fold1    = _mm_srli_si128( fold1, 8 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc32_pclmulqdq_fold_64bit_constants );
+
+	product1 = _mm_srli_si128( fold1, 4 );
+	fold1    = _mm_and_si128( fold1, mask );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	/* Barrett reduce into 32-bit
+	 */
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc32_pclmulqdq_barrett_constants );
+
+	product1 = _mm_and_si128( fold1, mask );
+	product1 = _mm_clmulepi64_si128( product1, constants, 0x10 );
+	product1 = _mm_and_si128( product1, mask );
+	product1 = _mm_clmulepi64_si128( product1, constants, 0x00 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	return( (uint32_t) _mm_cvtsi128_si32( _mm_srli_si128( fold1, 4 ) ) );
+}
+
+#endif /* defined( CRC32_HAVE_PCLMULQDQ ) */
+
+/* Multiplies a vector by a 32 x 32 GF(2) matrix
+ * Returns the resulting vector
+ */
+uint32_t crc32_gf2_matrix_multiply(
+          const uint32_t *matrix,
+          uint32_t vector )
+{
+	uint32_t result_vector = 0;
+	uint8_t row_index      = 0;
+
+	while( vector != 0 )
+	{
+		if( ( vector & 0x00000001UL ) != 0 )
+		{
+			result_vector ^= matrix[ row_index ];
+		}
+		vector >>= 1;
+
+		row_index++;
+	}
+	return( result_vector );
+}
+
+/* Squares a 32 x 32 GF(2) matrix
+ */
+void crc32_gf2_matrix_square(
+      uint32_t *square_matrix,
+      const uint32_t *matrix )
+{
+	uint8_t row_index = 0;
+
+	for( row_index = 0;
+	     row_index < 32;
+	     row_index++ )
+	{
+		square_matrix[ row_index ] = crc32_gf2_matrix_multiply(
+		                              matrix,
+		                              matrix[ row_index ] );
+	}
+}
+
+/* Combines the CRC-32 of two consecutive buffers into the CRC-32 of both buffers
+ * The second CRC-32 must be calculated with an initial value of 0, the same
+ * weak CRC setting and the same (reversed) polynomial as the first CRC-32
+ * The first CRC-32 is shifted over the size of the second buffer by
+ * multiplying it with a GF(2) matrix that represents a shift of 1 zero bit,
+ * which is squared for every bit of the size
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_combine_checksums(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     uint32_t polynomial,
+     libcerror_error_t **error )
+{
+	uint32_t even_matrix[ 32 ];
+	uint32_t odd_matrix[ 32 ];
+
+	static char *function = "crc32_combine_checksums";
+	uint32_t row_value    = 0;
+	uint8_t row_index     = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_size == 0 )
+	{
+		*crc32 = first_crc32;
+
+		return( 1 );
+	}
+	/* The matrix that represents a shift of 1 zero bit
+	 */
+	odd_matrix[ 0 ] = polynomial;
+
+	row_value = 1;
+
+	for( row_index = 1;
+	     row_index < 32;
+	     row_index++ )
+	{
+		odd_matrix[ row_index ] = row_value;
+
+		row_value <<= 1;
+	}
+	/* The matrix that represents a shift of 2 zero bits
+	 */
+	crc32_gf2_matrix_square(
+	 even_matrix,
+	 odd_matrix );
+
+	/* The matrix that represents a shift of 4 zero bits
+	 */
+	crc32_gf2_matrix_square(
+	 odd_matrix,
+	 even_matrix );
+
+	/* Shift the first CRC-32 by the size of the second buffer in bytes
+	 * where the first squaring results in a shift of 1 zero byte
+	 */
+	do
+	{
+		crc32_gf2_matrix_square(
+		 even_matrix,
+		 odd_matrix );
+
+		if( ( second_size & 1 ) != 0 )
+		{
+			first_crc32 = crc32_gf2_matrix_multiply(
+			               even_matrix,
+			               first_crc32 );
+		}
+		second_size >>= 1;
+
+		if( second_size == 0 )
+		{
+			break;
+		}
+		crc32_gf2_matrix_square(
+		 odd_matrix,
+		 even_matrix );
+
+		if( ( second_size & 1 ) != 0 )
+		{
+			first_crc32 = crc32_gf2_matrix_multiply(
+			               odd_matrix,
+			               first_crc32 );
+		}
+		second_size >>= 1;
+	}
+	while( second_size != 0 );
+
+	*crc32 = first_crc32 ^ second_crc32;
+
+	return( 1 );
+}
+
 /* Check the CRC-32 checksum for single-bit errors
  * Returns 1 if successful, 0 if no error was found or -1 on error
  */
@@ -421,7 +1108,7 @@ int crc32_locate_error_offset(
 	{
 		if( ( calculated_crc32 & 0x00000001UL ) != 0 )
 		{
-			mirror_value |= ( 1 << ( 31 - bit_index ) );
+			mirror_value |= (uint32_t) 1UL << ( 31 - bit_index );
 		}
 		calculated_crc32 = calculated_crc32 >> 1;
 	}
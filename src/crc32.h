@@ -31,6 +31,13 @@
 extern "C" {
 #endif
 
+/* The carry-less multiplication (PCLMULQDQ) folding engine is only
+ * available on x86-64, support by the CPU is determined at run-time
+ */
+#if ( defined( __GNUC__ ) && defined( __x86_64__ ) ) || ( defined( _MSC_VER ) && defined( _M_X64 ) )
+#define CRC32_HAVE_PCLMULQDQ
+#endif
+
 void initialize_crc32_table(
       uint32_t polynomial );
 
@@ -50,6 +57,55 @@ int crc32_calculate(
      uint8_t weak_crc,
      libcerror_error_t **error );
 
+int crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int crc32_calculate_folding(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+#if defined( CRC32_HAVE_PCLMULQDQ )
+
+uint32_t crc32_fold_pclmulqdq(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( CRC32_HAVE_PCLMULQDQ ) */
+
+uint32_t crc32_gf2_matrix_multiply(
+          const uint32_t *matrix,
+          uint32_t vector );
+
+void crc32_gf2_matrix_square(
+      uint32_t *square_matrix,
+      const uint32_t *matrix );
+
+int crc32_combine_checksums(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     uint32_t polynomial,
+     libcerror_error_t **error );
+
 int crc32_validate(
      uint32_t crc32,
      uint32_t calculated_crc32,
@@ -34,7 +34,11 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "block_reader.h"
+#include "checksum.h"
+#include "cpu_features.h"
 #include "crc32.h"
+#include "parallel_checksum.h"
 
 /* Prints the executable usage information
  */
@@ -47,20 +51,37 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use crc32sum to calculate a CRC-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: crc32sum [ -c crc ] [ -i initial_value ] [ -o offset ]\n"
-	                 "                [ -p polynomial ] [ -s size ] [ -12hvVw ] source\n\n" );
+	fprintf( stream, "Usage: crc32sum [ -b block_size ] [ -c crc ] [ -f features ]\n"
+	                 "                [ -i initial_value ] [ -o offset ] [ -p polynomial ]\n"
+	                 "                [ -s size ] [ -t threads ] [ -1234hvVw ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\tBy default the fastest calculation method supported by the CPU\n"
+	                 "\tis used\n\n" );
+
 	fprintf( stream, "\t-1:     use the modulo-2 calculation method\n" );
-	fprintf( stream, "\t-2:     use the table lookup calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the table lookup calculation method\n" );
+	fprintf( stream, "\t-3:     use the slicing-by-16 table lookup calculation method\n" );
+	fprintf( stream, "\t-4:     use the carry-less multiplication folding calculation\n"
+	                 "\t        method if supported by the CPU, otherwise falls back\n"
+	                 "\t        to -3\n" );
+	fprintf( stream, "\t-b:     block size of the data read at once, must be a multiple\n"
+	                 "\t        of 512 and at most 1073741824 (default is 4194304)\n" );
 	fprintf( stream, "\t-c:     check the calculated CRC-32 with the one provided.\n"
-	                 "\t        On a mismatch crc32 will try to locate the error.\n" );
+	                 "\t        On a mismatch crc32 will try to locate a single\n"
+	                 "\t        bit-error in the CRC-32.\n" );
+	fprintf( stream, "\t-f:     CPU features the default calculation method can use: auto\n"
+	                 "\t        (default), none or a comma separated list of: pclmulqdq.\n"
+	                 "\t        Overrides the ASSORTED_CPU_FEATURES environment variable\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial value (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-p:     polynomial (default is 0xedb88320)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     number of threads to calculate the CRC-32 with, the data\n"
+	                 "\t        is split into a range per thread and the CRC-32s of the\n"
+	                 "\t        ranges are combined (default is 1)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\t-w:     use weak CRC calculation, without the initial and\n"
@@ -78,20 +99,27 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error     = NULL;
 	libcfile_file_t *source_file = NULL;
+	system_character_t *features = NULL;
 	system_character_t *source   = NULL;
+	block_reader_t *block_reader = NULL;
+	uint8_t *block_data          = NULL;
 	uint8_t *buffer              = NULL;
 	char *program                = "crc32sum";
 	system_integer_t option      = 0;
+	size_t block_data_size       = 0;
+	size_t block_size            = BLOCK_READER_DEFAULT_BLOCK_SIZE;
 	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
+	uint64_t combined_checksum   = 0;
 	off_t source_offset          = 0;
+	ssize_t read_count           = 0;
 	uint32_t calculated_crc32    = 0;
 	uint32_t crc32               = 0;
 	uint32_t initial_value       = 0;
 	uint32_t polynomial          = 0xedb88320UL;
 	uint8_t bit_index            = 0;
 	uint8_t weak_crc             = 0;
-	int calculation_method       = 2;
+	int calculation_method       = 0;
+	int number_of_threads        = 1;
 	int result                   = 0;
 	int validate_crc             = 0;
 	int verbose                  = 0;
@@ -103,7 +131,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12c:hi:o:p:s:vVw" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "1234b:c:f:hi:o:p:s:t:vVw" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -129,6 +157,24 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case '4':
+				calculation_method = 4;
+
+				break;
+
+			case 'b':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				block_size = (size_t) _wtol( optarg );
+#else
+				block_size = (size_t) atol( optarg );
+#endif
+				break;
+
 			case 'c':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				crc32 = _wtol( optarg );
@@ -139,6 +185,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'f':
+				features = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -177,6 +228,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -207,12 +266,63 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > PARALLEL_CHECKSUM_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( calculation_method != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Threads are only supported by the default calculation method.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( features != NULL )
+	{
+		if( cpu_features_set_mask(
+		     features,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported CPU features.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+	}
+	if( checksum_initialize(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize checksum calculation.\n" );
+
+		goto on_error;
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -268,112 +378,168 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( calculation_method != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
+		initialize_crc32_table(
+		 polynomial );
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
+	if( number_of_threads > 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		if( parallel_checksum_calculate(
+		     &combined_checksum,
+		     PARALLEL_CHECKSUM_TYPE_CRC32,
+		     source,
+		     (off64_t) source_offset,
+		     source_size,
+		     block_size,
+		     number_of_threads,
+		     (uint64_t) initial_value,
+		     weak_crc,
+		     (uint64_t) polynomial,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC-32 in parallel.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		calculated_crc32 = (uint32_t) combined_checksum;
 	}
-	/* Position the source file at the right offset
-	 */
-	if( libcfile_file_seek_offset(
-	     source_file,
-	     source_offset,
-	     SEEK_SET,
-	     &error ) == -1 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to seek offset in source file.\n" );
+		if( block_reader_initialize(
+		     &block_reader,
+		     block_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create block reader.\n" );
 
-		goto on_error;
-	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+			goto on_error;
+		}
+		/* Position the source file at the right offset
+		 */
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     source_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
 
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+			goto on_error;
+		}
+		if( block_reader_open(
+		     block_reader,
+		     source_file,
+		     source_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open block reader.\n" );
 
-		goto on_error;
-	}
-	/* Clean up
-	 */
-	if( libcfile_file_close(
-	     source_file,
-	     &error ) != 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to close source file.\n" );
+			goto on_error;
+		}
+		calculated_crc32 = initial_value;
+
+		/* Calculate the checksum block by block, using the checksum
+		 * of the previous blocks as the initial value
+		 */
+		while( ( result = block_reader_get_next_block(
+		                   block_reader,
+		                   &block_data,
+		                   &block_data_size,
+		                   &error ) ) == 1 )
+		{
+			if( calculation_method == 0 )
+			{
+				result = checksum_calculate_crc32(
+					  &calculated_crc32,
+					  block_data,
+					  block_data_size,
+					  calculated_crc32,
+					  weak_crc,
+					  &error );
+			}
+			else if( calculation_method == 1 )
+			{
+				result = crc32_calculate_modulo2(
+					  &calculated_crc32,
+					  block_data,
+					  block_data_size,
+					  calculated_crc32,
+					  weak_crc,
+					  &error );
+			}
+			else if( calculation_method == 2 )
+			{
+				result = crc32_calculate(
+					  &calculated_crc32,
+					  block_data,
+					  block_data_size,
+					  calculated_crc32,
+					  weak_crc,
+					  &error );
+			}
+			else if( calculation_method == 3 )
+			{
+				result = crc32_calculate_slicing_by_16(
+					  &calculated_crc32,
+					  block_data,
+					  block_data_size,
+					  calculated_crc32,
+					  weak_crc,
+					  &error );
+			}
+			else if( calculation_method == 4 )
+			{
+				result = crc32_calculate_folding(
+					  &calculated_crc32,
+					  block_data,
+					  block_data_size,
+					  calculated_crc32,
+					  weak_crc,
+					  &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate CRC-32.\n" );
 
-		goto on_error;
-	}
-	if( libcfile_file_free(
-	     &source_file,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to free source file.\n" );
+				goto on_error;
+			}
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_data(
+				 block_data,
+				 block_data_size,
+				 0 );
+			}
+		}
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
 
-		goto on_error;
-	}
-	if( calculation_method == 1 )
-	{
-		result = crc32_calculate_modulo2(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
-	}
-	else if( calculation_method == 2 )
-	{
-                initialize_crc32_table(
-                 polynomial );
-
-		result = crc32_calculate(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate CRC-32.\n" );
+			goto on_error;
+		}
+		if( block_reader_free(
+		     &block_reader,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free block reader.\n" );
 
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
+			goto on_error;
+		}
 	}
 	fprintf(
 	 stdout,
@@ -412,21 +578,74 @@ int main( int argc, char * const argv[] )
 				 "Single bit-error in bit: %" PRIu8 " of CRC-32\n",
 				 bit_index );
 			}
-			result = crc32_locate_error_offset(
-			          crc32,
-			          calculated_crc32,
-			          buffer,
-			          source_size,
-			          initial_value,
-			          &error );
-
-			if( result == -1 )
+			/* Locating the error offset requires the entire data
+			 * so the source is read again
+			 */
+			if( source_size > (size64_t) SSIZE_MAX )
 			{
 				fprintf(
-				 stderr,
-				 "Unable to locate error.\n" );
-
-				goto on_error;
+				 stdout,
+				 "Unable to locate error offset source size exceeds maximum.\n" );
+			}
+			else
+			{
+				buffer = (uint8_t *) memory_allocate(
+				                      sizeof( uint8_t ) * (size_t) source_size );
+
+				if( buffer == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to create buffer.\n" );
+
+					goto on_error;
+				}
+				if( libcfile_file_seek_offset(
+				     source_file,
+				     source_offset,
+				     SEEK_SET,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to seek offset in source file.\n" );
+
+					goto on_error;
+				}
+				read_count = libcfile_file_read_buffer(
+					      source_file,
+					      buffer,
+					      (size_t) source_size,
+					      &error );
+
+				if( read_count != (ssize_t) source_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read from source file.\n" );
+
+					goto on_error;
+				}
+				result = crc32_locate_error_offset(
+				          crc32,
+				          calculated_crc32,
+				          buffer,
+				          (size_t) source_size,
+				          initial_value,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to locate error.\n" );
+
+					goto on_error;
+				}
+				memory_free(
+				 buffer );
+
+				buffer = NULL;
 			}
 		}
 		else
@@ -438,9 +657,28 @@ int main( int argc, char * const argv[] )
 			 calculated_crc32 );
 		}
 	}
-	memory_free(
-	 buffer );
+	/* Clean up
+	 */
+	if( libcfile_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
 
+		goto on_error;
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -451,6 +689,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( block_reader != NULL )
+	{
+		block_reader_free(
+		 &block_reader,
+		 NULL );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
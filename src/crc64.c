@@ -20,13 +20,37 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
+#include "cpu_features.h"
 #include "crc64.h"
 
+#if defined( CRC64_HAVE_PCLMULQDQ )
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#if defined( CRC64_HAVE_PCLMULQDQ ) && defined( __GNUC__ )
+#define CRC64_TARGET_PCLMULQDQ	__attribute__(( target( "sse2,pclmul" ) ))
+#else
+#define CRC64_TARGET_PCLMULQDQ
+#endif
+
+/* Polynomials
+ *
+ * ECMA-182
+ * normal:                0x42f0e1eba9ea3693
+ * reversed:              0xc96c5795d7870f42
+ *
+ * ISO 3309
+ * normal:                0x000000000000001b
+ * reversed:              0xd800000000000000
+ */
+
 /* Table of the CRC-64 of all 8-bit messages.
  * Polynomial: 0x92c64265d32139a4
  */
@@ -167,10 +191,28 @@ uint64_t crc64_table2[ 256 ] = {
 	0x5dedc41a34bbeeb2ULL, 0x1f1d25f19d51d821ULL, 0xd80c07cd676f8394ULL, 0x9afce626ce85b507ULL
 };
 
+/* Tables of the CRC-64 of all 8-bit messages followed by 1 to 7 zero bytes
+ * used by the slicing-by-8 calculation
+ */
+uint64_t crc64_slicing_table[ 8 ][ 256 ];
+
 /* Value to indicate the CRC-64 table been computed
  */
 int crc64_table_computed = 0;
 
+/* The polynomial of the computed CRC-64 table
+ */
+uint64_t crc64_table_polynomial = 0;
+
+/* The bit-reflected folding constants of the polynomial of the computed CRC-64 table
+ * k1 = x^(4*128+64-1) mod P, k2 = x^(4*128-1) mod P, k3 = x^(128+64-1) mod P and k4 = x^(128-1) mod P
+ * The exponents are 1 less to compensate for the bit-reflected product
+ * being shifted by 1 bit
+ */
+uint64_t crc64_fold_by_4_constants[ 2 ];
+
+uint64_t crc64_fold_by_1_constants[ 2 ];
+
 /* Initializes the internal CRC-64 table
  * The table speeds up the CRC-64 calculation
  */
@@ -180,6 +222,7 @@ void initialize_crc64_table(
 	uint64_t crc64             = 0;
 	uint64_t crc64_table_index = 0;
 	uint8_t bit_iterator       = 0;
+	uint8_t slice_index        = 0;
 
 	memory_set(
 	 crc64_table1,
@@ -211,8 +254,39 @@ void initialize_crc64_table(
 			}
 		}
 		crc64_table1[ crc64_table_index ] = crc64;
+
+		crc64_slicing_table[ 0 ][ crc64_table_index ] = crc64;
+	}
+	for( crc64_table_index = 0;
+	     crc64_table_index < 256;
+	     crc64_table_index++ )
+	{
+		crc64 = crc64_table1[ crc64_table_index ];
+
+		for( slice_index = 1;
+		     slice_index < 8;
+		     slice_index++ )
+		{
+			crc64 = crc64_table1[ crc64 & 0x00000000000000ffULL ] ^ ( crc64 >> 8 );
+
+			crc64_slicing_table[ slice_index ][ crc64_table_index ] = crc64;
+		}
 	}
-	crc64_table_computed = 1;
+	crc64_fold_by_4_constants[ 0 ] = crc64_calculate_power_remainder(
+	                                  polynomial,
+	                                  4 * 128 + 64 - 1 );
+	crc64_fold_by_4_constants[ 1 ] = crc64_calculate_power_remainder(
+	                                  polynomial,
+	                                  4 * 128 - 1 );
+	crc64_fold_by_1_constants[ 0 ] = crc64_calculate_power_remainder(
+	                                  polynomial,
+	                                  128 + 64 - 1 );
+	crc64_fold_by_1_constants[ 1 ] = crc64_calculate_power_remainder(
+	                                  polynomial,
+	                                  128 - 1 );
+
+	crc64_table_polynomial = polynomial;
+	crc64_table_computed   = 1;
 
 #ifndef DEBUG_PRINT_TABLE
 	if( libcnotify_verbose != 0 )
@@ -240,13 +314,43 @@ void initialize_crc64_table(
 #endif
 }
 
+/* Calculates the bit-reflected remainder of x^exponent divided by the polynomial
+ * Use the reversed polynomial
+ * Returns the bit-reflected remainder
+ */
+uint64_t crc64_calculate_power_remainder(
+          uint64_t polynomial,
+          uint16_t exponent )
+{
+	uint64_t remainder      = 0x8000000000000000ULL;
+	uint16_t exponent_index = 0;
+
+	/* Multiplying by x shifts the bit-reflected value 1 bit to the right,
+	 * where x^64 is replaced by the remainder of the polynomial
+	 */
+	for( exponent_index = 0;
+	     exponent_index < exponent;
+	     exponent_index++ )
+	{
+		if( ( remainder & 0x0000000000000001ULL ) != 0 )
+		{
+			remainder = polynomial ^ ( remainder >> 1 );
+		}
+		else
+		{
+			remainder >>= 1;
+		}
+	}
+	return( remainder );
+}
+
 /* Calculates the CRC-64 of a buffer
  * Use a previous key of 0 to calculate a new CRC-64
  * Returns 1 if successful or -1 on error
  */
 int crc64_calculate_1(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error )
@@ -317,7 +421,7 @@ int crc64_calculate_1(
  */
 int crc64_calculate_2(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error )
@@ -406,3 +510,466 @@ int crc64_calculate_2(
 	return( 1 );
 }
 
+/* Calculates the CRC-64 of a buffer
+ * Uses 8 lookup tables to process 8 bytes per iteration
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int crc64_calculate_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "crc64_calculate_slicing_by_8";
+	size_t buffer_offset  = 0;
+	uint64_t value_64bit  = 0;
+	uint64_t safe_crc64   = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use the same polynomial as crc64_calculate_2
+	 */
+	if( crc64_table_computed == 0 )
+	{
+		initialize_crc64_table(
+		 0x9a6c9329ac4bc9b5ULL );
+	}
+#ifdef WITH_XOR
+	safe_crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
+#else
+	safe_crc64 = initial_value;
+#endif
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		safe_crc64 ^= value_64bit;
+
+		safe_crc64 = crc64_slicing_table[ 7 ][ safe_crc64 & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 6 ][ ( safe_crc64 >> 8 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 5 ][ ( safe_crc64 >> 16 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 4 ][ ( safe_crc64 >> 24 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 3 ][ ( safe_crc64 >> 32 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 2 ][ ( safe_crc64 >> 40 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 1 ][ ( safe_crc64 >> 48 ) & 0x00000000000000ffULL ]
+		           ^ crc64_slicing_table[ 0 ][ safe_crc64 >> 56 ];
+
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+		safe_crc64 = crc64_table1[ ( safe_crc64 ^ buffer[ buffer_offset ] ) & 0x00000000000000ffULL ] ^ ( safe_crc64 >> 8 );
+
+		buffer_offset++;
+	}
+#ifdef WITH_XOR
+	safe_crc64 ^= (uint64_t) 0xffffffffffffffffULL;
+#endif
+	*crc64 = safe_crc64;
+
+	return( 1 );
+}
+
+/* Calculates the CRC-64 of a buffer
+ * Uses carry-less multiplication (PCLMULQDQ) folding if supported by the CPU,
+ * otherwise falls back to the slicing-by-8 calculation
+ * The folding constants are computed with the table, such that the folding
+ * supports any polynomial, including ECMA-182 and ISO 3309
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int crc64_calculate_folding(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "crc64_calculate_folding";
+	size_t buffer_offset  = 0;
+	uint64_t safe_crc64   = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use the same polynomial as crc64_calculate_2
+	 */
+	if( crc64_table_computed == 0 )
+	{
+		initialize_crc64_table(
+		 0x9a6c9329ac4bc9b5ULL );
+	}
+#ifdef WITH_XOR
+	safe_crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
+#else
+	safe_crc64 = initial_value;
+#endif
+#if defined( CRC64_HAVE_PCLMULQDQ )
+	if( ( size >= 64 )
+	 && ( cpu_features_has_support( CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc64 = crc64_fold_pclmulqdq(
+		              safe_crc64,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		safe_crc64 = crc64_table1[ ( safe_crc64 ^ buffer[ buffer_offset ] ) & 0x00000000000000ffULL ] ^ ( safe_crc64 >> 8 );
+
+		buffer_offset++;
+	}
+#ifdef WITH_XOR
+	safe_crc64 ^= (uint64_t) 0xffffffffffffffffULL;
+#endif
+	*crc64 = safe_crc64;
+
+	return( 1 );
+}
+
+#if defined( CRC64_HAVE_PCLMULQDQ )
+
+/* Folds a buffer into an intermediate CRC-64 using carry-less multiplication
+ * Based on "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * by Intel, the folded 128-bit value is reduced with the lookup table
+ * The size must be a multiple of 16 and at least 64
+ * Returns the intermediate CRC-64
+ */
+CRC64_TARGET_PCLMULQDQ
+uint64_t crc64_fold_pclmulqdq(
+          uint64_t crc64,
+          const uint8_t *buffer,
+          size_t size )
+{
+	uint8_t fold_data[ 16 ];
+
+	__m128i constants  = _mm_setzero_si128();
+	__m128i fold1      = _mm_setzero_si128();
+	__m128i fold2      = _mm_setzero_si128();
+	__m128i fold3      = _mm_setzero_si128();
+	__m128i fold4      = _mm_setzero_si128();
+	__m128i product1   = _mm_setzero_si128();
+	__m128i product2   = _mm_setzero_si128();
+	__m128i product3   = _mm_setzero_si128();
+	__m128i product4   = _mm_setzero_si128();
+	__m128i value      = _mm_setzero_si128();
+	uint8_t data_index = 0;
+
+	fold1 = _mm_loadu_si128(
+	         (const __m128i *) buffer );
+	fold2 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 16 ] ) );
+	fold3 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 32 ] ) );
+	fold4 = _mm_loadu_si128(
+	         (const __m128i *) &( buffer[ 48 ] ) );
+
+	/* The intermediate CRC-64 is added to the first 64-bit of the data
+	 */
+	fold1 = _mm_xor_si128(
+	         fold1,
+	         _mm_cvtsi64_si128( (long long) crc64 ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	/* Fold 4 x 128-bit in parallel
+	 */
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc64_fold_by_4_constants );
+
+	while( size >= 64 )
+	{
+		product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+		product2 = _mm_clmulepi64_si128( fold2, constants, 0x00 );
+		product3 = _mm_clmulepi64_si128( fold3, constants, 0x00 );
+		product4 = _mm_clmulepi64_si128( fold4, constants, 0x00 );
+
+		fold1 = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+		fold2 = _mm_clmulepi64_si128( fold2, constants, 0x11 );
+		fold3 = _mm_clmulepi64_si128( fold3, constants, 0x11 );
+		fold4 = _mm_clmulepi64_si128( fold4, constants, 0x11 );
+
+		fold1 = _mm_xor_si128( fold1, product1 );
+		fold2 = _mm_xor_si128( fold2, product2 );
+		fold3 = _mm_xor_si128( fold3, product3 );
+		fold4 = _mm_xor_si128( fold4, product4 );
+
+		fold1 = _mm_xor_si128( fold1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		fold2 = _mm_xor_si128( fold2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		fold3 = _mm_xor_si128( fold3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		fold4 = _mm_xor_si128( fold4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants = _mm_loadu_si128(
+	             (const __m128i *) crc64_fold_by_1_constants );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold2 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold3 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+	fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+	fold1    = _mm_xor_si128( fold1, fold4 );
+	fold1    = _mm_xor_si128( fold1, product1 );
+
+	/* Fold the remaining 128-bit blocks
+	 */
+	while( size >= 16 )
+	{
+		value = _mm_loadu_si128(
+		         (const __m128i *) buffer );
+
+		product1 = _mm_clmulepi64_si128( fold1, constants, 0x00 );
+		fold1    = _mm_clmulepi64_si128( fold1, constants, 0x11 );
+		fold1    = _mm_xor_si128( fold1, value );
+		fold1    = _mm_xor_si128( fold1, product1 );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* The CRC-64 of the folded 128-bit value, calculated from an intermediate
+	 * value of 0, is the CRC-64 of the buffer
+	 */
+	_mm_storeu_si128(
+	 (__m128i *) fold_data,
+	 fold1 );
+
+	crc64 = 0;
+
+	for( data_index = 0;
+	     data_index < 16;
+	     data_index++ )
+	{
+		crc64 = crc64_table1[ ( crc64 ^ fold_data[ data_index ] ) & 0x00000000000000ffULL ] ^ ( crc64 >> 8 );
+	}
+	return( crc64 );
+}
+
+#endif /* defined( CRC64_HAVE_PCLMULQDQ ) */
+
+/* Multiplies a vector by a 64 x 64 GF(2) matrix
+ * Returns the resulting vector
+ */
+uint64_t crc64_gf2_matrix_multiply(
+          const uint64_t *matrix,
+          uint64_t vector )
+{
+	uint64_t result_vector = 0;
+	uint8_t row_index      = 0;
+
+	while( vector != 0 )
+	{
+		if( ( vector & 0x0000000000000001ULL ) != 0 )
+		{
+			result_vector ^= matrix[ row_index ];
+		}
+		vector >>= 1;
+
+		row_index++;
+	}
+	return( result_vector );
+}
+
+/* Squares a 64 x 64 GF(2) matrix
+ */
+void crc64_gf2_matrix_square(
+      uint64_t *square_matrix,
+      const uint64_t *matrix )
+{
+	uint8_t row_index = 0;
+
+	for( row_index = 0;
+	     row_index < 64;
+	     row_index++ )
+	{
+		square_matrix[ row_index ] = crc64_gf2_matrix_multiply(
+		                              matrix,
+		                              matrix[ row_index ] );
+	}
+}
+
+/* Combines the CRC-64 of two consecutive buffers into the CRC-64 of both buffers
+ * The second CRC-64 must be calculated with an initial value of 0 and the same
+ * (reversed) polynomial as the first CRC-64, both bit-reflected such as
+ * calculated by crc64_calculate_2
+ * The first CRC-64 is shifted over the size of the second buffer by
+ * multiplying it with a GF(2) matrix that represents a shift of 1 zero bit,
+ * which is squared for every bit of the size
+ * Returns 1 if successful or -1 on error
+ */
+int crc64_combine_checksums(
+     uint64_t *crc64,
+     uint64_t first_crc64,
+     uint64_t second_crc64,
+     size64_t second_size,
+     uint64_t polynomial,
+     libcerror_error_t **error )
+{
+	uint64_t even_matrix[ 64 ];
+	uint64_t odd_matrix[ 64 ];
+
+	static char *function = "crc64_combine_checksums";
+	uint64_t row_value    = 0;
+	uint8_t row_index     = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_size == 0 )
+	{
+		*crc64 = first_crc64;
+
+		return( 1 );
+	}
+	/* The matrix that represents a shift of 1 zero bit
+	 */
+	odd_matrix[ 0 ] = polynomial;
+
+	row_value = 1;
+
+	for( row_index = 1;
+	     row_index < 64;
+	     row_index++ )
+	{
+		odd_matrix[ row_index ] = row_value;
+
+		row_value <<= 1;
+	}
+	/* The matrix that represents a shift of 2 zero bits
+	 */
+	crc64_gf2_matrix_square(
+	 even_matrix,
+	 odd_matrix );
+
+	/* The matrix that represents a shift of 4 zero bits
+	 */
+	crc64_gf2_matrix_square(
+	 odd_matrix,
+	 even_matrix );
+
+	/* Shift the first CRC-64 by the size of the second buffer in bytes
+	 * where the first squaring results in a shift of 1 zero byte
+	 */
+	do
+	{
+		crc64_gf2_matrix_square(
+		 even_matrix,
+		 odd_matrix );
+
+		if( ( second_size & 1 ) != 0 )
+		{
+			first_crc64 = crc64_gf2_matrix_multiply(
+			               even_matrix,
+			               first_crc64 );
+		}
+		second_size >>= 1;
+
+		if( second_size == 0 )
+		{
+			break;
+		}
+		crc64_gf2_matrix_square(
+		 odd_matrix,
+		 even_matrix );
+
+		if( ( second_size & 1 ) != 0 )
+		{
+			first_crc64 = crc64_gf2_matrix_multiply(
+			               odd_matrix,
+			               first_crc64 );
+		}
+		second_size >>= 1;
+	}
+	while( second_size != 0 );
+
+	*crc64 = first_crc64 ^ second_crc64;
+
+	return( 1 );
+}
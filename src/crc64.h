@@ -31,23 +31,73 @@
 extern "C" {
 #endif
 
+/* The carry-less multiplication (PCLMULQDQ) folding engine is only
+ * available on x86-64, support by the CPU is determined at run-time
+ */
+#if ( defined( __GNUC__ ) && defined( __x86_64__ ) ) || ( defined( _MSC_VER ) && defined( _M_X64 ) )
+#define CRC64_HAVE_PCLMULQDQ
+#endif
+
 void initialize_crc64_table(
       uint64_t polynomial );
 
+uint64_t crc64_calculate_power_remainder(
+          uint64_t polynomial,
+          uint16_t exponent );
+
 int crc64_calculate_1(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error );
 
 int crc64_calculate_2(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int crc64_calculate_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int crc64_calculate_folding(
+     uint64_t *crc64,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error );
 
+#if defined( CRC64_HAVE_PCLMULQDQ )
+
+uint64_t crc64_fold_pclmulqdq(
+          uint64_t crc64,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( CRC64_HAVE_PCLMULQDQ ) */
+
+uint64_t crc64_gf2_matrix_multiply(
+          const uint64_t *matrix,
+          uint64_t vector );
+
+void crc64_gf2_matrix_square(
+      uint64_t *square_matrix,
+      const uint64_t *matrix );
+
+int crc64_combine_checksums(
+     uint64_t *crc64,
+     uint64_t first_crc64,
+     uint64_t second_crc64,
+     size64_t second_size,
+     uint64_t polynomial,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
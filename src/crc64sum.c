@@ -34,6 +34,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "block_reader.h"
 #include "crc64.h"
 
 /* Prints the executable usage information
@@ -45,19 +46,29 @@ void usage_fprint(
 	{
 		return;
 	}
-/* TODO add [ -p polynomial ] support */
 	fprintf( stream, "Use crc64sum to calculate a CRC-64 of file data.\n\n" );
 
-	fprintf( stream, "Usage: crc64sum [ -i initial_value ] [ -o offset ]\n"
-	                 "                [ -s size ] [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: crc64sum [ -b block_size ] [ -i initial_value ] [ -o offset ]\n"
+	                 "                [ -p polynomial ] [ -s size ] [ -1234hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the table lookup calculation method (default)\n" );
-	fprintf( stream, "\t-2:     method 2\n" );
+	fprintf( stream, "\t-2:     use the bit-reflected table lookup calculation method\n" );
+	fprintf( stream, "\t-3:     use the bit-reflected slicing-by-8 table lookup calculation\n"
+	                 "\t        method\n" );
+	fprintf( stream, "\t-4:     use the bit-reflected carry-less multiplication folding\n"
+	                 "\t        calculation method if supported by the CPU, otherwise\n"
+	                 "\t        falls back to -3\n" );
+	fprintf( stream, "\t-b:     block size of the data read at once, must be a multiple\n"
+	                 "\t        of 512 and at most 1073741824 (default is 4194304)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial CRC-64 (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     reversed polynomial of the bit-reflected calculation\n"
+	                 "\t        methods (default is 0x9a6c9329ac4bc9b5), such as\n"
+	                 "\t        0xc96c5795d7870f42 for ECMA-182 or 0xd800000000000000\n"
+	                 "\t        for ISO 3309\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
@@ -75,14 +86,17 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error     = NULL;
 	libcfile_file_t *source_file = NULL;
 	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
+	block_reader_t *block_reader = NULL;
+	uint8_t *block_data          = NULL;
 	char *program                = "crc64sum";
 	system_integer_t option      = 0;
+	size_t block_data_size       = 0;
+	size_t block_size            = BLOCK_READER_DEFAULT_BLOCK_SIZE;
 	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
 	off_t source_offset          = 0;
 	uint64_t calculated_crc64    = 0;
 	uint64_t initial_value       = 0;
+	uint64_t polynomial          = 0x9a6c9329ac4bc9b5ULL;
 	int calculation_method       = 1;
 	int result                   = 0;
 	int verbose                  = 0;
@@ -94,7 +108,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "1234b:hi:o:p:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -120,6 +134,24 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case '4':
+				calculation_method = 4;
+
+				break;
+
+			case 'b':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				block_size = (size_t) _wtol( optarg );
+#else
+				block_size = (size_t) atol( optarg );
+#endif
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -142,6 +174,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 'p':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				polynomial = (uint64_t) _wcstoui64( optarg, NULL, 0 );
+#else
+				polynomial = (uint64_t) strtoull( optarg, NULL, 0 );
+#endif
+				break;
+
 			case 's':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_size = _wtol( optarg );
@@ -236,22 +276,14 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
+	if( block_reader_initialize(
+	     &block_reader,
+	     block_size,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Unable to create block reader.\n" );
 
 		goto on_error;
 	}
@@ -269,13 +301,87 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( block_reader_open(
+	     block_reader,
+	     source_file,
+	     source_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open block reader.\n" );
+
+		goto on_error;
+	}
+	if( calculation_method != 1 )
+	{
+		initialize_crc64_table(
+		 polynomial );
+	}
+	calculated_crc64 = initial_value;
+
+	/* Calculate the checksum block by block, using the checksum
+	 * of the previous blocks as the initial value
+	 */
+	while( ( result = block_reader_get_next_block(
+	                   block_reader,
+	                   &block_data,
+	                   &block_data_size,
+	                   &error ) ) == 1 )
+	{
+		if( calculation_method == 1 )
+		{
+			result = crc64_calculate_1(
+				  &calculated_crc64,
+				  block_data,
+				  block_data_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 2 )
+		{
+			result = crc64_calculate_2(
+				  &calculated_crc64,
+				  block_data,
+				  block_data_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 3 )
+		{
+			result = crc64_calculate_slicing_by_8(
+				  &calculated_crc64,
+				  block_data,
+				  block_data_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 4 )
+		{
+			result = crc64_calculate_folding(
+				  &calculated_crc64,
+				  block_data,
+				  block_data_size,
+				  calculated_crc64,
+				  &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC-64.\n" );
 
-	if( read_count != (ssize_t) source_size )
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 block_data,
+			 block_data_size,
+			 0 );
+		}
+	}
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
@@ -283,6 +389,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( block_reader_free(
+	     &block_reader,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free block reader.\n" );
+
+		goto on_error;
+	}
 	/* Clean up
 	 */
 	if( libcfile_file_close(
@@ -305,48 +421,12 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = crc64_calculate_1(
-			  &calculated_crc64,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  &error );
-	}
-	else if( calculation_method == 2 )
-	{
-		result = crc64_calculate_2(
-			  &calculated_crc64,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  &error );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate CRC-64.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
 	fprintf(
 	 stdout,
 	 "Calculated CRC-64: %" PRIu64 " (0x%08" PRIx64 ")\n",
 	 calculated_crc64,
 	 calculated_crc64 );
 
-	memory_free(
-	 buffer );
-
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -357,10 +437,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	if( block_reader != NULL )
 	{
-		memory_free(
-		 buffer );
+		block_reader_free(
+		 &block_reader,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
@@ -27,34 +27,228 @@
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
 #include "bit_stream.h"
+#include "checksum.h"
 #include "deflate.h"
 #include "huffman_tree.h"
+#include "match_copy.h"
+#include "match_finder.h"
+
+/* The Huffman decoding loop is inlined into the regular and verbose
+ * decoders, so that the regular decoder does not check the verbose flag
+ */
+#if defined( __GNUC__ )
+#define DEFLATE_FORCE_INLINE	inline __attribute__(( always_inline ))
+#elif defined( _MSC_VER )
+#define DEFLATE_FORCE_INLINE	__forceinline
+#else
+#define DEFLATE_FORCE_INLINE	inline
+#endif
+
+const uint8_t deflate_code_sizes_sequence[ 19 ] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
+	14, 1, 15 };
+
+const uint16_t deflate_literal_codes_base[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+const uint16_t deflate_literal_codes_number_of_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+const uint16_t deflate_distance_codes_base[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193,
+	12289, 16385, 24577 };
+
+const uint16_t deflate_distance_codes_number_of_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* The compression level configurations, which consist of:
+ * the good match size, the maximum lazy match size, the nice match size and the maximum chain length
+ * levels 1 to 3 use greedy matching where the maximum lazy match size is the maximum size of a match
+ * for which the positions are added to the hash chains
+ */
+const uint16_t deflate_compression_level_configurations[ 10 ][ 4 ] = {
+	{ 0, 0, 0, 0 },
+	{ 4, 4, 8, 4 },
+	{ 4, 5, 16, 8 },
+	{ 4, 6, 32, 32 },
+	{ 4, 4, 16, 16 },
+	{ 8, 16, 32, 32 },
+	{ 8, 16, 128, 128 },
+	{ 8, 32, 128, 256 },
+	{ 32, 128, 258, 1024 },
+	{ 32, 258, 258, 4096 } };
+
+/* The fixed Huffman trees, which are read-only and shared by all decompression calls
+ * The values are those produced by deflate_build_fixed_huffman_trees, where the literals
+ * and distances trees are initialized with 288 and 30 symbols and a maximum code size of 15
+ */
+const int deflate_fixed_literals_huffman_tree_symbols[ 288 ] = {
+	256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+	272, 273, 274, 275, 276, 277, 278, 279, 0, 1, 2, 3, 4, 5, 6, 7,
+	8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+	40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+	56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+	72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+	88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+	104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+	120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+	136, 137, 138, 139, 140, 141, 142, 143, 280, 281, 282, 283, 284, 285, 286, 287,
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+	208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+	224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255 };
+
+const int deflate_fixed_literals_huffman_tree_code_size_counts[ 16 ] = {
+	0, 0, 0, 0, 0, 0, 0, 24, 152, 112, 0, 0, 0, 0, 0, 0 };
+
+const uint32_t deflate_fixed_literals_huffman_tree_lookup_table[ 512 ] = {
+	0x00070100UL, 0x00080050UL, 0x00080010UL, 0x00080118UL, 0x00070110UL, 0x00080070UL,
+	0x00080030UL, 0x000900c0UL, 0x00070108UL, 0x00080060UL, 0x00080020UL, 0x000900a0UL,
+	0x00080000UL, 0x00080080UL, 0x00080040UL, 0x000900e0UL, 0x00070104UL, 0x00080058UL,
+	0x00080018UL, 0x00090090UL, 0x00070114UL, 0x00080078UL, 0x00080038UL, 0x000900d0UL,
+	0x0007010cUL, 0x00080068UL, 0x00080028UL, 0x000900b0UL, 0x00080008UL, 0x00080088UL,
+	0x00080048UL, 0x000900f0UL, 0x00070102UL, 0x00080054UL, 0x00080014UL, 0x0008011cUL,
+	0x00070112UL, 0x00080074UL, 0x00080034UL, 0x000900c8UL, 0x0007010aUL, 0x00080064UL,
+	0x00080024UL, 0x000900a8UL, 0x00080004UL, 0x00080084UL, 0x00080044UL, 0x000900e8UL,
+	0x00070106UL, 0x0008005cUL, 0x0008001cUL, 0x00090098UL, 0x00070116UL, 0x0008007cUL,
+	0x0008003cUL, 0x000900d8UL, 0x0007010eUL, 0x0008006cUL, 0x0008002cUL, 0x000900b8UL,
+	0x0008000cUL, 0x0008008cUL, 0x0008004cUL, 0x000900f8UL, 0x00070101UL, 0x00080052UL,
+	0x00080012UL, 0x0008011aUL, 0x00070111UL, 0x00080072UL, 0x00080032UL, 0x000900c4UL,
+	0x00070109UL, 0x00080062UL, 0x00080022UL, 0x000900a4UL, 0x00080002UL, 0x00080082UL,
+	0x00080042UL, 0x000900e4UL, 0x00070105UL, 0x0008005aUL, 0x0008001aUL, 0x00090094UL,
+	0x00070115UL, 0x0008007aUL, 0x0008003aUL, 0x000900d4UL, 0x0007010dUL, 0x0008006aUL,
+	0x0008002aUL, 0x000900b4UL, 0x0008000aUL, 0x0008008aUL, 0x0008004aUL, 0x000900f4UL,
+	0x00070103UL, 0x00080056UL, 0x00080016UL, 0x0008011eUL, 0x00070113UL, 0x00080076UL,
+	0x00080036UL, 0x000900ccUL, 0x0007010bUL, 0x00080066UL, 0x00080026UL, 0x000900acUL,
+	0x00080006UL, 0x00080086UL, 0x00080046UL, 0x000900ecUL, 0x00070107UL, 0x0008005eUL,
+	0x0008001eUL, 0x0009009cUL, 0x00070117UL, 0x0008007eUL, 0x0008003eUL, 0x000900dcUL,
+	0x0007010fUL, 0x0008006eUL, 0x0008002eUL, 0x000900bcUL, 0x0008000eUL, 0x0008008eUL,
+	0x0008004eUL, 0x000900fcUL, 0x00070100UL, 0x00080051UL, 0x00080011UL, 0x00080119UL,
+	0x00070110UL, 0x00080071UL, 0x00080031UL, 0x000900c2UL, 0x00070108UL, 0x00080061UL,
+	0x00080021UL, 0x000900a2UL, 0x00080001UL, 0x00080081UL, 0x00080041UL, 0x000900e2UL,
+	0x00070104UL, 0x00080059UL, 0x00080019UL, 0x00090092UL, 0x00070114UL, 0x00080079UL,
+	0x00080039UL, 0x000900d2UL, 0x0007010cUL, 0x00080069UL, 0x00080029UL, 0x000900b2UL,
+	0x00080009UL, 0x00080089UL, 0x00080049UL, 0x000900f2UL, 0x00070102UL, 0x00080055UL,
+	0x00080015UL, 0x0008011dUL, 0x00070112UL, 0x00080075UL, 0x00080035UL, 0x000900caUL,
+	0x0007010aUL, 0x00080065UL, 0x00080025UL, 0x000900aaUL, 0x00080005UL, 0x00080085UL,
+	0x00080045UL, 0x000900eaUL, 0x00070106UL, 0x0008005dUL, 0x0008001dUL, 0x0009009aUL,
+	0x00070116UL, 0x0008007dUL, 0x0008003dUL, 0x000900daUL, 0x0007010eUL, 0x0008006dUL,
+	0x0008002dUL, 0x000900baUL, 0x0008000dUL, 0x0008008dUL, 0x0008004dUL, 0x000900faUL,
+	0x00070101UL, 0x00080053UL, 0x00080013UL, 0x0008011bUL, 0x00070111UL, 0x00080073UL,
+	0x00080033UL, 0x000900c6UL, 0x00070109UL, 0x00080063UL, 0x00080023UL, 0x000900a6UL,
+	0x00080003UL, 0x00080083UL, 0x00080043UL, 0x000900e6UL, 0x00070105UL, 0x0008005bUL,
+	0x0008001bUL, 0x00090096UL, 0x00070115UL, 0x0008007bUL, 0x0008003bUL, 0x000900d6UL,
+	0x0007010dUL, 0x0008006bUL, 0x0008002bUL, 0x000900b6UL, 0x0008000bUL, 0x0008008bUL,
+	0x0008004bUL, 0x000900f6UL, 0x00070103UL, 0x00080057UL, 0x00080017UL, 0x0008011fUL,
+	0x00070113UL, 0x00080077UL, 0x00080037UL, 0x000900ceUL, 0x0007010bUL, 0x00080067UL,
+	0x00080027UL, 0x000900aeUL, 0x00080007UL, 0x00080087UL, 0x00080047UL, 0x000900eeUL,
+	0x00070107UL, 0x0008005fUL, 0x0008001fUL, 0x0009009eUL, 0x00070117UL, 0x0008007fUL,
+	0x0008003fUL, 0x000900deUL, 0x0007010fUL, 0x0008006fUL, 0x0008002fUL, 0x000900beUL,
+	0x0008000fUL, 0x0008008fUL, 0x0008004fUL, 0x000900feUL, 0x00070100UL, 0x00080050UL,
+	0x00080010UL, 0x00080118UL, 0x00070110UL, 0x00080070UL, 0x00080030UL, 0x000900c1UL,
+	0x00070108UL, 0x00080060UL, 0x00080020UL, 0x000900a1UL, 0x00080000UL, 0x00080080UL,
+	0x00080040UL, 0x000900e1UL, 0x00070104UL, 0x00080058UL, 0x00080018UL, 0x00090091UL,
+	0x00070114UL, 0x00080078UL, 0x00080038UL, 0x000900d1UL, 0x0007010cUL, 0x00080068UL,
+	0x00080028UL, 0x000900b1UL, 0x00080008UL, 0x00080088UL, 0x00080048UL, 0x000900f1UL,
+	0x00070102UL, 0x00080054UL, 0x00080014UL, 0x0008011cUL, 0x00070112UL, 0x00080074UL,
+	0x00080034UL, 0x000900c9UL, 0x0007010aUL, 0x00080064UL, 0x00080024UL, 0x000900a9UL,
+	0x00080004UL, 0x00080084UL, 0x00080044UL, 0x000900e9UL, 0x00070106UL, 0x0008005cUL,
+	0x0008001cUL, 0x00090099UL, 0x00070116UL, 0x0008007cUL, 0x0008003cUL, 0x000900d9UL,
+	0x0007010eUL, 0x0008006cUL, 0x0008002cUL, 0x000900b9UL, 0x0008000cUL, 0x0008008cUL,
+	0x0008004cUL, 0x000900f9UL, 0x00070101UL, 0x00080052UL, 0x00080012UL, 0x0008011aUL,
+	0x00070111UL, 0x00080072UL, 0x00080032UL, 0x000900c5UL, 0x00070109UL, 0x00080062UL,
+	0x00080022UL, 0x000900a5UL, 0x00080002UL, 0x00080082UL, 0x00080042UL, 0x000900e5UL,
+	0x00070105UL, 0x0008005aUL, 0x0008001aUL, 0x00090095UL, 0x00070115UL, 0x0008007aUL,
+	0x0008003aUL, 0x000900d5UL, 0x0007010dUL, 0x0008006aUL, 0x0008002aUL, 0x000900b5UL,
+	0x0008000aUL, 0x0008008aUL, 0x0008004aUL, 0x000900f5UL, 0x00070103UL, 0x00080056UL,
+	0x00080016UL, 0x0008011eUL, 0x00070113UL, 0x00080076UL, 0x00080036UL, 0x000900cdUL,
+	0x0007010bUL, 0x00080066UL, 0x00080026UL, 0x000900adUL, 0x00080006UL, 0x00080086UL,
+	0x00080046UL, 0x000900edUL, 0x00070107UL, 0x0008005eUL, 0x0008001eUL, 0x0009009dUL,
+	0x00070117UL, 0x0008007eUL, 0x0008003eUL, 0x000900ddUL, 0x0007010fUL, 0x0008006eUL,
+	0x0008002eUL, 0x000900bdUL, 0x0008000eUL, 0x0008008eUL, 0x0008004eUL, 0x000900fdUL,
+	0x00070100UL, 0x00080051UL, 0x00080011UL, 0x00080119UL, 0x00070110UL, 0x00080071UL,
+	0x00080031UL, 0x000900c3UL, 0x00070108UL, 0x00080061UL, 0x00080021UL, 0x000900a3UL,
+	0x00080001UL, 0x00080081UL, 0x00080041UL, 0x000900e3UL, 0x00070104UL, 0x00080059UL,
+	0x00080019UL, 0x00090093UL, 0x00070114UL, 0x00080079UL, 0x00080039UL, 0x000900d3UL,
+	0x0007010cUL, 0x00080069UL, 0x00080029UL, 0x000900b3UL, 0x00080009UL, 0x00080089UL,
+	0x00080049UL, 0x000900f3UL, 0x00070102UL, 0x00080055UL, 0x00080015UL, 0x0008011dUL,
+	0x00070112UL, 0x00080075UL, 0x00080035UL, 0x000900cbUL, 0x0007010aUL, 0x00080065UL,
+	0x00080025UL, 0x000900abUL, 0x00080005UL, 0x00080085UL, 0x00080045UL, 0x000900ebUL,
+	0x00070106UL, 0x0008005dUL, 0x0008001dUL, 0x0009009bUL, 0x00070116UL, 0x0008007dUL,
+	0x0008003dUL, 0x000900dbUL, 0x0007010eUL, 0x0008006dUL, 0x0008002dUL, 0x000900bbUL,
+	0x0008000dUL, 0x0008008dUL, 0x0008004dUL, 0x000900fbUL, 0x00070101UL, 0x00080053UL,
+	0x00080013UL, 0x0008011bUL, 0x00070111UL, 0x00080073UL, 0x00080033UL, 0x000900c7UL,
+	0x00070109UL, 0x00080063UL, 0x00080023UL, 0x000900a7UL, 0x00080003UL, 0x00080083UL,
+	0x00080043UL, 0x000900e7UL, 0x00070105UL, 0x0008005bUL, 0x0008001bUL, 0x00090097UL,
+	0x00070115UL, 0x0008007bUL, 0x0008003bUL, 0x000900d7UL, 0x0007010dUL, 0x0008006bUL,
+	0x0008002bUL, 0x000900b7UL, 0x0008000bUL, 0x0008008bUL, 0x0008004bUL, 0x000900f7UL,
+	0x00070103UL, 0x00080057UL, 0x00080017UL, 0x0008011fUL, 0x00070113UL, 0x00080077UL,
+	0x00080037UL, 0x000900cfUL, 0x0007010bUL, 0x00080067UL, 0x00080027UL, 0x000900afUL,
+	0x00080007UL, 0x00080087UL, 0x00080047UL, 0x000900efUL, 0x00070107UL, 0x0008005fUL,
+	0x0008001fUL, 0x0009009fUL, 0x00070117UL, 0x0008007fUL, 0x0008003fUL, 0x000900dfUL,
+	0x0007010fUL, 0x0008006fUL, 0x0008002fUL, 0x000900bfUL, 0x0008000fUL, 0x0008008fUL,
+	0x0008004fUL, 0x000900ffUL };
+
+const int deflate_fixed_distances_huffman_tree_symbols[ 30 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
+
+const int deflate_fixed_distances_huffman_tree_code_size_counts[ 16 ] = {
+	0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+const uint32_t deflate_fixed_distances_huffman_tree_lookup_table[ 32 ] = {
+	0x00050000UL, 0x00050010UL, 0x00050008UL, 0x00050018UL, 0x00050004UL, 0x00050014UL,
+	0x0005000cUL, 0x0005001cUL, 0x00050002UL, 0x00050012UL, 0x0005000aUL, 0x0005001aUL,
+	0x00050006UL, 0x00050016UL, 0x0005000eUL, 0x00000000UL, 0x00050001UL, 0x00050011UL,
+	0x00050009UL, 0x00050019UL, 0x00050005UL, 0x00050015UL, 0x0005000dUL, 0x0005001dUL,
+	0x00050003UL, 0x00050013UL, 0x0005000bUL, 0x0005001bUL, 0x00050007UL, 0x00050017UL,
+	0x0005000fUL, 0x00000000UL };
+
+const huffman_tree_t deflate_fixed_literals_huffman_tree = {
+	15,
+	(int *) deflate_fixed_literals_huffman_tree_symbols,
+	(int *) deflate_fixed_literals_huffman_tree_code_size_counts,
+	(uint32_t *) deflate_fixed_literals_huffman_tree_lookup_table,
+	512,
+	9 };
+
+const huffman_tree_t deflate_fixed_distances_huffman_tree = {
+	15,
+	(int *) deflate_fixed_distances_huffman_tree_symbols,
+	(int *) deflate_fixed_distances_huffman_tree_code_size_counts,
+	(uint32_t *) deflate_fixed_distances_huffman_tree_lookup_table,
+	32,
+	5 };
 
 /* Reads and builds the dynamic Huffman trees
  * Returns 1 on success or -1 on error
  */
 int deflate_build_dynamic_huffman_trees(
      bit_stream_t *bit_stream,
+     huffman_tree_t *pre_codes_huffman_tree,
      huffman_tree_t *literals_huffman_tree,
      huffman_tree_t *distances_huffman_tree,
      libcerror_error_t **error )
 {
 	uint8_t code_size_array[ 316 ];
 
-	uint8_t code_sizes_sequence[ 19 ] = {
-		16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
-	        14, 1, 15 };
-
-	huffman_tree_t *pre_codes_huffman_tree = NULL;
-	static char *function                  = "deflate_build_dynamic_huffman_trees";
-	uint32_t code_size                     = 0;
-	uint32_t code_size_index               = 0;
-	uint32_t code_size_sequence            = 0;
-	uint32_t number_of_code_sizes          = 0;
-	uint32_t number_of_distance_codes      = 0;
-	uint32_t number_of_literal_codes       = 0;
-	uint32_t symbol                        = 0;
-	uint32_t times_to_repeat               = 0;
+	static char *function             = "deflate_build_dynamic_huffman_trees";
+	uint32_t code_size                = 0;
+	uint32_t code_size_index          = 0;
+	uint32_t code_size_sequence       = 0;
+	uint32_t number_of_code_sizes     = 0;
+	uint32_t number_of_distance_codes = 0;
+	uint32_t number_of_literal_codes  = 0;
+	uint32_t symbol                   = 0;
+	uint32_t times_to_repeat          = 0;
 
 	if( bit_stream_get_value(
 	     bit_stream,
@@ -69,7 +263,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: unable to retrieve value from bit stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_literal_codes  = number_of_code_sizes & 0x0000001fUL;
 	number_of_code_sizes   >>= 5;
@@ -107,7 +301,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of literal codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_distance_codes += 1;
 
@@ -120,7 +314,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: invalid number of distance codes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_code_sizes += 4;
 
@@ -141,9 +335,9 @@ int deflate_build_dynamic_huffman_trees(
 			 "%s: unable to retrieve value from bit stream.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		code_size_sequence = code_sizes_sequence[ code_size_index ];
+		code_size_sequence = deflate_code_sizes_sequence[ code_size_index ];
 
 		code_size_array[ code_size_sequence ] = (uint8_t) code_size;
 
@@ -158,7 +352,7 @@ int deflate_build_dynamic_huffman_trees(
 	}
 	while( code_size_index < 19 )
 	{
-		code_size_sequence = code_sizes_sequence[ code_size_index++ ];
+		code_size_sequence = deflate_code_sizes_sequence[ code_size_index++ ];
 
 		code_size_array[ code_size_sequence ] = 0;
 
@@ -175,21 +369,6 @@ int deflate_build_dynamic_huffman_trees(
 		libcnotify_printf(
 		 "\n" );
 	}
-	if( huffman_tree_initialize(
-	     &pre_codes_huffman_tree,
-	     19,
-	     15,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pre-codes Huffman tree.",
-		 function );
-
-		goto on_error;
-	}
 	if( huffman_tree_build(
 	     pre_codes_huffman_tree,
 	     code_size_array,
@@ -203,7 +382,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build pre-codes Huffman tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
 
@@ -224,7 +403,7 @@ int deflate_build_dynamic_huffman_trees(
 			 "%s: unable to retrieve symbol from pre-codes Huffman tree.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -261,7 +440,7 @@ int deflate_build_dynamic_huffman_trees(
 				 "%s: invalid code size index value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			code_size = (uint32_t) code_size_array[ code_size_index - 1 ];
 
@@ -278,7 +457,7 @@ int deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 3;
 		}
@@ -297,7 +476,7 @@ int deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 3;
 		}
@@ -316,7 +495,7 @@ int deflate_build_dynamic_huffman_trees(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 11;
 		}
@@ -329,7 +508,7 @@ int deflate_build_dynamic_huffman_trees(
 			 "%s: invalid code size symbol value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -347,7 +526,7 @@ int deflate_build_dynamic_huffman_trees(
 			 "%s: invalid times to repeat value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		while( times_to_repeat > 0 )
 		{
@@ -373,20 +552,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: end-of-block code value missing in literal codes array.",
 		 function );
 
-		goto on_error;
-	}
-	if( huffman_tree_free(
-	     &pre_codes_huffman_tree,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pre-codes Huffman tree.",
-		 function );
-
-		goto on_error;
+		return( -1 );
 	}
 	if( huffman_tree_build(
 	     literals_huffman_tree,
@@ -401,7 +567,7 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build literals Huffman tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( huffman_tree_build(
 	     distances_huffman_tree,
@@ -416,18 +582,9 @@ int deflate_build_dynamic_huffman_trees(
 		 "%s: unable to build distances Huffman tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( pre_codes_huffman_tree != NULL )
-	{
-		huffman_tree_free(
-		 &pre_codes_huffman_tree,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Initializes the fixed Huffman trees
@@ -502,35 +659,21 @@ int deflate_build_fixed_huffman_trees(
 }
 
 /* Decodes a Huffman compressed block
+ * The verbose flag is a compile-time constant in both callers, so that
+ * the compiler removes the verbose output from the regular decoding loop
  * Returns 1 on success or -1 on error
  */
-int deflate_decode_huffman(
+static DEFLATE_FORCE_INLINE int deflate_decode_huffman_loop(
      bit_stream_t *bit_stream,
-     huffman_tree_t *literals_huffman_tree,
-     huffman_tree_t *distances_huffman_tree,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
+     const int verbose,
+     const char *function,
      libcerror_error_t **error )
 {
-	uint16_t literal_codes_base[ 29 ] = {
-		3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
-		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
-
-	uint16_t literal_codes_number_of_extra_bits[ 29 ] = {
-		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
-
-	uint16_t distance_codes_base[ 30 ] = {
-		1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
-		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193,
-		12289, 16385, 24577};
-
-	uint16_t distance_codes_number_of_extra_bits[ 30 ] = {
-		0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
-		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
-
-	static char *function         = "deflate_decode_huffman";
 	size_t data_offset            = 0;
 	uint32_t extra_bits           = 0;
 	uint32_t symbol               = 0;
@@ -590,7 +733,7 @@ int deflate_decode_huffman(
 
 			return( -1 );
 		}
-		if( libcnotify_verbose != 0 )
+		if( verbose != 0 )
 		{
 			libcnotify_printf(
 			 "%s: symbol\t\t\t\t\t\t: %" PRIu32 "\n",
@@ -617,36 +760,56 @@ int deflate_decode_huffman(
 		{
 			symbol -= 257;
 
-			number_of_extra_bits = literal_codes_number_of_extra_bits[ symbol ];
+			number_of_extra_bits = deflate_literal_codes_number_of_extra_bits[ symbol ];
 
-			if( bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( bit_stream->bit_buffer_size < number_of_extra_bits )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve literal extra value from bit stream.",
-				 function );
+				if( bit_stream_refill(
+				     bit_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to refill bit buffer.",
+					 function );
 
-				return( -1 );
+					return( -1 );
+				}
+				if( bit_stream->bit_buffer_size < number_of_extra_bits )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve literal extra value from bit stream.",
+					 function );
+
+					return( -1 );
+				}
 			}
-			if( libcnotify_verbose != 0 )
+			extra_bits = bit_stream_back_to_front_peek_value(
+			              bit_stream,
+			              number_of_extra_bits );
+
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 number_of_extra_bits );
+
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: literal code\t\t\t\t\t: %" PRIu16 "\n",
 				 function,
-				 literal_codes_base[ symbol ] );
+				 deflate_literal_codes_base[ symbol ] );
 
 				libcnotify_printf(
-				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx32 "\n",
 				 function,
 				 extra_bits );
 			}
-			compression_size = literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+			compression_size = deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
 
 			if( huffman_tree_get_symbol_from_bit_stream(
 			     distances_huffman_tree,
@@ -663,45 +826,65 @@ int deflate_decode_huffman(
 
 				return( -1 );
 			}
-			if( libcnotify_verbose != 0 )
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: symbol\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 "%s: symbol\t\t\t\t\t\t: %" PRIu32 "\n",
 				 function,
 				 symbol );
 			}
-			number_of_extra_bits = distance_codes_number_of_extra_bits[ symbol ];
+			number_of_extra_bits = deflate_distance_codes_number_of_extra_bits[ symbol ];
 
-			if( bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( bit_stream->bit_buffer_size < number_of_extra_bits )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve distance extra value from bit stream.",
-				 function );
+				if( bit_stream_refill(
+				     bit_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to refill bit buffer.",
+					 function );
 
-				return( -1 );
+					return( -1 );
+				}
+				if( bit_stream->bit_buffer_size < number_of_extra_bits )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve distance extra value from bit stream.",
+					 function );
+
+					return( -1 );
+				}
 			}
-			if( libcnotify_verbose != 0 )
+			extra_bits = bit_stream_back_to_front_peek_value(
+			              bit_stream,
+			              number_of_extra_bits );
+
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 number_of_extra_bits );
+
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: distance code\t\t\t\t\t: %" PRIu16 "\n",
 				 function,
-				 distance_codes_base[ symbol ] );
+				 deflate_distance_codes_base[ symbol ] );
 
 				libcnotify_printf(
-				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx32 "\n",
 				 function,
 				 extra_bits );
 			}
-			compression_offset = distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+			compression_offset = deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
 
-			if( libcnotify_verbose != 0 )
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: uncompressed data offset\t\t\t: %" PRIzd "\n",
@@ -740,13 +923,24 @@ int deflate_decode_huffman(
 
 				return( -1 );
 			}
-			while( compression_size > 0 )
+			if( match_copy(
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     data_offset,
+			     (size_t) compression_offset,
+			     (size_t) compression_size,
+			     error ) != 1 )
 			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
 
-				data_offset++;
-				compression_size--;
+				return( -1 );
 			}
+			data_offset += compression_size;
 		}
 		else if( symbol != 256 )
 		{
@@ -754,7 +948,7 @@ int deflate_decode_huffman(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid symbol: %" PRIu16 ".",
+			 "%s: invalid symbol: %" PRIu32 ".",
 			 function,
 			 symbol );
 
@@ -768,7 +962,74 @@ int deflate_decode_huffman(
 	return( 1 );
 }
 
+/* Decodes a Huffman compressed block
+ * The verbose output is checked once per call, so that the decoding loop
+ * does not need to check it per symbol
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decode_huffman(
+     bit_stream_t *bit_stream,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decode_huffman";
+
+	if( libcnotify_verbose != 0 )
+	{
+		return( deflate_decode_huffman_verbose(
+		         bit_stream,
+		         literals_huffman_tree,
+		         distances_huffman_tree,
+		         uncompressed_data,
+		         uncompressed_data_size,
+		         uncompressed_data_offset,
+		         error ) );
+	}
+	return( deflate_decode_huffman_loop(
+	         bit_stream,
+	         literals_huffman_tree,
+	         distances_huffman_tree,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         uncompressed_data_offset,
+	         0,
+	         function,
+	         error ) );
+}
+
+/* Decodes a Huffman compressed block and prints the decoded symbols
+ * This function is used by deflate_decode_huffman when verbose output is enabled
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decode_huffman_verbose(
+     bit_stream_t *bit_stream,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decode_huffman_verbose";
+
+	return( deflate_decode_huffman_loop(
+	         bit_stream,
+	         literals_huffman_tree,
+	         distances_huffman_tree,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         uncompressed_data_offset,
+	         1,
+	         function,
+	         error ) );
+}
+
 /* Calculates the little-endian Adler-32 of a buffer
+ * Uses the fastest Adler-32 calculation supported by the CPU
  * It uses the initial value to calculate a new Adler-32
  * Returns 1 if successful or -1 on error
  */
@@ -780,243 +1041,1968 @@ int deflate_calculate_adler32(
      libcerror_error_t **error )
 {
 	static char *function = "deflate_calculate_adler32";
-	size_t buffer_offset  = 0;
-	uint32_t lower_word   = 0;
-	uint32_t upper_word   = 0;
-	uint32_t value_32bit  = 0;
-	int block_index       = 0;
 
-	if( checksum_value == NULL )
+	if( checksum_calculate_adler32(
+	     checksum_value,
+	     buffer,
+	     size,
+	     initial_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid checksum value.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate Adler-32.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	return( 1 );
+}
+
+/* Writes a value to the bit writer
+ * The bits are stored back-to-front (least significant bit first)
+ * Returns 1 on success or -1 on error
+ */
+int deflate_bit_writer_write_value(
+     deflate_bit_writer_t *bit_writer,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_bit_writer_write_value";
+
+	if( bit_writer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid bit writer.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( number_of_bits > (uint8_t) 32 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid number of bits value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
+	value_32bit &= (uint32_t) bit_stream_mask_64bit( number_of_bits );
 
-	while( size >= 0x15b0 )
+	bit_writer->bit_buffer      |= (uint64_t) value_32bit << bit_writer->bit_buffer_size;
+	bit_writer->bit_buffer_size += number_of_bits;
+
+	if( bit_writer->bit_buffer_size >= 32 )
 	{
-		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
-		 */
-		for( block_index = 0;
-		     block_index < 347;
-		     block_index++ )
+		if( ( bit_writer->byte_stream_offset > bit_writer->byte_stream_size )
+		 || ( ( bit_writer->byte_stream_size - bit_writer->byte_stream_offset ) < 4 ) )
 		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream value too small.",
+			 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( bit_writer->byte_stream[ bit_writer->byte_stream_offset ] ),
+		 bit_writer->bit_buffer );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		bit_writer->byte_stream_offset += 4;
+		bit_writer->bit_buffer        >>= 32;
+		bit_writer->bit_buffer_size    -= 32;
+	}
+	return( 1 );
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Flushes the bits in the bit writer to the byte stream
+ * The last byte is padded with 0 bits
+ * Returns 1 on success or -1 on error
+ */
+int deflate_bit_writer_flush(
+     deflate_bit_writer_t *bit_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_bit_writer_flush";
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	if( bit_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit writer.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	while( bit_writer->bit_buffer_size > 0 )
+	{
+		if( bit_writer->byte_stream_offset >= bit_writer->byte_stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream value too small.",
+			 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			return( -1 );
 		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
-		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
+		bit_writer->byte_stream[ bit_writer->byte_stream_offset++ ] = (uint8_t) ( bit_writer->bit_buffer & 0xff );
 
-		if( lower_word > 65521 )
-		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( lower_word >= 65521 )
-		{
-			lower_word -= 65521;
-		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
+		bit_writer->bit_buffer >>= 8;
 
-		if( upper_word > 65521 )
+		if( bit_writer->bit_buffer_size < 8 )
 		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
+			bit_writer->bit_buffer_size = 0;
 		}
-		if( upper_word >= 65521 )
+		else
 		{
-			upper_word -= 65521;
+			bit_writer->bit_buffer_size -= 8;
 		}
-		size -= 0x15b0;
 	}
-	if( size > 0 )
-	{
-		while( size > 16 )
-		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	bit_writer->bit_buffer = 0;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	return( 1 );
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Determines the Huffman code sizes from the symbol frequencies
+ * The code sizes are limited to the maximum code size, at least 2 symbols are assigned a code
+ * Returns 1 on success or -1 on error
+ */
+int deflate_build_code_sizes(
+     const uint32_t *symbol_frequencies,
+     uint16_t number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t node_weights[ 2 * 288 ];
+	uint16_t code_size_counts[ 16 ];
+	uint16_t node_depths[ 2 * 288 ];
+	uint16_t node_parents[ 2 * 288 ];
+	uint16_t sorted_symbols[ 288 ];
+
+	static char *function           = "deflate_build_code_sizes";
+	uint32_t kraft_sum              = 0;
+	uint32_t weight                 = 0;
+	uint16_t code_size              = 0;
+	uint16_t internal_node_index    = 0;
+	uint16_t leaf_node_index        = 0;
+	uint16_t node_index             = 0;
+	uint16_t number_of_nodes        = 0;
+	uint16_t number_of_used_symbols = 0;
+	uint16_t sorted_symbol_index    = 0;
+	uint16_t symbol                 = 0;
+	int child_index                 = 0;
+	int code_size_count             = 0;
+
+	if( symbol_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol frequencies.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	if( ( number_of_symbols < 2 )
+	 || ( number_of_symbols > 288 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 15 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the used symbols by frequency using insertion sort
+	 */
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_sizes[ symbol ] = 0;
+
+		weight = symbol_frequencies[ symbol ];
+
+		if( weight == 0 )
+		{
+			continue;
+		}
+		sorted_symbol_index = number_of_used_symbols;
+
+		while( ( sorted_symbol_index > 0 )
+		    && ( node_weights[ sorted_symbol_index - 1 ] > weight ) )
+		{
+			node_weights[ sorted_symbol_index ]   = node_weights[ sorted_symbol_index - 1 ];
+			sorted_symbols[ sorted_symbol_index ] = sorted_symbols[ sorted_symbol_index - 1 ];
+
+			sorted_symbol_index--;
+		}
+		node_weights[ sorted_symbol_index ]   = weight;
+		sorted_symbols[ sorted_symbol_index ] = symbol;
+
+		number_of_used_symbols++;
+	}
+	/* A Huffman code requires at least 2 codes
+	 */
+	if( number_of_used_symbols <= 2 )
+	{
+		for( sorted_symbol_index = 0;
+		     sorted_symbol_index < number_of_used_symbols;
+		     sorted_symbol_index++ )
+		{
+			code_sizes[ sorted_symbols[ sorted_symbol_index ] ] = 1;
+		}
+		symbol = 0;
+
+		while( number_of_used_symbols < 2 )
+		{
+			if( code_sizes[ symbol ] == 0 )
+			{
+				code_sizes[ symbol ] = 1;
+
+				number_of_used_symbols++;
+			}
+			symbol++;
+		}
+		return( 1 );
+	}
+	/* Build the Huffman tree using 2 queues, the leaf nodes in order of weight
+	 * and the internal nodes in order of creation which is also in order of weight
+	 */
+	leaf_node_index     = 0;
+	internal_node_index = number_of_used_symbols;
+	number_of_nodes     = number_of_used_symbols;
+
+	while( number_of_nodes < ( ( 2 * number_of_used_symbols ) - 1 ) )
+	{
+		weight = 0;
+
+		for( child_index = 0;
+		     child_index < 2;
+		     child_index++ )
+		{
+			if( ( leaf_node_index < number_of_used_symbols )
+			 && ( ( internal_node_index >= number_of_nodes )
+			  ||  ( node_weights[ leaf_node_index ] <= node_weights[ internal_node_index ] ) ) )
+			{
+				node_index = leaf_node_index++;
+			}
+			else
+			{
+				node_index = internal_node_index++;
+			}
+			weight += node_weights[ node_index ];
+
+			node_parents[ node_index ] = number_of_nodes;
+		}
+		node_weights[ number_of_nodes++ ] = weight;
+	}
+	/* Determine the depth of the nodes, where the parent of a node always has a higher index
+	 */
+	node_index = number_of_nodes - 1;
+
+	node_depths[ node_index ] = 0;
+
+	while( node_index > 0 )
+	{
+		node_index--;
+
+		node_depths[ node_index ] = node_depths[ node_parents[ node_index ] ] + 1;
+	}
+	/* Limit the code sizes to the maximum code size
+	 */
+	for( code_size = 0;
+	     code_size <= 15;
+	     code_size++ )
+	{
+		code_size_counts[ code_size ] = 0;
+	}
+	for( node_index = 0;
+	     node_index < number_of_used_symbols;
+	     node_index++ )
+	{
+		code_size = node_depths[ node_index ];
+
+		if( code_size > maximum_code_size )
+		{
+			code_size = maximum_code_size;
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	for( code_size = 1;
+	     code_size <= maximum_code_size;
+	     code_size++ )
+	{
+		kraft_sum += (uint32_t) code_size_counts[ code_size ] << ( maximum_code_size - code_size );
+	}
+	while( kraft_sum > ( (uint32_t) 1 << maximum_code_size ) )
+	{
+		/* Move a code of the maximum code size to a longer code that is split into 2 codes
+		 */
+		code_size_counts[ maximum_code_size ] -= 1;
+
+		for( code_size = maximum_code_size - 1;
+		     code_size > 0;
+		     code_size-- )
+		{
+			if( code_size_counts[ code_size ] != 0 )
+			{
+				code_size_counts[ code_size ]     -= 1;
+				code_size_counts[ code_size + 1 ] += 2;
+
+				break;
+			}
+		}
+		kraft_sum -= 1;
+	}
+	/* Assign the longest codes to the least frequent symbols
+	 */
+	sorted_symbol_index = 0;
+
+	for( code_size = maximum_code_size;
+	     code_size > 0;
+	     code_size-- )
+	{
+		for( code_size_count = code_size_counts[ code_size ];
+		     code_size_count > 0;
+		     code_size_count-- )
+		{
+			code_sizes[ sorted_symbols[ sorted_symbol_index++ ] ] = (uint8_t) code_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the canonical Huffman codes from the code sizes
+ * The codes are bit reversed so they can be written back-to-front
+ * Returns 1 on success or -1 on error
+ */
+int deflate_build_codes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     uint16_t *codes,
+     libcerror_error_t **error )
+{
+	uint16_t code_size_counts[ 16 ];
+	uint16_t next_codes[ 16 ];
+
+	static char *function  = "deflate_build_codes";
+	uint16_t code          = 0;
+	uint16_t reversed_code = 0;
+	uint16_t symbol        = 0;
+	uint8_t bit_index      = 0;
+	uint8_t code_size      = 0;
+
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codes.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size = 0;
+	     code_size <= 15;
+	     code_size++ )
+	{
+		code_size_counts[ code_size ] = 0;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size > 15 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %" PRIu16 " code size value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	for( code_size = 1;
+	     code_size <= 15;
+	     code_size++ )
+	{
+		code = ( code + code_size_counts[ code_size - 1 ] ) << 1;
+
+		next_codes[ code_size ] = code;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size     = code_sizes[ symbol ];
+		reversed_code = 0;
+
+		if( code_size != 0 )
+		{
+			code = next_codes[ code_size ]++;
+
+			for( bit_index = 0;
+			     bit_index < code_size;
+			     bit_index++ )
+			{
+				reversed_code <<= 1;
+				reversed_code  |= code & 0x0001;
+				code          >>= 1;
+			}
+		}
+		codes[ symbol ] = reversed_code;
+	}
+	return( 1 );
+}
+
+/* Determines the symbol of a match
+ * The symbol contains the literal code in bits 0 - 8, the distance code in bits 9 - 13,
+ * the literal extra bits in bits 14 - 18 and the distance extra bits in bits 19 - 31
+ * Returns 1 on success or -1 on error
+ */
+int deflate_get_match_symbol(
+     uint16_t match_size,
+     uint16_t match_distance,
+     uint32_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function        = "deflate_get_match_symbol";
+	uint32_t distance_code       = 0;
+	uint32_t literal_code        = 0;
+	uint16_t distance_value      = 0;
+	uint16_t size_value          = 0;
+	uint8_t number_of_extra_bits = 0;
+
+	if( ( match_size < 3 )
+	 || ( match_size > DEFLATE_MAXIMUM_MATCH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( match_distance == 0 )
+	 || ( match_distance > DEFLATE_WINDOW_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match distance value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	size_value = match_size - 3;
+
+	if( match_size == DEFLATE_MAXIMUM_MATCH_SIZE )
+	{
+		literal_code = 28;
+	}
+	else if( size_value < 8 )
+	{
+		literal_code = size_value;
+	}
+	else
+	{
+		number_of_extra_bits = 1;
+
+		while( ( size_value >> ( number_of_extra_bits + 3 ) ) != 0 )
+		{
+			number_of_extra_bits++;
+		}
+		literal_code = ( (uint32_t) number_of_extra_bits << 2 ) + 4 + ( ( size_value >> number_of_extra_bits ) & 0x0003 );
+	}
+	distance_value = match_distance - 1;
+
+	if( distance_value < 4 )
+	{
+		distance_code = distance_value;
+	}
+	else
+	{
+		number_of_extra_bits = 1;
+
+		while( ( distance_value >> ( number_of_extra_bits + 2 ) ) != 0 )
+		{
+			number_of_extra_bits++;
+		}
+		distance_code = ( (uint32_t) number_of_extra_bits << 1 ) + 2 + ( ( distance_value >> number_of_extra_bits ) & 0x0001 );
+	}
+	*symbol = ( literal_code + 257 )
+	        | ( distance_code << 9 )
+	        | ( (uint32_t) ( match_size - deflate_literal_codes_base[ literal_code ] ) << 14 )
+	        | ( (uint32_t) ( match_distance - deflate_distance_codes_base[ distance_code ] ) << 19 );
+
+	return( 1 );
+}
+
+/* Writes uncompressed (stored) blocks
+ * Uncompressed data that exceeds the maximum block size is split into multiple blocks
+ * Returns 1 on success or -1 on error
+ */
+int deflate_write_stored_block(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t last_block_flag,
+     libcerror_error_t **error )
+{
+	static char *function      = "deflate_write_stored_block";
+	size_t uncompressed_offset = 0;
+	uint32_t block_header      = 0;
+	uint16_t block_size        = 0;
+
+	if( bit_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( ( uncompressed_data_size - uncompressed_offset ) > 0xffff )
+		{
+			block_size   = 0xffff;
+			block_header = DEFLATE_BLOCK_TYPE_UNCOMPRESSED << 1;
+		}
+		else
+		{
+			block_size   = (uint16_t) ( uncompressed_data_size - uncompressed_offset );
+			block_header = ( DEFLATE_BLOCK_TYPE_UNCOMPRESSED << 1 ) | ( last_block_flag & 0x01 );
+		}
+		if( deflate_bit_writer_write_value(
+		     bit_writer,
+		     block_header,
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block header.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_bit_writer_flush(
+		     bit_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush bit writer.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( (size_t) block_size + 4 ) > ( bit_writer->byte_stream_size - bit_writer->byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_writer->byte_stream[ bit_writer->byte_stream_offset ] ),
+		 block_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_writer->byte_stream[ bit_writer->byte_stream_offset + 2 ] ),
+		 block_size ^ 0xffff );
+
+		bit_writer->byte_stream_offset += 4;
+
+		if( memory_copy(
+		     &( bit_writer->byte_stream[ bit_writer->byte_stream_offset ] ),
+		     &( uncompressed_data[ uncompressed_offset ] ),
+		     (size_t) block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_writer->byte_stream_offset += block_size;
+		uncompressed_offset            += block_size;
+	}
+	while( uncompressed_offset < uncompressed_data_size );
+
+	return( 1 );
+}
+
+/* Writes a Huffman compressed block
+ * The symbols contain either a literal or a match symbol as determined by deflate_get_match_symbol
+ * The block is stored with either the fixed or dynamic Huffman codes or uncompressed,
+ * depending on which results in the smallest block
+ * Returns 1 on success or -1 on error
+ */
+int deflate_write_huffman_block(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     const uint32_t *symbols,
+     size_t number_of_symbols,
+     uint8_t last_block_flag,
+     libcerror_error_t **error )
+{
+	uint32_t code_size_frequencies[ 19 ];
+	uint32_t distance_frequencies[ 30 ];
+	uint32_t literal_frequencies[ 288 ];
+	uint16_t code_size_codes[ 19 ];
+	uint16_t distance_codes[ 30 ];
+	uint16_t literal_codes[ 288 ];
+	uint8_t code_size_code_sizes[ 19 ];
+	uint8_t code_size_symbols[ 316 ];
+	uint8_t code_size_symbols_extra_bits[ 316 ];
+	uint8_t code_sizes[ 316 ];
+	uint8_t distance_code_sizes[ 30 ];
+	uint8_t literal_code_sizes[ 288 ];
+
+	static char *function                = "deflate_write_huffman_block";
+	size_t dynamic_block_size            = 0;
+	size_t fixed_block_size              = 0;
+	size_t stored_block_size             = 0;
+	size_t symbol_index                  = 0;
+	uint32_t literal_code                = 0;
+	uint32_t symbol                      = 0;
+	uint16_t code_size_index             = 0;
+	uint16_t number_of_code_size_codes   = 0;
+	uint16_t number_of_code_size_symbols = 0;
+	uint16_t number_of_code_sizes        = 0;
+	uint16_t number_of_distance_codes    = 0;
+	uint16_t number_of_literal_codes     = 0;
+	uint16_t repeat_count                = 0;
+	uint16_t run_size                    = 0;
+	uint8_t block_type                   = 0;
+	uint8_t code_size                    = 0;
+	uint8_t distance_code                = 0;
+	uint8_t number_of_extra_bits         = 0;
+
+	if( bit_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( symbols == NULL )
+	 && ( number_of_symbols > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     literal_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 288 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear literal frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     distance_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 30 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distance frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 19 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the symbol frequencies and the size of the extra bits
+	 */
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		symbol       = symbols[ symbol_index ];
+		literal_code = symbol & 0x000001ffUL;
+
+		if( literal_code > 285 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %" PRIzd " value out of bounds.",
+			 function,
+			 symbol_index );
+
+			return( -1 );
+		}
+		literal_frequencies[ literal_code ] += 1;
+
+		if( literal_code > 256 )
+		{
+			distance_code = (uint8_t) ( ( symbol >> 9 ) & 0x0000001fUL );
+
+			if( distance_code >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid symbol: %" PRIzd " value out of bounds.",
+				 function,
+				 symbol_index );
+
+				return( -1 );
+			}
+			distance_frequencies[ distance_code ] += 1;
+
+			dynamic_block_size += deflate_literal_codes_number_of_extra_bits[ literal_code - 257 ]
+			                    + deflate_distance_codes_number_of_extra_bits[ distance_code ];
+		}
+	}
+	/* The end-of-block symbol
+	 */
+	literal_frequencies[ 256 ] = 1;
+
+	if( deflate_build_code_sizes(
+	     literal_frequencies,
+	     286,
+	     15,
+	     literal_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literal code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_build_code_sizes(
+	     distance_frequencies,
+	     30,
+	     15,
+	     distance_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distance code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_literal_codes = 286;
+
+	while( ( number_of_literal_codes > 257 )
+	    && ( literal_code_sizes[ number_of_literal_codes - 1 ] == 0 ) )
+	{
+		number_of_literal_codes--;
+	}
+	number_of_distance_codes = 30;
+
+	while( ( number_of_distance_codes > 1 )
+	    && ( distance_code_sizes[ number_of_distance_codes - 1 ] == 0 ) )
+	{
+		number_of_distance_codes--;
+	}
+	if( memory_copy(
+	     code_sizes,
+	     literal_code_sizes,
+	     sizeof( uint8_t ) * number_of_literal_codes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy literal code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( code_sizes[ number_of_literal_codes ] ),
+	     distance_code_sizes,
+	     sizeof( uint8_t ) * number_of_distance_codes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy distance code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
+
+	/* Run-length encode the code sizes using the code size symbols 16, 17 and 18
+	 */
+	code_size_index = 0;
+
+	while( code_size_index < number_of_code_sizes )
+	{
+		code_size = code_sizes[ code_size_index ];
+		run_size  = 1;
+
+		while( ( ( code_size_index + run_size ) < number_of_code_sizes )
+		    && ( code_sizes[ code_size_index + run_size ] == code_size ) )
+		{
+			run_size++;
+		}
+		code_size_index += run_size;
+
+		if( code_size == 0 )
+		{
+			while( run_size >= 11 )
+			{
+				repeat_count = ( run_size < 138 ) ? run_size : 138;
+
+				code_size_symbols[ number_of_code_size_symbols ]              = 18;
+				code_size_symbols_extra_bits[ number_of_code_size_symbols++ ] = (uint8_t) ( repeat_count - 11 );
+
+				run_size -= repeat_count;
+			}
+			if( run_size >= 3 )
+			{
+				code_size_symbols[ number_of_code_size_symbols ]              = 17;
+				code_size_symbols_extra_bits[ number_of_code_size_symbols++ ] = (uint8_t) ( run_size - 3 );
+
+				run_size = 0;
+			}
+		}
+		else
+		{
+			code_size_symbols[ number_of_code_size_symbols ]              = code_size;
+			code_size_symbols_extra_bits[ number_of_code_size_symbols++ ] = 0;
+
+			run_size--;
+
+			while( run_size >= 3 )
+			{
+				repeat_count = ( run_size < 6 ) ? run_size : 6;
+
+				code_size_symbols[ number_of_code_size_symbols ]              = 16;
+				code_size_symbols_extra_bits[ number_of_code_size_symbols++ ] = (uint8_t) ( repeat_count - 3 );
+
+				run_size -= repeat_count;
+			}
+		}
+		while( run_size > 0 )
+		{
+			code_size_symbols[ number_of_code_size_symbols ]              = code_size;
+			code_size_symbols_extra_bits[ number_of_code_size_symbols++ ] = 0;
+
+			run_size--;
+		}
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_size_symbols;
+	     code_size_index++ )
+	{
+		code_size_frequencies[ code_size_symbols[ code_size_index ] ] += 1;
+	}
+	if( deflate_build_code_sizes(
+	     code_size_frequencies,
+	     19,
+	     7,
+	     code_size_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build code size code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_size_codes = 19;
+
+	while( ( number_of_code_size_codes > 4 )
+	    && ( code_size_code_sizes[ deflate_code_sizes_sequence[ number_of_code_size_codes - 1 ] ] == 0 ) )
+	{
+		number_of_code_size_codes--;
+	}
+	/* Determine the size of the block for each of the block types
+	 */
+	fixed_block_size = dynamic_block_size + 3;
+
+	dynamic_block_size += 3 + 5 + 5 + 4 + ( 3 * number_of_code_size_codes )
+	                    + ( 2 * code_size_frequencies[ 16 ] )
+	                    + ( 3 * code_size_frequencies[ 17 ] )
+	                    + ( 7 * code_size_frequencies[ 18 ] );
+
+	for( code_size_index = 0;
+	     code_size_index < 19;
+	     code_size_index++ )
+	{
+		dynamic_block_size += code_size_frequencies[ code_size_index ] * code_size_code_sizes[ code_size_index ];
+	}
+	for( code_size_index = 0;
+	     code_size_index < 286;
+	     code_size_index++ )
+	{
+		dynamic_block_size += literal_frequencies[ code_size_index ] * literal_code_sizes[ code_size_index ];
+
+		if( code_size_index < 144 )
+		{
+			code_size = 8;
+		}
+		else if( code_size_index < 256 )
+		{
+			code_size = 9;
+		}
+		else if( code_size_index < 280 )
+		{
+			code_size = 7;
+		}
+		else
+		{
+			code_size = 8;
+		}
+		fixed_block_size += literal_frequencies[ code_size_index ] * code_size;
+	}
+	for( code_size_index = 0;
+	     code_size_index < 30;
+	     code_size_index++ )
+	{
+		dynamic_block_size += distance_frequencies[ code_size_index ] * distance_code_sizes[ code_size_index ];
+		fixed_block_size   += distance_frequencies[ code_size_index ] * 5;
+	}
+	/* The stored block size includes the block header, the padding and the block size values
+	 */
+	stored_block_size = ( ( ( uncompressed_data_size / 0xffff ) + 1 ) * ( 3 + 7 + 32 ) )
+	                  + ( uncompressed_data_size * 8 );
+
+	if( ( stored_block_size <= fixed_block_size )
+	 && ( stored_block_size <= dynamic_block_size ) )
+	{
+		if( deflate_write_stored_block(
+		     bit_writer,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed block.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( fixed_block_size <= dynamic_block_size )
+	{
+		block_type = DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED;
+
+		for( code_size_index = 0;
+		     code_size_index < 288;
+		     code_size_index++ )
+		{
+			if( code_size_index < 144 )
+			{
+				literal_code_sizes[ code_size_index ] = 8;
+			}
+			else if( code_size_index < 256 )
+			{
+				literal_code_sizes[ code_size_index ] = 9;
+			}
+			else if( code_size_index < 280 )
+			{
+				literal_code_sizes[ code_size_index ] = 7;
+			}
+			else
+			{
+				literal_code_sizes[ code_size_index ] = 8;
+			}
+		}
+		for( code_size_index = 0;
+		     code_size_index < 30;
+		     code_size_index++ )
+		{
+			distance_code_sizes[ code_size_index ] = 5;
+		}
+		number_of_literal_codes  = 288;
+		number_of_distance_codes = 30;
+	}
+	else
+	{
+		block_type = DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC;
+	}
+	if( deflate_build_codes(
+	     literal_code_sizes,
+	     number_of_literal_codes,
+	     literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literal codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_build_codes(
+	     distance_code_sizes,
+	     number_of_distance_codes,
+	     distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distance codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_bit_writer_write_value(
+	     bit_writer,
+	     (uint32_t) ( block_type << 1 ) | ( last_block_flag & 0x01 ),
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block header.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+	{
+		if( deflate_build_codes(
+		     code_size_code_sizes,
+		     19,
+		     code_size_codes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build code size codes.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_bit_writer_write_value(
+		     bit_writer,
+		     (uint32_t) ( number_of_literal_codes - 257 )
+		     | ( (uint32_t) ( number_of_distance_codes - 1 ) << 5 )
+		     | ( (uint32_t) ( number_of_code_size_codes - 4 ) << 10 ),
+		     14,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write number of codes.",
+			 function );
+
+			return( -1 );
+		}
+		for( code_size_index = 0;
+		     code_size_index < number_of_code_size_codes;
+		     code_size_index++ )
+		{
+			if( deflate_bit_writer_write_value(
+			     bit_writer,
+			     code_size_code_sizes[ deflate_code_sizes_sequence[ code_size_index ] ],
+			     3,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write code size.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		for( code_size_index = 0;
+		     code_size_index < number_of_code_size_symbols;
+		     code_size_index++ )
+		{
+			code_size = code_size_symbols[ code_size_index ];
+
+			if( deflate_bit_writer_write_value(
+			     bit_writer,
+			     code_size_codes[ code_size ],
+			     code_size_code_sizes[ code_size ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write code size symbol.",
+				 function );
+
+				return( -1 );
+			}
+			if( code_size == 16 )
+			{
+				number_of_extra_bits = 2;
+			}
+			else if( code_size == 17 )
+			{
+				number_of_extra_bits = 3;
+			}
+			else if( code_size == 18 )
+			{
+				number_of_extra_bits = 7;
+			}
+			else
+			{
+				number_of_extra_bits = 0;
+			}
+			if( number_of_extra_bits > 0 )
+			{
+				if( deflate_bit_writer_write_value(
+				     bit_writer,
+				     code_size_symbols_extra_bits[ code_size_index ],
+				     number_of_extra_bits,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write code size symbol extra bits.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		symbol       = symbols[ symbol_index ];
+		literal_code = symbol & 0x000001ffUL;
+
+		if( deflate_bit_writer_write_value(
+		     bit_writer,
+		     literal_codes[ literal_code ],
+		     literal_code_sizes[ literal_code ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write literal code.",
+			 function );
+
+			return( -1 );
+		}
+		if( literal_code <= 256 )
+		{
+			continue;
+		}
+		number_of_extra_bits = (uint8_t) deflate_literal_codes_number_of_extra_bits[ literal_code - 257 ];
+
+		if( number_of_extra_bits > 0 )
+		{
+			if( deflate_bit_writer_write_value(
+			     bit_writer,
+			     ( symbol >> 14 ) & 0x0000001fUL,
+			     number_of_extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write literal extra bits.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		distance_code = (uint8_t) ( ( symbol >> 9 ) & 0x0000001fUL );
+
+		if( deflate_bit_writer_write_value(
+		     bit_writer,
+		     distance_codes[ distance_code ],
+		     distance_code_sizes[ distance_code ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write distance code.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_extra_bits = (uint8_t) deflate_distance_codes_number_of_extra_bits[ distance_code ];
+
+		if( number_of_extra_bits > 0 )
+		{
+			if( deflate_bit_writer_write_value(
+			     bit_writer,
+			     symbol >> 19,
+			     number_of_extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write distance extra bits.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( deflate_bit_writer_write_value(
+	     bit_writer,
+	     literal_codes[ 256 ],
+	     literal_code_sizes[ 256 ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end-of-block code.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the uncompressed data as compressed blocks
+ * The first dictionary size bytes of the uncompressed data are a preset dictionary,
+ * which can be referenced by matches but is not written
+ * The compression level determines the effort of the match finder, where 0 represents no compression
+ * Returns 1 on success or -1 on error
+ */
+int deflate_write_blocks(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t dictionary_size,
+     int compression_level,
+     uint8_t last_block_flag,
+     libcerror_error_t **error )
+{
+	size_t *hash_chain               = NULL;
+	size_t *hash_heads               = NULL;
+	uint32_t *symbols                = NULL;
+	static char *function            = "deflate_write_blocks";
+	size_t block_data_offset         = 0;
+	size_t data_offset               = 0;
+	size_t hash_chain_offset         = 0;
+	size_t insert_data_offset        = 0;
+	size_t match_end_offset          = 0;
+	size_t number_of_symbols         = 0;
+	uint32_t hash_value              = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t chain_length            = 0;
+	uint16_t good_match_size         = 0;
+	uint16_t match_distance          = 0;
+	uint16_t match_size              = 0;
+	uint16_t maximum_chain_length    = 0;
+	uint16_t maximum_lazy_match_size = 0;
+	uint16_t nice_match_size         = 0;
+	uint16_t previous_match_distance = 0;
+	uint16_t previous_match_size     = 0;
+	uint8_t lazy_matching            = 0;
+	uint8_t match_available          = 0;
+	int result                       = 0;
+
+	if( bit_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_size > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == 0 )
+	{
+		if( deflate_write_stored_block(
+		     bit_writer,
+		     &( uncompressed_data[ dictionary_size ] ),
+		     uncompressed_data_size - dictionary_size,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed block.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	good_match_size         = deflate_compression_level_configurations[ compression_level ][ 0 ];
+	maximum_lazy_match_size = deflate_compression_level_configurations[ compression_level ][ 1 ];
+	nice_match_size         = deflate_compression_level_configurations[ compression_level ][ 2 ];
+	maximum_chain_length    = deflate_compression_level_configurations[ compression_level ][ 3 ];
+
+	if( compression_level >= 4 )
+	{
+		lazy_matching = 1;
+	}
+	hash_heads = (size_t *) memory_allocate(
+	                         sizeof( size_t ) << DEFLATE_HASH_NUMBER_OF_BITS );
+
+	if( hash_heads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_heads,
+	     0,
+	     sizeof( size_t ) << DEFLATE_HASH_NUMBER_OF_BITS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	hash_chain = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * DEFLATE_WINDOW_SIZE );
+
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_chain,
+	     0,
+	     sizeof( size_t ) * DEFLATE_WINDOW_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	symbols = (uint32_t *) memory_allocate(
+	                        sizeof( uint32_t ) * DEFLATE_MAXIMUM_NUMBER_OF_BLOCK_SYMBOLS );
+
+	if( symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create symbols.",
+		 function );
+
+		goto on_error;
+	}
+	/* Add the positions within the preset dictionary to the hash chains
+	 */
+	while( ( data_offset < dictionary_size )
+	    && ( ( uncompressed_data_size - data_offset ) >= 3 ) )
+	{
+		value_32bit = ( (uint32_t) uncompressed_data[ data_offset ] << 16 )
+		            | ( (uint32_t) uncompressed_data[ data_offset + 1 ] << 8 )
+		            | uncompressed_data[ data_offset + 2 ];
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - DEFLATE_HASH_NUMBER_OF_BITS );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		hash_chain[ data_offset & ( DEFLATE_WINDOW_SIZE - 1 ) ] = hash_heads[ hash_value ];
+		hash_heads[ hash_value ]                                = data_offset + 1;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		data_offset++;
+	}
+	data_offset       = dictionary_size;
+	block_data_offset = dictionary_size;
+
+	while( data_offset < uncompressed_data_size )
+	{
+		/* Write a block when the symbols are full, the pending literal of lazy matching is not yet part of the block
+		 */
+		if( number_of_symbols >= DEFLATE_MAXIMUM_NUMBER_OF_BLOCK_SYMBOLS )
+		{
+			if( deflate_write_huffman_block(
+			     bit_writer,
+			     &( uncompressed_data[ block_data_offset ] ),
+			     data_offset - match_available - block_data_offset,
+			     symbols,
+			     number_of_symbols,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				goto on_error;
+			}
+			block_data_offset = data_offset - match_available;
+			number_of_symbols = 0;
+		}
+		match_size = 2;
+
+		if( ( uncompressed_data_size - data_offset ) >= 3 )
+		{
+			value_32bit = ( (uint32_t) uncompressed_data[ data_offset ] << 16 )
+			            | ( (uint32_t) uncompressed_data[ data_offset + 1 ] << 8 )
+			            | uncompressed_data[ data_offset + 2 ];
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - DEFLATE_HASH_NUMBER_OF_BITS );
+
+			hash_chain_offset = hash_heads[ hash_value ];
+
+			if( ( hash_chain_offset != 0 )
+			 && ( ( lazy_matching == 0 )
+			  ||  ( previous_match_size < maximum_lazy_match_size ) ) )
+			{
+				chain_length = maximum_chain_length;
+
+				if( previous_match_size >= 3 )
+				{
+					match_size = previous_match_size;
+
+					if( previous_match_size >= good_match_size )
+					{
+						chain_length >>= 2;
+					}
+				}
+				result = match_finder_find_longest_match(
+				          uncompressed_data,
+				          uncompressed_data_size,
+				          data_offset,
+				          hash_chain,
+				          hash_chain_offset,
+				          DEFLATE_WINDOW_SIZE,
+				          DEFLATE_MAXIMUM_MATCH_SIZE,
+				          chain_length,
+				          nice_match_size,
+				          &match_size,
+				          &match_distance,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find longest match.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					match_size = 2;
+				}
+			}
+			hash_chain[ data_offset & ( DEFLATE_WINDOW_SIZE - 1 ) ] = hash_chain_offset;
+			hash_heads[ hash_value ]                                = data_offset + 1;
+		}
+		if( lazy_matching == 0 )
+		{
+			if( match_size >= 3 )
+			{
+				if( deflate_get_match_symbol(
+				     match_size,
+				     match_distance,
+				     &( symbols[ number_of_symbols ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve match symbol.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_symbols++;
+
+				match_end_offset = data_offset + match_size;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+				if( match_size > maximum_lazy_match_size )
+				{
+					insert_data_offset = match_end_offset;
+				}
+				else
+				{
+					insert_data_offset = data_offset + 1;
+				}
+				data_offset = match_end_offset;
+			}
+			else
+			{
+				symbols[ number_of_symbols++ ] = uncompressed_data[ data_offset ];
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+				data_offset++;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+				continue;
+			}
+		}
+		else if( ( previous_match_size >= 3 )
+		      && ( match_size <= previous_match_size ) )
+		{
+			if( deflate_get_match_symbol(
+			     previous_match_size,
+			     previous_match_distance,
+			     &( symbols[ number_of_symbols ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve match symbol.",
+				 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+				goto on_error;
+			}
+			number_of_symbols++;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			match_end_offset   = data_offset - 1 + previous_match_size;
+			insert_data_offset = data_offset + 1;
+			data_offset        = match_end_offset;
 
-			size -= 16;
+			match_available     = 0;
+			previous_match_size = 0;
 		}
-		while( size > 0 )
+		else
 		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			if( match_available != 0 )
+			{
+				symbols[ number_of_symbols++ ] = uncompressed_data[ data_offset - 1 ];
+			}
+			match_available         = 1;
+			previous_match_size     = match_size;
+			previous_match_distance = match_distance;
 
-			size--;
+			data_offset++;
+
+			continue;
 		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
+		/* Add the positions within the match to the hash chains
 		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
+		while( ( insert_data_offset < match_end_offset )
+		    && ( ( uncompressed_data_size - insert_data_offset ) >= 3 ) )
+		{
+			value_32bit = ( (uint32_t) uncompressed_data[ insert_data_offset ] << 16 )
+			            | ( (uint32_t) uncompressed_data[ insert_data_offset + 1 ] << 8 )
+			            | uncompressed_data[ insert_data_offset + 2 ];
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - DEFLATE_HASH_NUMBER_OF_BITS );
+
+			hash_chain[ insert_data_offset & ( DEFLATE_WINDOW_SIZE - 1 ) ] = hash_heads[ hash_value ];
+			hash_heads[ hash_value ]                                       = insert_data_offset + 1;
+
+			insert_data_offset++;
+		}
+	}
+	if( match_available != 0 )
+	{
+		if( number_of_symbols >= DEFLATE_MAXIMUM_NUMBER_OF_BLOCK_SYMBOLS )
+		{
+			if( deflate_write_huffman_block(
+			     bit_writer,
+			     &( uncompressed_data[ block_data_offset ] ),
+			     data_offset - 1 - block_data_offset,
+			     symbols,
+			     number_of_symbols,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				goto on_error;
+			}
+			block_data_offset = data_offset - 1;
+			number_of_symbols = 0;
+		}
+		symbols[ number_of_symbols++ ] = uncompressed_data[ data_offset - 1 ];
+	}
+	if( deflate_write_huffman_block(
+	     bit_writer,
+	     &( uncompressed_data[ block_data_offset ] ),
+	     uncompressed_data_size - block_data_offset,
+	     symbols,
+	     number_of_symbols,
+	     last_block_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write last block.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 symbols );
+
+	memory_free(
+	 hash_chain );
+
+	memory_free(
+	 hash_heads );
+
+	return( 1 );
+
+on_error:
+	if( symbols != NULL )
+	{
+		memory_free(
+		 symbols );
+	}
+	if( hash_chain != NULL )
+	{
+		memory_free(
+		 hash_chain );
+	}
+	if( hash_heads != NULL )
+	{
+		memory_free(
+		 hash_heads );
+	}
+	return( -1 );
+}
+
+/* Writes the zlib data header
+ * Returns 1 on success or -1 on error
+ */
+int deflate_write_data_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function     = "deflate_write_data_header";
+	uint8_t compression_flags = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
 
-		if( lower_word > 65521 )
-		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( lower_word >= 65521 )
-		{
-			lower_word -= 65521;
-		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
 
-		if( upper_word > 65521 )
-		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( upper_word >= 65521 )
-		{
-			upper_word -= 65521;
-		}
+		return( -1 );
+	}
+	/* The compression flags contain the compression level in bits 6 - 7 and check bits in bits 0 - 4
+	 */
+	if( compression_level < 2 )
+	{
+		compression_flags = 0x00;
+	}
+	else if( compression_level < 6 )
+	{
+		compression_flags = 0x40;
+	}
+	else if( compression_level == 6 )
+	{
+		compression_flags = 0x80;
+	}
+	else
+	{
+		compression_flags = 0xc0;
 	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	compression_flags += 31 - ( ( ( 0x78 << 8 ) | compression_flags ) % 31 );
+
+	/* The compression method is deflate with a 32k window size
+	 */
+	compressed_data[ 0 ] = 0x78;
+	compressed_data[ 1 ] = compression_flags;
 
 	return( 1 );
 }
 
 /* Compresses data using zlib compression
+ * A compression level of -1 represents the default compression level
  * Returns 1 on success or -1 on error
  */
 int deflate_compress(
@@ -1027,7 +3013,10 @@ int deflate_compress(
      size_t *compressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "deflate_compress";
+	deflate_bit_writer_t bit_writer;
+
+	static char *function        = "deflate_compress";
+	uint32_t calculated_checksum = 0;
 
 	if( uncompressed_data == NULL )
 	{
@@ -1084,15 +3073,119 @@ int deflate_compress(
 
 		return( -1 );
 	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
+	if( *compressed_data_size < 6 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	if( compression_level == -1 )
+	{
+		compression_level = 6;
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_write_data_header(
+	     compressed_data,
+	     *compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data header.",
+		 function );
+
+		return( -1 );
+	}
+	bit_writer.byte_stream        = compressed_data;
+	bit_writer.byte_stream_size   = *compressed_data_size;
+	bit_writer.byte_stream_offset = 2;
+	bit_writer.bit_buffer         = 0;
+	bit_writer.bit_buffer_size    = 0;
+
+	if( deflate_write_blocks(
+	     &bit_writer,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     0,
+	     compression_level,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_bit_writer_flush(
+	     &bit_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to flush bit writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_writer.byte_stream_size - bit_writer.byte_stream_offset ) < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_calculate_adler32(
+	     &calculated_checksum,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ bit_writer.byte_stream_offset ] ),
+	 calculated_checksum );
+
+	*compressed_data_size = bit_writer.byte_stream_offset + 4;
+
+	return( 1 );
 }
 
 /* Reads the compressed data header
@@ -1406,31 +3499,39 @@ int deflate_read_block_header(
  * Returns 1 on success or -1 on error
  */
 int deflate_read_block(
-     bit_stream_t *bit_stream,
+     deflate_decoder_t *deflate_decoder,
      uint8_t block_type,
-     huffman_tree_t *fixed_huffman_distances_tree,
-     huffman_tree_t *fixed_huffman_literals_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	huffman_tree_t *dynamic_huffman_distances_tree = NULL;
-	huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
-	static char *function                          = "deflate_read_block";
-	size_t safe_uncompressed_data_offset           = 0;
-	uint32_t block_size                            = 0;
-	uint32_t block_size_copy                       = 0;
-	uint32_t value_32bit                           = 0;
-	uint8_t skip_bits                              = 0;
-
-	if( bit_stream == NULL )
+	bit_stream_t *bit_stream             = NULL;
+	static char *function                = "deflate_read_block";
+	size_t safe_uncompressed_data_offset = 0;
+	uint32_t block_size                  = 0;
+	uint32_t block_size_copy             = 0;
+	uint32_t value_32bit                 = 0;
+	uint8_t skip_bits                    = 0;
+
+	if( deflate_decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit stream.",
+		 "%s: invalid deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_decoder->bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate decoder - missing bit stream.",
 		 function );
 
 		return( -1 );
@@ -1457,6 +3558,8 @@ int deflate_read_block(
 
 		return( -1 );
 	}
+	bit_stream = deflate_decoder->bit_stream;
+
 	switch( block_type )
 	{
 		case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
@@ -1469,7 +3572,7 @@ int deflate_read_block(
 				 "%s: invalid uncompressed data.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			safe_uncompressed_data_offset = *uncompressed_data_offset;
 
@@ -1499,7 +3602,7 @@ int deflate_read_block(
 					 "%s: unable to retrieve value from bit stream.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 			}
 			if( bit_stream_get_value(
@@ -1515,9 +3618,9 @@ int deflate_read_block(
 				 "%s: unable to retrieve value from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			block_size_copy = block_size >> 16;
+			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
 			block_size     &= 0x0000ffffUL;
 
 			if( libcnotify_verbose != 0 )
@@ -1535,10 +3638,9 @@ int deflate_read_block(
 				libcnotify_printf(
 				 "%s: block header block size copy\t\t\t: %" PRIu16 " (%" PRIu32 ")\n",
 				 function,
-				 block_size_copy ^ 0x0000ffffUL,
-				 block_size_copy );
+				 block_size_copy,
+				 block_size_copy ^ 0x0000ffffUL );
 			}
-			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
 
 			if( block_size != block_size_copy )
 			{
@@ -1551,8 +3653,15 @@ int deflate_read_block(
 				 block_size,
 				 block_size_copy );
 
-				goto on_error;
+				return( -1 );
 			}
+			/* The bit buffer can contain bytes that were read ahead
+			 * since the bit buffer is byte aligned at this point these are returned to the byte stream
+			 */
+			bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+			bit_stream->bit_buffer          = 0;
+			bit_stream->bit_buffer_size     = 0;
+
 			if( block_size == 0 )
 			{
 				break;
@@ -1566,7 +3675,7 @@ int deflate_read_block(
 				 "%s: invalid compressed data value too small.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( ( (size_t) block_size > uncompressed_data_size )
 			 || ( safe_uncompressed_data_offset > ( uncompressed_data_size - block_size ) ) )
@@ -1578,203 +3687,380 @@ int deflate_read_block(
 				 "%s: invalid uncompressed data value too small.",
 				 function );
 
-				goto on_error;
-			}
-			if( memory_copy(
-			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
-			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
-			     (size_t) block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to initialize lz buffer.",
-				 function );
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			     (size_t) block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to initialize lz buffer.",
+				 function );
+
+				return( -1 );
+			}
+			bit_stream->byte_stream_offset += block_size;
+			safe_uncompressed_data_offset  += block_size;
+
+			*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+			if( deflate_decode_huffman(
+			     bit_stream,
+			     &deflate_fixed_literals_huffman_tree,
+			     &deflate_fixed_distances_huffman_tree,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode fixed Huffman encoded bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			if( deflate_build_dynamic_huffman_trees(
+			     bit_stream,
+			     deflate_decoder->pre_codes_huffman_tree,
+			     deflate_decoder->literals_huffman_tree,
+			     deflate_decoder->distances_huffman_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build dynamic Huffman trees.",
+				 function );
+
+				return( -1 );
+			}
+			if( deflate_decode_huffman(
+			     bit_stream,
+			     deflate_decoder->literals_huffman_tree,
+			     deflate_decoder->distances_huffman_tree,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode dynamic Huffman encoded bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block type.",
+			 function );
+
+			return( -1 );
+	}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Creates a deflate decoder
+ * Make sure the value deflate_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_decoder_initialize(
+     deflate_decoder_t **deflate_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decoder_initialize";
+
+	if( deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_decoder = memory_allocate_structure(
+	                    deflate_decoder_t );
+
+	if( *deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_decoder,
+	     0,
+	     sizeof( deflate_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate decoder.",
+		 function );
+
+		memory_free(
+		 *deflate_decoder );
+
+		*deflate_decoder = NULL;
 
-				goto on_error;
-			}
-			bit_stream->byte_stream_offset += block_size;
-			safe_uncompressed_data_offset  += block_size;
+		return( -1 );
+	}
+	if( bit_stream_initialize(
+	     &( ( *deflate_decoder )->bit_stream ),
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
 
-			/* Flush the bit-stream buffer
-			 */
-			bit_stream->bit_buffer      = 0;
-			bit_stream->bit_buffer_size = 0;
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_decoder )->pre_codes_huffman_tree ),
+	     19,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pre-codes Huffman tree.",
+		 function );
 
-			*uncompressed_data_offset = safe_uncompressed_data_offset;
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_decoder )->literals_huffman_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create literals Huffman tree.",
+		 function );
 
-			break;
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_decoder )->distances_huffman_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create distances Huffman tree.",
+		 function );
 
-		case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-			if( deflate_decode_huffman(
-			     bit_stream,
-			     fixed_huffman_literals_tree,
-			     fixed_huffman_distances_tree,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     uncompressed_data_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decode fixed Huffman encoded bit stream.",
-				 function );
+		goto on_error;
+	}
+	return( 1 );
 
-				goto on_error;
-			}
-			break;
+on_error:
+	if( *deflate_decoder != NULL )
+	{
+		deflate_decoder_free(
+		 deflate_decoder,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
-			if( huffman_tree_initialize(
-			     &dynamic_huffman_literals_tree,
-			     288,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create dynamic literals Huffman tree.",
-				 function );
+/* Frees a deflate decoder
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_decoder_free(
+     deflate_decoder_t **deflate_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decoder_free";
+	int result            = 1;
 
-				goto on_error;
-			}
-			if( huffman_tree_initialize(
-			     &dynamic_huffman_distances_tree,
-			     30,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create dynamic distances Huffman tree.",
-				 function );
+	if( deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate decoder.",
+		 function );
 
-				goto on_error;
-			}
-			if( deflate_build_dynamic_huffman_trees(
-			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
+		return( -1 );
+	}
+	if( *deflate_decoder != NULL )
+	{
+		if( ( *deflate_decoder )->distances_huffman_tree != NULL )
+		{
+			if( huffman_tree_free(
+			     &( ( *deflate_decoder )->distances_huffman_tree ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic Huffman trees.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free distances Huffman tree.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
-			if( deflate_decode_huffman(
-			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     uncompressed_data_offset,
+		}
+		if( ( *deflate_decoder )->literals_huffman_tree != NULL )
+		{
+			if( huffman_tree_free(
+			     &( ( *deflate_decoder )->literals_huffman_tree ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decode dynamic Huffman encoded bit stream.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free literals Huffman tree.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
+		}
+		if( ( *deflate_decoder )->pre_codes_huffman_tree != NULL )
+		{
 			if( huffman_tree_free(
-			     &dynamic_huffman_distances_tree,
+			     &( ( *deflate_decoder )->pre_codes_huffman_tree ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic distances Huffman tree.",
+				 "%s: unable to free pre-codes Huffman tree.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
-			if( huffman_tree_free(
-			     &dynamic_huffman_literals_tree,
+		}
+		if( ( *deflate_decoder )->bit_stream != NULL )
+		{
+			if( bit_stream_free(
+			     &( ( *deflate_decoder )->bit_stream ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic literals Huffman tree.",
+				 "%s: unable to free bit stream.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
-			break;
-
-		case DEFLATE_BLOCK_TYPE_RESERVED:
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported block type.",
-			 function );
-
-			goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-	return( 1 );
+		}
+		memory_free(
+		 *deflate_decoder );
 
-on_error:
-	if( dynamic_huffman_distances_tree != NULL )
-	{
-		huffman_tree_free(
-		 &dynamic_huffman_distances_tree,
-		 NULL );
-	}
-	if( dynamic_huffman_literals_tree != NULL )
-	{
-		huffman_tree_free(
-		 &dynamic_huffman_literals_tree,
-		 NULL );
+		*deflate_decoder = NULL;
 	}
-	return( -1 );
+	return( result );
 }
 
 /* Decompresses data using DEFLATE compression
+ * The Huffman trees and bit stream of the decoder are reused between calls
  * Returns 1 on success or -1 on error
  */
-int deflate_decompress(
+int deflate_decoder_decompress(
+     deflate_decoder_t *deflate_decoder,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	bit_stream_t *bit_stream                     = NULL;
-	huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                        = "deflate_decompress";
-	size_t compressed_data_offset                = 0;
-	size_t safe_uncompressed_data_size           = 0;
-	size_t uncompressed_data_offset              = 0;
-	uint32_t calculated_checksum                 = 0;
-	uint32_t stored_checksum                     = 0;
-	uint8_t block_type                           = 0;
-	uint8_t last_block_flag                      = 0;
+	bit_stream_t *bit_stream           = NULL;
+	static char *function              = "deflate_decoder_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_decoder->bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate decoder - missing bit stream.",
+		 function );
 
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1841,211 +4127,119 @@ int deflate_decompress(
 		 "%s: invalid compressed data value too small.",
 		 function );
 
-		goto on_error;
-	}
-	if( bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit-stream.",
-		 function );
-
-		goto on_error;
-	}
-/* TODO add seek byte offset function */
-	bit_stream->byte_stream_offset = compressed_data_offset;
-
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
-	{
-		if( deflate_read_block_header(
-		     bit_stream,
-		     &block_type,
-		     &last_block_flag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block header.",
-			 function );
-
-			goto on_error;
-		}
-		if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
+		goto on_error;
+	}
+	/* The bit stream is reset for every call
+	 */
+	bit_stream = deflate_decoder->bit_stream;
 
-					goto on_error;
-				}
-			}
-		}
-		if( deflate_read_block(
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
+	bit_stream->byte_stream_offset = compressed_data_offset;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
+	{
+		if( deflate_read_block_header(
 		     bit_stream,
-		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
+		     &block_type,
+		     &last_block_flag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block.",
+			 "%s: unable to read compressed data block header.",
 			 function );
 
 			goto on_error;
 		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
-	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( huffman_tree_free(
-		     &fixed_huffman_distances_tree,
+		if( deflate_read_block(
+		     deflate_decoder,
+		     block_type,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
+		if( last_block_flag != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
+			break;
 		}
 	}
-	if( bit_stream_free(
-	     &bit_stream,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit-stream.",
-		 function );
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
 
-		goto on_error;
-	}
 	*uncompressed_data_size = uncompressed_data_offset;
 
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
 	if( bit_stream != NULL )
 	{
-		bit_stream_free(
-		 &bit_stream,
-		 NULL );
+		bit_stream->byte_stream      = NULL;
+		bit_stream->byte_stream_size = 0;
 	}
 	return( -1 );
 }
 
 /* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * The Huffman trees and bit stream of the decoder are reused between calls
  * Returns 1 on success or -1 on error
  */
-int deflate_decompress_zlib(
+int deflate_decoder_decompress_zlib(
+     deflate_decoder_t *deflate_decoder,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	bit_stream_t *bit_stream                     = NULL;
-	huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                        = "deflate_decompress_zlib";
-	size_t compressed_data_offset                = 0;
-	size_t safe_uncompressed_data_size           = 0;
-	size_t uncompressed_data_offset              = 0;
-	uint32_t calculated_checksum                 = 0;
-	uint32_t stored_checksum                     = 0;
-	uint8_t block_type                           = 0;
-	uint8_t last_block_flag                      = 0;
+	bit_stream_t *bit_stream           = NULL;
+	static char *function              = "deflate_decoder_decompress_zlib";
+	size_t checksum_data_offset        = 0;
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t calculated_checksum       = 1;
+	uint32_t stored_checksum           = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_decoder->bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate decoder - missing bit stream.",
+		 function );
 
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -2129,26 +4323,18 @@ int deflate_decompress_zlib(
 
 		goto on_error;
 	}
-	if( bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit-stream.",
-		 function );
+	/* The bit stream is reset for every call
+	 */
+	bit_stream = deflate_decoder->bit_stream;
 
-		goto on_error;
-	}
-/* TODO add seek byte offset function */
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
 	bit_stream->byte_stream_offset = compressed_data_offset;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
 
-/* TODO find optimized solution to read bit stream from bytes */
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
 	{
 		if( deflate_read_block_header(
 		     bit_stream,
@@ -2165,62 +4351,9 @@ int deflate_decompress_zlib(
 
 			goto on_error;
 		}
-		if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
 		if( deflate_read_block(
-		     bit_stream,
+		     deflate_decoder,
 		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
 		     uncompressed_data,
 		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
@@ -2235,27 +4368,14 @@ int deflate_decompress_zlib(
 
 			goto on_error;
 		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
-	}
-	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
-	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
-		byte_stream_copy_to_uint32_big_endian(
-		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
-		 stored_checksum );
-
+		/* Update the checksum with the data of the block while it is still cached
+		 * instead of reading the uncompressed data again afterwards
+		 */
 		if( deflate_calculate_adler32(
 		     &calculated_checksum,
-		     uncompressed_data,
-		     uncompressed_data_offset,
-		     1,
+		     &( uncompressed_data[ checksum_data_offset ] ),
+		     uncompressed_data_offset - checksum_data_offset,
+		     calculated_checksum,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2267,6 +4387,25 @@ int deflate_decompress_zlib(
 
 			goto on_error;
 		}
+		checksum_data_offset = uncompressed_data_offset;
+
+		if( last_block_flag != 0 )
+		{
+			break;
+		}
+	}
+	/* Return the whole bytes that were read ahead into the bit buffer to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer          = 0;
+	bit_stream->bit_buffer_size     = 0;
+
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 stored_checksum );
+
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
@@ -2293,72 +4432,153 @@ int deflate_decompress_zlib(
 			goto on_error;
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		bit_stream->byte_stream      = NULL;
+		bit_stream->byte_stream_size = 0;
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	deflate_decoder_t *deflate_decoder = NULL;
+	static char *function              = "deflate_decompress";
+
+	if( deflate_decoder_initialize(
+	     &deflate_decoder,
+	     error ) != 1 )
 	{
-		if( huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate decoder.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( fixed_huffman_literals_tree != NULL )
+	if( deflate_decoder_decompress(
+	     deflate_decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
-		if( huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( bit_stream_free(
-	     &bit_stream,
+	if( deflate_decoder_free(
+	     &deflate_decoder,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit-stream.",
+		 "%s: unable to free deflate decoder.",
 		 function );
 
 		goto on_error;
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
-
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
+	if( deflate_decoder != NULL )
 	{
-		huffman_tree_free(
-		 &fixed_huffman_distances_tree,
+		deflate_decoder_free(
+		 &deflate_decoder,
 		 NULL );
 	}
-	if( fixed_huffman_literals_tree != NULL )
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decompress_zlib(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	deflate_decoder_t *deflate_decoder = NULL;
+	static char *function              = "deflate_decompress_zlib";
+
+	if( deflate_decoder_initialize(
+	     &deflate_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( deflate_decoder_decompress_zlib(
+	     deflate_decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
-		huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
 	}
-	if( bit_stream != NULL )
+	if( deflate_decoder_free(
+	     &deflate_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free deflate decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( deflate_decoder != NULL )
 	{
-		bit_stream_free(
-		 &bit_stream,
+		deflate_decoder_free(
+		 &deflate_decoder,
 		 NULL );
 	}
 	return( -1 );
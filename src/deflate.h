@@ -43,8 +43,87 @@ enum DEFLATE_BLOCK_TYPES
 	DEFLATE_BLOCK_TYPE_RESERVED		= 0x03
 };
 
+/* The maximum number of symbols in a compressed block
+ */
+#define DEFLATE_MAXIMUM_NUMBER_OF_BLOCK_SYMBOLS		16384
+
+/* The size of the sliding window
+ */
+#define DEFLATE_WINDOW_SIZE				32768
+
+/* The maximum size of a match
+ */
+#define DEFLATE_MAXIMUM_MATCH_SIZE			258
+
+/* The number of bits of the match finder hash value
+ */
+#define DEFLATE_HASH_NUMBER_OF_BITS			15
+
+typedef struct deflate_bit_writer deflate_bit_writer_t;
+
+struct deflate_bit_writer
+{
+	/* The byte stream
+	 */
+	uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The bit buffer
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+};
+
+typedef struct deflate_decoder deflate_decoder_t;
+
+struct deflate_decoder
+{
+	/* The bit stream, which references the compressed data of the current call
+	 */
+	bit_stream_t *bit_stream;
+
+	/* The pre-codes Huffman tree
+	 */
+	huffman_tree_t *pre_codes_huffman_tree;
+
+	/* The dynamic literals Huffman tree
+	 */
+	huffman_tree_t *literals_huffman_tree;
+
+	/* The dynamic distances Huffman tree
+	 */
+	huffman_tree_t *distances_huffman_tree;
+};
+
+extern const uint8_t deflate_code_sizes_sequence[ 19 ];
+
+extern const uint16_t deflate_literal_codes_base[ 29 ];
+
+extern const uint16_t deflate_literal_codes_number_of_extra_bits[ 29 ];
+
+extern const uint16_t deflate_distance_codes_base[ 30 ];
+
+extern const uint16_t deflate_distance_codes_number_of_extra_bits[ 30 ];
+
+extern const uint16_t deflate_compression_level_configurations[ 10 ][ 4 ];
+
+extern const huffman_tree_t deflate_fixed_literals_huffman_tree;
+
+extern const huffman_tree_t deflate_fixed_distances_huffman_tree;
+
 int deflate_build_dynamic_huffman_trees(
      bit_stream_t *bit_stream,
+     huffman_tree_t *pre_codes_huffman_tree,
      huffman_tree_t *literals_huffman_tree,
      huffman_tree_t *distances_huffman_tree,
      libcerror_error_t **error );
@@ -56,8 +135,17 @@ int deflate_build_fixed_huffman_trees(
 
 int deflate_decode_huffman(
      bit_stream_t *bit_stream,
-     huffman_tree_t *literals_huffman_tree,
-     huffman_tree_t *distances_huffman_tree,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int deflate_decode_huffman_verbose(
+     bit_stream_t *bit_stream,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
@@ -70,6 +158,66 @@ int deflate_calculate_adler32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int deflate_bit_writer_write_value(
+     deflate_bit_writer_t *bit_writer,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int deflate_bit_writer_flush(
+     deflate_bit_writer_t *bit_writer,
+     libcerror_error_t **error );
+
+int deflate_build_code_sizes(
+     const uint32_t *symbol_frequencies,
+     uint16_t number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error );
+
+int deflate_build_codes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     uint16_t *codes,
+     libcerror_error_t **error );
+
+int deflate_get_match_symbol(
+     uint16_t match_size,
+     uint16_t match_distance,
+     uint32_t *symbol,
+     libcerror_error_t **error );
+
+int deflate_write_stored_block(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t last_block_flag,
+     libcerror_error_t **error );
+
+int deflate_write_huffman_block(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     const uint32_t *symbols,
+     size_t number_of_symbols,
+     uint8_t last_block_flag,
+     libcerror_error_t **error );
+
+int deflate_write_blocks(
+     deflate_bit_writer_t *bit_writer,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t dictionary_size,
+     int compression_level,
+     uint8_t last_block_flag,
+     libcerror_error_t **error );
+
+int deflate_write_data_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
 int deflate_compress(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -91,15 +239,37 @@ int deflate_read_block_header(
      libcerror_error_t **error );
 
 int deflate_read_block(
-     bit_stream_t *bit_stream,
+     deflate_decoder_t *deflate_decoder,
      uint8_t block_type,
-     huffman_tree_t *literals_huffman_tree,
-     huffman_tree_t *distances_huffman_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+int deflate_decoder_initialize(
+     deflate_decoder_t **deflate_decoder,
+     libcerror_error_t **error );
+
+int deflate_decoder_free(
+     deflate_decoder_t **deflate_decoder,
+     libcerror_error_t **error );
+
+int deflate_decoder_decompress(
+     deflate_decoder_t *deflate_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int deflate_decoder_decompress_zlib(
+     deflate_decoder_t *deflate_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int deflate_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -0,0 +1,1635 @@
+/*
+ * Deflate (zlib) random access index functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "bit_stream.h"
+#include "deflate.h"
+#include "deflate_index.h"
+#include "deflate_stream.h"
+
+const uint8_t deflate_index_signature[ 8 ] = { 'D', 'E', 'F', 'L', 'I', 'D', 'X', 0 };
+
+/* Creates a deflate index
+ * Make sure the value deflate_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_initialize(
+     deflate_index_t **deflate_index,
+     uint8_t format,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_initialize";
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != DEFLATE_STREAM_FORMAT_RAW )
+	 && ( format != DEFLATE_STREAM_FORMAT_ZLIB ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_index = memory_allocate_structure(
+	                  deflate_index_t );
+
+	if( *deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_index,
+	     0,
+	     sizeof( deflate_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate index.",
+		 function );
+
+		memory_free(
+		 *deflate_index );
+
+		*deflate_index = NULL;
+
+		return( -1 );
+	}
+	( *deflate_index )->format = format;
+
+	if( deflate_stream_initialize(
+	     &( ( *deflate_index )->deflate_stream ),
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *deflate_index )->skip_buffer = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * DEFLATE_WINDOW_SIZE );
+
+	if( ( *deflate_index )->skip_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create skip buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *deflate_index != NULL )
+	{
+		deflate_index_free(
+		 deflate_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a deflate index
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_free(
+     deflate_index_t **deflate_index,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_free";
+	int result            = 1;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_index != NULL )
+	{
+		if( deflate_index_free_checkpoints(
+		     *deflate_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free checkpoints.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *deflate_index )->skip_buffer != NULL )
+		{
+			memory_free(
+			 ( *deflate_index )->skip_buffer );
+		}
+		if( ( *deflate_index )->deflate_stream != NULL )
+		{
+			if( deflate_stream_free(
+			     &( ( *deflate_index )->deflate_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free deflate stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *deflate_index );
+
+		*deflate_index = NULL;
+	}
+	return( result );
+}
+
+/* Frees the checkpoints of a deflate index
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_free_checkpoints(
+     deflate_index_t *deflate_index,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_free_checkpoints";
+	int checkpoint_index  = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->checkpoints != NULL )
+	{
+		for( checkpoint_index = 0;
+		     checkpoint_index < deflate_index->number_of_checkpoints;
+		     checkpoint_index++ )
+		{
+			if( deflate_index->checkpoints[ checkpoint_index ].window != NULL )
+			{
+				memory_free(
+				 deflate_index->checkpoints[ checkpoint_index ].window );
+			}
+		}
+		memory_free(
+		 deflate_index->checkpoints );
+
+		deflate_index->checkpoints = NULL;
+	}
+	deflate_index->number_of_checkpoints  = 0;
+	deflate_index->checkpoints_array_size = 0;
+	deflate_index->spacing                = 0;
+	deflate_index->compressed_data_size   = 0;
+	deflate_index->uncompressed_data_size = 0;
+	deflate_index->stream_is_positioned   = 0;
+
+	return( 1 );
+}
+
+/* Appends a checkpoint of the current state of the deflate stream
+ * The deflate stream must be at the start of a block
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_append_checkpoint(
+     deflate_index_t *deflate_index,
+     uint64_t compressed_offset,
+     libcerror_error_t **error )
+{
+	deflate_index_checkpoint_t *checkpoint  = NULL;
+	deflate_index_checkpoint_t *checkpoints = NULL;
+	deflate_stream_t *deflate_stream        = NULL;
+	static char *function                   = "deflate_index_append_checkpoint";
+	size_t array_size                       = 0;
+	size_t copy_size                        = 0;
+	size_t window_offset                    = 0;
+	size_t window_size                      = 0;
+	int checkpoints_array_size              = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream = deflate_index->deflate_stream;
+
+	if( deflate_stream->state != DEFLATE_STREAM_STATE_BLOCK_HEADER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported deflate stream state.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream->bit_stream->bit_buffer_size > 7 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->number_of_checkpoints >= deflate_index->checkpoints_array_size )
+	{
+		checkpoints_array_size = deflate_index->checkpoints_array_size * 2;
+
+		if( checkpoints_array_size == 0 )
+		{
+			checkpoints_array_size = 16;
+		}
+		array_size = sizeof( deflate_index_checkpoint_t ) * checkpoints_array_size;
+
+		checkpoints = (deflate_index_checkpoint_t *) memory_reallocate(
+		                                              deflate_index->checkpoints,
+		                                              array_size );
+
+		if( checkpoints == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize checkpoints.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_index->checkpoints            = checkpoints;
+		deflate_index->checkpoints_array_size = checkpoints_array_size;
+	}
+	window_size = DEFLATE_WINDOW_SIZE;
+
+	if( deflate_stream->uncompressed_size < (size64_t) window_size )
+	{
+		window_size = (size_t) deflate_stream->uncompressed_size;
+	}
+	checkpoint = &( deflate_index->checkpoints[ deflate_index->number_of_checkpoints ] );
+
+	checkpoint->compressed_offset   = compressed_offset;
+	checkpoint->uncompressed_offset = (uint64_t) deflate_stream->uncompressed_size;
+	checkpoint->checksum            = deflate_stream->calculated_checksum;
+	checkpoint->number_of_bits      = deflate_stream->bit_stream->bit_buffer_size;
+	checkpoint->bits                = (uint8_t) deflate_stream->bit_stream->bit_buffer;
+	checkpoint->window_size         = (uint16_t) window_size;
+	checkpoint->window              = NULL;
+
+	if( window_size > 0 )
+	{
+		checkpoint->window = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * window_size );
+
+		if( checkpoint->window == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create window.",
+			 function );
+
+			return( -1 );
+		}
+		/* Store the window starting with the oldest byte
+		 */
+		window_offset = ( deflate_stream->window_offset + DEFLATE_WINDOW_SIZE - window_size ) & ( DEFLATE_WINDOW_SIZE - 1 );
+		copy_size     = DEFLATE_WINDOW_SIZE - window_offset;
+
+		if( copy_size > window_size )
+		{
+			copy_size = window_size;
+		}
+		if( memory_copy(
+		     checkpoint->window,
+		     &( deflate_stream->window[ window_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window.",
+			 function );
+
+			goto on_error;
+		}
+		if( copy_size < window_size )
+		{
+			if( memory_copy(
+			     &( checkpoint->window[ copy_size ] ),
+			     deflate_stream->window,
+			     window_size - copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy window.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	deflate_index->number_of_checkpoints += 1;
+
+	return( 1 );
+
+on_error:
+	if( checkpoint->window != NULL )
+	{
+		memory_free(
+		 checkpoint->window );
+
+		checkpoint->window = NULL;
+	}
+	return( -1 );
+}
+
+/* Builds the index of DEFLATE compressed data
+ * A checkpoint is added at the start of the first block and at the start of every block
+ * that follows at least spacing bytes of uncompressed data after the previous checkpoint,
+ * a spacing of 0 adds a checkpoint at the start of every block that produced data
+ * Returns 1 on success or -1 on error
+ */
+int deflate_index_build(
+     deflate_index_t *deflate_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size64_t spacing,
+     libcerror_error_t **error )
+{
+	deflate_index_checkpoint_t *last_checkpoint = NULL;
+	deflate_stream_t *deflate_stream            = NULL;
+	static char *function                       = "deflate_index_build";
+	size_t compressed_data_offset               = 0;
+	size_t data_offset                          = 0;
+	int result                                  = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index_free_checkpoints(
+	     deflate_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream = deflate_index->deflate_stream;
+
+	if( deflate_stream_reset(
+	     deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	deflate_stream->stop_at_block_boundary = 1;
+
+	/* A raw stream starts with a block, a zlib stream stops at the first block
+	 * after the data header
+	 */
+	if( deflate_index->format == DEFLATE_STREAM_FORMAT_RAW )
+	{
+		if( deflate_index_append_checkpoint(
+		     deflate_index,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result == 0 )
+	{
+		data_offset = 0;
+
+		result = deflate_stream_decompress(
+		          deflate_stream,
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          deflate_index->skip_buffer,
+		          DEFLATE_WINDOW_SIZE,
+		          &data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		if( deflate_stream->block_boundary_reached != 0 )
+		{
+			if( deflate_index->number_of_checkpoints > 0 )
+			{
+				last_checkpoint = &( deflate_index->checkpoints[ deflate_index->number_of_checkpoints - 1 ] );
+
+				if( ( deflate_stream->uncompressed_size == last_checkpoint->uncompressed_offset )
+				 || ( ( deflate_stream->uncompressed_size - last_checkpoint->uncompressed_offset ) < spacing ) )
+				{
+					continue;
+				}
+			}
+			if( deflate_index_append_checkpoint(
+			     deflate_index,
+			     (uint64_t) compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( deflate_stream->uncompressed_data_full == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: compressed data is truncated.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	deflate_stream->stop_at_block_boundary = 0;
+
+	deflate_index->spacing                = spacing;
+	deflate_index->compressed_data_size   = (size64_t) compressed_data_offset;
+	deflate_index->uncompressed_data_size = deflate_stream->uncompressed_size;
+
+	return( 1 );
+
+on_error:
+	deflate_stream->stop_at_block_boundary = 0;
+
+	deflate_index_free_checkpoints(
+	 deflate_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of checkpoints
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_get_number_of_checkpoints(
+     deflate_index_t *deflate_index,
+     int *number_of_checkpoints,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_get_number_of_checkpoints";
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_checkpoints = deflate_index->number_of_checkpoints;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_get_uncompressed_data_size(
+     deflate_index_t *deflate_index,
+     size64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_get_uncompressed_data_size";
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = deflate_index->uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Restores the deflate stream to the state of a checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_restore_checkpoint(
+     deflate_index_t *deflate_index,
+     int checkpoint_index,
+     libcerror_error_t **error )
+{
+	deflate_index_checkpoint_t *checkpoint = NULL;
+	deflate_stream_t *deflate_stream       = NULL;
+	static char *function                  = "deflate_index_restore_checkpoint";
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint_index < 0 )
+	 || ( checkpoint_index >= deflate_index->number_of_checkpoints ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint     = &( deflate_index->checkpoints[ checkpoint_index ] );
+	deflate_stream = deflate_index->deflate_stream;
+
+	deflate_index->stream_is_positioned = 0;
+
+	if( deflate_stream_reset(
+	     deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->window_size > 0 )
+	{
+		if( memory_copy(
+		     deflate_stream->window,
+		     checkpoint->window,
+		     (size_t) checkpoint->window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	deflate_stream->state                       = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	deflate_stream->bit_stream->bit_buffer      = (uint64_t) checkpoint->bits;
+	deflate_stream->bit_stream->bit_buffer_size = checkpoint->number_of_bits;
+	deflate_stream->window_offset               = (size_t) checkpoint->window_size & ( DEFLATE_WINDOW_SIZE - 1 );
+	deflate_stream->uncompressed_size           = (size64_t) checkpoint->uncompressed_offset;
+	deflate_stream->calculated_checksum         = checkpoint->checksum;
+
+	deflate_index->current_compressed_offset = checkpoint->compressed_offset;
+	deflate_index->stream_is_positioned      = 1;
+
+	return( 1 );
+}
+
+/* Continues decoding the deflate stream at its current position
+ * On return the uncompressed data offset contains the uncompressed data produced
+ * Returns 1 on success or -1 on error
+ */
+int deflate_index_decompress(
+     deflate_index_t *deflate_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function         = "deflate_index_decompress";
+	size_t compressed_data_offset = 0;
+	size_t data_offset            = 0;
+	int result                    = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->stream_is_positioned == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate index - deflate stream not positioned.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->current_compressed_offset > (uint64_t) compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid deflate index - current compressed offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = (size_t) deflate_index->current_compressed_offset;
+	data_offset            = *uncompressed_data_offset;
+
+	while( data_offset < uncompressed_data_size )
+	{
+		result = deflate_stream_decompress(
+		          deflate_index->deflate_stream,
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		if( ( deflate_index->deflate_stream->uncompressed_data_full == 0 )
+		 && ( deflate_index->deflate_stream->block_boundary_reached == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: compressed data is truncated.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	deflate_index->current_compressed_offset = (uint64_t) compressed_data_offset;
+
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+
+on_error:
+	deflate_index->stream_is_positioned = 0;
+
+	return( -1 );
+}
+
+/* Reads uncompressed data at a specific offset
+ * The compressed data must contain the same DEFLATE compressed data the index was built from,
+ * decoding resumes at the nearest checkpoint preceding the offset or continues from
+ * the end of the previous read if that is closer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t deflate_index_read_buffer_at_offset(
+         deflate_index_t *deflate_index,
+         const uint8_t *compressed_data,
+         size_t compressed_data_size,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         off64_t uncompressed_offset,
+         libcerror_error_t **error )
+{
+	static char *function      = "deflate_index_read_buffer_at_offset";
+	size64_t current_offset    = 0;
+	size64_t remaining_size    = 0;
+	size_t data_offset         = 0;
+	size_t read_size           = 0;
+	size_t skip_size           = 0;
+	int checkpoint_index       = 0;
+	int lower_checkpoint_index = 0;
+	int upper_checkpoint_index = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->number_of_checkpoints == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate index - missing checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size > (size_t) SSIZE_MAX )
+	 || ( (size64_t) compressed_data_size < deflate_index->compressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) uncompressed_offset >= deflate_index->uncompressed_data_size )
+	{
+		return( 0 );
+	}
+	remaining_size = deflate_index->uncompressed_data_size - (size64_t) uncompressed_offset;
+
+	if( (size64_t) uncompressed_data_size > remaining_size )
+	{
+		uncompressed_data_size = (size_t) remaining_size;
+	}
+	/* Find the last checkpoint at or before the offset
+	 */
+	lower_checkpoint_index = 0;
+	upper_checkpoint_index = deflate_index->number_of_checkpoints;
+
+	while( ( upper_checkpoint_index - lower_checkpoint_index ) > 1 )
+	{
+		checkpoint_index = lower_checkpoint_index + ( ( upper_checkpoint_index - lower_checkpoint_index ) / 2 );
+
+		if( deflate_index->checkpoints[ checkpoint_index ].uncompressed_offset <= (uint64_t) uncompressed_offset )
+		{
+			lower_checkpoint_index = checkpoint_index;
+		}
+		else
+		{
+			upper_checkpoint_index = checkpoint_index;
+		}
+	}
+	checkpoint_index = lower_checkpoint_index;
+
+	/* Continue from the end of the previous read if it is between the checkpoint and the offset
+	 */
+	current_offset = deflate_index->deflate_stream->uncompressed_size;
+
+	if( ( deflate_index->stream_is_positioned == 0 )
+	 || ( current_offset > (size64_t) uncompressed_offset )
+	 || ( current_offset < deflate_index->checkpoints[ checkpoint_index ].uncompressed_offset ) )
+	{
+		if( deflate_index_restore_checkpoint(
+		     deflate_index,
+		     checkpoint_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to restore checkpoint: %d.",
+			 function,
+			 checkpoint_index );
+
+			return( -1 );
+		}
+		current_offset = deflate_index->deflate_stream->uncompressed_size;
+	}
+	while( current_offset < (size64_t) uncompressed_offset )
+	{
+		skip_size = DEFLATE_WINDOW_SIZE;
+
+		if( (size64_t) skip_size > ( (size64_t) uncompressed_offset - current_offset ) )
+		{
+			skip_size = (size_t) ( (size64_t) uncompressed_offset - current_offset );
+		}
+		data_offset = 0;
+
+		if( deflate_index_decompress(
+		     deflate_index,
+		     compressed_data,
+		     compressed_data_size,
+		     deflate_index->skip_buffer,
+		     skip_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to skip uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_offset != skip_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to skip uncompressed data - premature end of stream.",
+			 function );
+
+			deflate_index->stream_is_positioned = 0;
+
+			return( -1 );
+		}
+		current_offset += skip_size;
+	}
+	if( deflate_index_decompress(
+	     deflate_index,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to read uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
+/* Retrieves the size of the stored index
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_get_data_size(
+     deflate_index_t *deflate_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_get_data_size";
+	size_t safe_data_size = 0;
+	int checkpoint_index  = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < deflate_index->number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		safe_data_size += DEFLATE_INDEX_CHECKPOINT_SIZE + deflate_index->checkpoints[ checkpoint_index ].window_size;
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the index to a buffer
+ * The stored index consists of a 40-byte header followed by the checkpoints,
+ * each checkpoint is a 24-byte entry followed by its window. All values are little-endian.
+ *
+ * header:
+ *   0 signature "DEFLIDX\0"
+ *   8 format version (16-bit)
+ *  10 stream format (8-bit)
+ *  11 unknown (reserved, 0)
+ *  12 number of checkpoints (32-bit)
+ *  16 compressed data size (64-bit)
+ *  24 uncompressed data size (64-bit)
+ *  32 spacing (64-bit)
+ *
+ * checkpoint:
+ *   0 compressed offset (64-bit)
+ *   8 uncompressed offset (64-bit)
+ *  16 checksum (32-bit)
+ *  20 number of bits (8-bit)
+ *  21 bits (8-bit)
+ *  22 window size (16-bit)
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_write_data(
+     deflate_index_t *deflate_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	deflate_index_checkpoint_t *checkpoint = NULL;
+	static char *function                  = "deflate_index_write_data";
+	size_t data_offset                     = 0;
+	size_t required_data_size              = 0;
+	int checkpoint_index                   = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index->number_of_checkpoints == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate index - missing checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index_get_data_size(
+	     deflate_index,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     deflate_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 8 ] ),
+	 DEFLATE_INDEX_FORMAT_VERSION );
+
+	data[ 10 ] = deflate_index->format;
+	data[ 11 ] = 0;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 deflate_index->number_of_checkpoints );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 deflate_index->compressed_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 deflate_index->uncompressed_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 32 ] ),
+	 deflate_index->spacing );
+
+	data_offset = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < deflate_index->number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		checkpoint = &( deflate_index->checkpoints[ checkpoint_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 checkpoint->compressed_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 checkpoint->uncompressed_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 checkpoint->checksum );
+
+		data[ data_offset + 20 ] = checkpoint->number_of_bits;
+		data[ data_offset + 21 ] = checkpoint->bits;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data[ data_offset + 22 ] ),
+		 checkpoint->window_size );
+
+		data_offset += DEFLATE_INDEX_CHECKPOINT_SIZE;
+
+		if( checkpoint->window_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     checkpoint->window,
+			     (size_t) checkpoint->window_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy window.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += checkpoint->window_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index from a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_read_data(
+     deflate_index_t *deflate_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	deflate_index_checkpoint_t *checkpoint = NULL;
+	static char *function                  = "deflate_index_read_data";
+	size64_t compressed_data_size          = 0;
+	size64_t spacing                       = 0;
+	size64_t uncompressed_data_size        = 0;
+	size_t data_offset                     = 0;
+	size_t window_size                     = 0;
+	uint64_t previous_uncompressed_offset  = 0;
+	uint32_t number_of_checkpoints         = 0;
+	uint16_t format_version                = 0;
+	uint32_t checkpoint_index              = 0;
+
+	if( deflate_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < DEFLATE_INDEX_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     deflate_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	if( format_version != DEFLATE_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu16 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( data[ 10 ] != deflate_index->format )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stream format: %" PRIu8 ".",
+		 function,
+		 data[ 10 ] );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 number_of_checkpoints );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 compressed_data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 uncompressed_data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 32 ] ),
+	 spacing );
+
+	if( ( number_of_checkpoints == 0 )
+	 || ( number_of_checkpoints > (uint32_t) ( ( data_size - DEFLATE_INDEX_HEADER_SIZE ) / DEFLATE_INDEX_CHECKPOINT_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of checkpoints value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index_free_checkpoints(
+	     deflate_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_index->checkpoints = (deflate_index_checkpoint_t *) memory_allocate(
+	                                                             sizeof( deflate_index_checkpoint_t ) * number_of_checkpoints );
+
+	if( deflate_index->checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoints.",
+		 function );
+
+		goto on_error;
+	}
+	deflate_index->checkpoints_array_size = (int) number_of_checkpoints;
+
+	data_offset = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( DEFLATE_INDEX_CHECKPOINT_SIZE > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint = &( deflate_index->checkpoints[ checkpoint_index ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 checkpoint->compressed_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 checkpoint->uncompressed_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 checkpoint->checksum );
+
+		checkpoint->number_of_bits = data[ data_offset + 20 ];
+		checkpoint->bits           = data[ data_offset + 21 ];
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset + 22 ] ),
+		 checkpoint->window_size );
+
+		checkpoint->window = NULL;
+
+		/* The checkpoint is counted before its window is read so that on error the window is freed
+		 */
+		deflate_index->number_of_checkpoints += 1;
+
+		data_offset += DEFLATE_INDEX_CHECKPOINT_SIZE;
+
+		window_size = DEFLATE_WINDOW_SIZE;
+
+		if( checkpoint->uncompressed_offset < (uint64_t) window_size )
+		{
+			window_size = (size_t) checkpoint->uncompressed_offset;
+		}
+		if( ( ( checkpoint_index == 0 )
+		  &&  ( checkpoint->uncompressed_offset != 0 ) )
+		 || ( ( checkpoint_index > 0 )
+		  &&  ( checkpoint->uncompressed_offset <= previous_uncompressed_offset ) )
+		 || ( checkpoint->uncompressed_offset > uncompressed_data_size )
+		 || ( checkpoint->compressed_offset > compressed_data_size )
+		 || ( checkpoint->number_of_bits > 7 )
+		 || ( (size_t) checkpoint->window_size != window_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid checkpoint: %" PRIu32 " value out of bounds.",
+			 function,
+			 checkpoint_index );
+
+			goto on_error;
+		}
+		previous_uncompressed_offset = checkpoint->uncompressed_offset;
+
+		if( window_size > 0 )
+		{
+			if( window_size > ( data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			checkpoint->window = (uint8_t *) memory_allocate(
+			                                  sizeof( uint8_t ) * window_size );
+
+			if( checkpoint->window == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create window.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     checkpoint->window,
+			     &( data[ data_offset ] ),
+			     window_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy window.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += window_size;
+		}
+	}
+	deflate_index->spacing                = spacing;
+	deflate_index->compressed_data_size   = compressed_data_size;
+	deflate_index->uncompressed_data_size = uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	deflate_index_free_checkpoints(
+	 deflate_index,
+	 NULL );
+
+	return( -1 );
+}
@@ -0,0 +1,214 @@
+/*
+ * Deflate (zlib) random access index functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_INDEX_H )
+#define _DEFLATE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The format version of the stored index
+ */
+#define DEFLATE_INDEX_FORMAT_VERSION			1
+
+/* The size of the header of the stored index
+ */
+#define DEFLATE_INDEX_HEADER_SIZE			40
+
+/* The size of a checkpoint of the stored index, without the window
+ */
+#define DEFLATE_INDEX_CHECKPOINT_SIZE			24
+
+extern const uint8_t deflate_index_signature[ 8 ];
+
+typedef struct deflate_index_checkpoint deflate_index_checkpoint_t;
+
+struct deflate_index_checkpoint
+{
+	/* The offset of the compressed data of the block following the checkpoint
+	 * This offset is of the first whole byte of the block
+	 */
+	uint64_t compressed_offset;
+
+	/* The offset of the uncompressed data
+	 */
+	uint64_t uncompressed_offset;
+
+	/* The checksum of the uncompressed data preceding the checkpoint
+	 */
+	uint32_t checksum;
+
+	/* The number of bits of the byte preceding the compressed offset
+	 * that are part of the block
+	 */
+	uint8_t number_of_bits;
+
+	/* The value of the bits of the byte preceding the compressed offset
+	 */
+	uint8_t bits;
+
+	/* The window size
+	 */
+	uint16_t window_size;
+
+	/* The window, which contains the last window size bytes
+	 * of the uncompressed data preceding the checkpoint
+	 */
+	uint8_t *window;
+};
+
+typedef struct deflate_index deflate_index_t;
+
+struct deflate_index
+{
+	/* The stream format
+	 */
+	uint8_t format;
+
+	/* The minimum distance between checkpoints in the uncompressed data
+	 */
+	size64_t spacing;
+
+	/* The size of the compressed data
+	 */
+	size64_t compressed_data_size;
+
+	/* The size of the uncompressed data
+	 */
+	size64_t uncompressed_data_size;
+
+	/* The checkpoints
+	 */
+	deflate_index_checkpoint_t *checkpoints;
+
+	/* The number of checkpoints
+	 */
+	int number_of_checkpoints;
+
+	/* The number of allocated checkpoints
+	 */
+	int checkpoints_array_size;
+
+	/* The deflate stream
+	 */
+	deflate_stream_t *deflate_stream;
+
+	/* The buffer used to skip uncompressed data
+	 */
+	uint8_t *skip_buffer;
+
+	/* Value to indicate the deflate stream is positioned to continue decoding
+	 */
+	uint8_t stream_is_positioned;
+
+	/* The offset of the compressed data at which the deflate stream continues decoding
+	 */
+	uint64_t current_compressed_offset;
+};
+
+int deflate_index_initialize(
+     deflate_index_t **deflate_index,
+     uint8_t format,
+     libcerror_error_t **error );
+
+int deflate_index_free(
+     deflate_index_t **deflate_index,
+     libcerror_error_t **error );
+
+int deflate_index_free_checkpoints(
+     deflate_index_t *deflate_index,
+     libcerror_error_t **error );
+
+int deflate_index_append_checkpoint(
+     deflate_index_t *deflate_index,
+     uint64_t compressed_offset,
+     libcerror_error_t **error );
+
+int deflate_index_build(
+     deflate_index_t *deflate_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size64_t spacing,
+     libcerror_error_t **error );
+
+int deflate_index_get_number_of_checkpoints(
+     deflate_index_t *deflate_index,
+     int *number_of_checkpoints,
+     libcerror_error_t **error );
+
+int deflate_index_get_uncompressed_data_size(
+     deflate_index_t *deflate_index,
+     size64_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int deflate_index_restore_checkpoint(
+     deflate_index_t *deflate_index,
+     int checkpoint_index,
+     libcerror_error_t **error );
+
+int deflate_index_decompress(
+     deflate_index_t *deflate_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+ssize_t deflate_index_read_buffer_at_offset(
+         deflate_index_t *deflate_index,
+         const uint8_t *compressed_data,
+         size_t compressed_data_size,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         off64_t uncompressed_offset,
+         libcerror_error_t **error );
+
+int deflate_index_get_data_size(
+     deflate_index_t *deflate_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int deflate_index_write_data(
+     deflate_index_t *deflate_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int deflate_index_read_data(
+     deflate_index_t *deflate_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_INDEX_H ) */
+
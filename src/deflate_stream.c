@@ -0,0 +1,1931 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "bit_stream.h"
+#include "deflate.h"
+#include "deflate_stream.h"
+#include "huffman_tree.h"
+#include "match_copy.h"
+
+/* Creates a deflate stream
+ * Make sure the value deflate_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_initialize(
+     deflate_stream_t **deflate_stream,
+     uint8_t format,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_initialize";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != DEFLATE_STREAM_FORMAT_RAW )
+	 && ( format != DEFLATE_STREAM_FORMAT_ZLIB ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_stream = memory_allocate_structure(
+	                   deflate_stream_t );
+
+	if( *deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_stream,
+	     0,
+	     sizeof( deflate_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate stream.",
+		 function );
+
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+
+		return( -1 );
+	}
+	( *deflate_stream )->format = format;
+
+	if( bit_stream_initialize(
+	     &( ( *deflate_stream )->bit_stream ),
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *deflate_stream )->window = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * DEFLATE_WINDOW_SIZE );
+
+	if( ( *deflate_stream )->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_stream )->pre_codes_huffman_tree ),
+	     19,
+	     7,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pre-codes Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_stream )->dynamic_literals_huffman_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( huffman_tree_initialize(
+	     &( ( *deflate_stream )->dynamic_distances_huffman_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( deflate_stream_reset(
+	     *deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to reset deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *deflate_stream != NULL )
+	{
+		deflate_stream_free(
+		 deflate_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_free(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_free";
+	int result            = 1;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		if( ( *deflate_stream )->dynamic_distances_huffman_tree != NULL )
+		{
+			if( huffman_tree_free(
+			     &( ( *deflate_stream )->dynamic_distances_huffman_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic distances Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_stream )->dynamic_literals_huffman_tree != NULL )
+		{
+			if( huffman_tree_free(
+			     &( ( *deflate_stream )->dynamic_literals_huffman_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic literals Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_stream )->pre_codes_huffman_tree != NULL )
+		{
+			if( huffman_tree_free(
+			     &( ( *deflate_stream )->pre_codes_huffman_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pre-codes Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_stream )->window != NULL )
+		{
+			memory_free(
+			 ( *deflate_stream )->window );
+		}
+		if( ( *deflate_stream )->bit_stream != NULL )
+		{
+			if( bit_stream_free(
+			     &( ( *deflate_stream )->bit_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bit stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+	}
+	return( result );
+}
+
+/* Resets a deflate stream to decompress a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_reset(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_reset";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream->bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate stream - missing bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream->format == DEFLATE_STREAM_FORMAT_ZLIB )
+	{
+		deflate_stream->state = DEFLATE_STREAM_STATE_DATA_HEADER;
+	}
+	else
+	{
+		deflate_stream->state = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	}
+	deflate_stream->bit_stream->byte_stream        = NULL;
+	deflate_stream->bit_stream->byte_stream_size   = 0;
+	deflate_stream->bit_stream->byte_stream_offset = 0;
+	deflate_stream->bit_stream->bit_buffer         = 0;
+	deflate_stream->bit_stream->bit_buffer_size    = 0;
+
+	deflate_stream->last_block_flag                = 0;
+	deflate_stream->uncompressed_block_size        = 0;
+	deflate_stream->literals_huffman_tree          = NULL;
+	deflate_stream->distances_huffman_tree         = NULL;
+	deflate_stream->match_size                     = 0;
+	deflate_stream->match_distance                 = 0;
+	deflate_stream->block_boundary_reached         = 0;
+	deflate_stream->window_offset                  = 0;
+	deflate_stream->uncompressed_data_start_offset = 0;
+	deflate_stream->uncompressed_size              = 0;
+	deflate_stream->calculated_checksum            = 1;
+
+	return( 1 );
+}
+
+/* Retrieves a value from the bit stream of the deflate stream
+ * The bits are only consumed if the bit stream contains sufficient bits
+ * Returns 1 on success, 0 if more compressed data is needed or -1 on error
+ */
+int deflate_stream_get_value(
+     deflate_stream_t *deflate_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream = NULL;
+	static char *function    = "deflate_stream_get_value";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = deflate_stream->bit_stream;
+
+	if( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		if( bit_stream_refill(
+		     bit_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to refill bit buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( bit_stream->bit_buffer_size < number_of_bits )
+		{
+			return( 0 );
+		}
+	}
+	*value_32bit = bit_stream_back_to_front_peek_value(
+	                bit_stream,
+	                number_of_bits );
+
+	bit_stream_back_to_front_consume(
+	 bit_stream,
+	 number_of_bits );
+
+	return( 1 );
+}
+
+/* Adds the uncompressed data of the current call to the sliding window and the checksum
+ * Only the uncompressed data from the uncompressed data start offset up to
+ * the uncompressed data offset is added
+ * Returns 1 on success or -1 on error
+ */
+int deflate_stream_update_window(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_update_window";
+	size_t copy_size      = 0;
+	size_t data_size      = 0;
+	size_t start_offset   = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	start_offset = deflate_stream->uncompressed_data_start_offset;
+
+	if( uncompressed_data_offset < start_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = uncompressed_data_offset - start_offset;
+
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( deflate_stream->format == DEFLATE_STREAM_FORMAT_ZLIB )
+	{
+		if( deflate_calculate_adler32(
+		     &( deflate_stream->calculated_checksum ),
+		     &( uncompressed_data[ start_offset ] ),
+		     data_size,
+		     deflate_stream->calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_size >= DEFLATE_WINDOW_SIZE )
+	{
+		if( memory_copy(
+		     deflate_stream->window,
+		     &( uncompressed_data[ uncompressed_data_offset - DEFLATE_WINDOW_SIZE ] ),
+		     DEFLATE_WINDOW_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data to window.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_stream->window_offset = 0;
+	}
+	else
+	{
+		copy_size = DEFLATE_WINDOW_SIZE - deflate_stream->window_offset;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( deflate_stream->window[ deflate_stream->window_offset ] ),
+		     &( uncompressed_data[ start_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data to window.",
+			 function );
+
+			return( -1 );
+		}
+		if( copy_size < data_size )
+		{
+			if( memory_copy(
+			     deflate_stream->window,
+			     &( uncompressed_data[ start_offset + copy_size ] ),
+			     data_size - copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data to window.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		deflate_stream->window_offset = ( deflate_stream->window_offset + data_size ) & ( DEFLATE_WINDOW_SIZE - 1 );
+	}
+	deflate_stream->uncompressed_size             += data_size;
+	deflate_stream->uncompressed_data_start_offset = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Reads the zlib compressed data header
+ * Returns 1 on success, 0 if more compressed data is needed or -1 on error
+ */
+int deflate_stream_read_data_header(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 2 ];
+
+	static char *function         = "deflate_stream_read_data_header";
+	size_t compressed_data_offset = 0;
+	uint32_t value_32bit          = 0;
+	int result                    = 0;
+
+	result = deflate_stream_get_value(
+	          deflate_stream,
+	          16,
+	          &value_32bit,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+		}
+		return( result );
+	}
+	header_data[ 0 ] = (uint8_t) ( value_32bit & 0x000000ffUL );
+	header_data[ 1 ] = (uint8_t) ( value_32bit >> 8 );
+
+	if( ( ( ( (uint16_t) header_data[ 0 ] << 8 ) | header_data[ 1 ] ) % 31 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: invalid data header check bits.",
+		 function );
+
+		return( -1 );
+	}
+	/* The preset dictionary is not available to the decoder
+	 */
+	if( ( header_data[ 1 ] & 0x20 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported preset dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_read_data_header(
+	     header_data,
+	     2,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data header.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream->state = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+
+	return( 1 );
+}
+
+/* Reads the header of a block of compressed data
+ * Returns 1 on success, 0 if more compressed data is needed or -1 on error
+ */
+int deflate_stream_read_block_header(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_read_block_header";
+	uint32_t value_32bit  = 0;
+	uint8_t block_type    = 0;
+	int result            = 0;
+
+	result = deflate_stream_get_value(
+	          deflate_stream,
+	          3,
+	          &value_32bit,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+		}
+		return( result );
+	}
+	deflate_stream->last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
+	block_type                      = (uint8_t) ( value_32bit >> 1 );
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block header last block flag\t\t\t: %" PRIu8 "\n",
+		 function,
+		 deflate_stream->last_block_flag );
+
+		libcnotify_printf(
+		 "%s: block header block type\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 block_type );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	switch( block_type )
+	{
+		case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+			deflate_stream->state = DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER;
+
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+			deflate_stream->literals_huffman_tree  = &deflate_fixed_literals_huffman_tree;
+			deflate_stream->distances_huffman_tree = &deflate_fixed_distances_huffman_tree;
+			deflate_stream->state                  = DEFLATE_STREAM_STATE_HUFFMAN_DATA;
+
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			deflate_stream->state = DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER;
+
+			break;
+
+		case DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads an uncompressed block of compressed data
+ * Returns 1 on success, 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int deflate_stream_read_uncompressed_block(
+     deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream = NULL;
+	static char *function    = "deflate_stream_read_uncompressed_block";
+	size_t copy_size         = 0;
+	size_t data_offset       = 0;
+	uint32_t block_size      = 0;
+	uint32_t block_size_copy = 0;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = deflate_stream->bit_stream;
+
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER )
+	{
+		/* Ignore the bits in the buffer upto the next byte
+		 */
+		bit_stream_back_to_front_consume(
+		 bit_stream,
+		 bit_stream->bit_buffer_size & 0x07 );
+
+		result = deflate_stream_get_value(
+		          deflate_stream,
+		          32,
+		          &value_32bit,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+			}
+			return( result );
+		}
+		block_size      = value_32bit & 0x0000ffffUL;
+		block_size_copy = ( value_32bit >> 16 ) ^ 0x0000ffffUL;
+
+		if( block_size != block_size_copy )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 block_size,
+			 block_size_copy );
+
+			return( -1 );
+		}
+		deflate_stream->uncompressed_block_size = (uint16_t) block_size;
+		deflate_stream->state                   = DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA;
+	}
+	data_offset = *uncompressed_data_offset;
+
+	while( ( deflate_stream->uncompressed_block_size > 0 )
+	    && ( data_offset < uncompressed_data_size ) )
+	{
+		/* The bit buffer is byte aligned and can contain bytes that were read ahead
+		 */
+		if( bit_stream->bit_buffer_size >= 8 )
+		{
+			uncompressed_data[ data_offset++ ] = (uint8_t) bit_stream_back_to_front_peek_value(
+			                                                bit_stream,
+			                                                8 );
+
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 8 );
+
+			deflate_stream->uncompressed_block_size -= 1;
+
+			continue;
+		}
+		copy_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+		if( copy_size > (size_t) deflate_stream->uncompressed_block_size )
+		{
+			copy_size = (size_t) deflate_stream->uncompressed_block_size;
+		}
+		if( copy_size > ( uncompressed_data_size - data_offset ) )
+		{
+			copy_size = uncompressed_data_size - data_offset;
+		}
+		if( copy_size == 0 )
+		{
+			break;
+		}
+		if( memory_copy(
+		     &( uncompressed_data[ data_offset ] ),
+		     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed block data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->byte_stream_offset          += copy_size;
+		data_offset                             += copy_size;
+		deflate_stream->uncompressed_block_size -= (uint16_t) copy_size;
+	}
+	*uncompressed_data_offset = data_offset;
+
+	if( deflate_stream->uncompressed_block_size > 0 )
+	{
+		if( data_offset >= uncompressed_data_size )
+		{
+			deflate_stream->uncompressed_data_full = 1;
+		}
+		return( 0 );
+	}
+	if( deflate_stream->last_block_flag == 0 )
+	{
+		deflate_stream->state = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	}
+	else if( deflate_stream->format == DEFLATE_STREAM_FORMAT_ZLIB )
+	{
+		deflate_stream->state = DEFLATE_STREAM_STATE_DATA_FOOTER;
+	}
+	else
+	{
+		deflate_stream->state = DEFLATE_STREAM_STATE_END;
+	}
+	return( 1 );
+}
+
+/* Reads and builds the dynamic Huffman trees
+ * Returns 1 on success, 0 if more compressed data is needed or -1 on error
+ */
+int deflate_stream_read_dynamic_huffman_trees(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream     = NULL;
+	static char *function        = "deflate_stream_read_dynamic_huffman_trees";
+	uint32_t code_size           = 0;
+	uint32_t symbol              = 0;
+	uint32_t times_to_repeat     = 0;
+	uint32_t value_32bit         = 0;
+	uint8_t number_of_extra_bits = 0;
+	uint8_t symbol_code_size     = 0;
+	int result                   = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = deflate_stream->bit_stream;
+
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER )
+	{
+		result = deflate_stream_get_value(
+		          deflate_stream,
+		          14,
+		          &value_32bit,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+			}
+			return( result );
+		}
+		deflate_stream->number_of_literal_codes  = (uint16_t) ( value_32bit & 0x0000001fUL ) + 257;
+		deflate_stream->number_of_distance_codes = (uint16_t) ( ( value_32bit >> 5 ) & 0x0000001fUL ) + 1;
+		deflate_stream->number_of_code_sizes     = (uint16_t) ( value_32bit >> 10 ) + 4;
+
+		if( deflate_stream->number_of_literal_codes > 286 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of literal codes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_stream->number_of_distance_codes > 30 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of distance codes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_stream->code_size_index = 0;
+		deflate_stream->state           = DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_PRE_CODE_SIZES;
+	}
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_PRE_CODE_SIZES )
+	{
+		while( deflate_stream->code_size_index < deflate_stream->number_of_code_sizes )
+		{
+			result = deflate_stream_get_value(
+			          deflate_stream,
+			          3,
+			          &code_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value from bit stream.",
+					 function );
+				}
+				return( result );
+			}
+			symbol = deflate_code_sizes_sequence[ deflate_stream->code_size_index++ ];
+
+			deflate_stream->code_size_array[ symbol ] = (uint8_t) code_size;
+		}
+		while( deflate_stream->code_size_index < 19 )
+		{
+			symbol = deflate_code_sizes_sequence[ deflate_stream->code_size_index++ ];
+
+			deflate_stream->code_size_array[ symbol ] = 0;
+		}
+		if( huffman_tree_build(
+		     deflate_stream->pre_codes_huffman_tree,
+		     deflate_stream->code_size_array,
+		     19,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build pre-codes Huffman tree.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_stream->number_of_code_sizes = deflate_stream->number_of_literal_codes
+		                                     + deflate_stream->number_of_distance_codes;
+		deflate_stream->code_size_index      = 0;
+		deflate_stream->state                = DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_CODE_SIZES;
+	}
+	while( deflate_stream->code_size_index < deflate_stream->number_of_code_sizes )
+	{
+		/* A pre-code with its extra bits is at most 14 bits
+		 */
+		if( bit_stream->bit_buffer_size < 14 )
+		{
+			if( bit_stream_refill(
+			     bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to refill bit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = huffman_tree_get_symbol_from_bit_buffer(
+		          deflate_stream->pre_codes_huffman_tree,
+		          bit_stream->bit_buffer,
+		          bit_stream->bit_buffer_size,
+		          &symbol,
+		          &symbol_code_size,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from pre-codes Huffman tree.",
+				 function );
+			}
+			return( result );
+		}
+		if( symbol < 16 )
+		{
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 symbol_code_size );
+
+			deflate_stream->code_size_array[ deflate_stream->code_size_index++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		if( symbol == 16 )
+		{
+			if( deflate_stream->code_size_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid code size index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			code_size            = deflate_stream->code_size_array[ deflate_stream->code_size_index - 1 ];
+			number_of_extra_bits = 2;
+			times_to_repeat      = 3;
+		}
+		else if( symbol == 17 )
+		{
+			code_size            = 0;
+			number_of_extra_bits = 3;
+			times_to_repeat      = 3;
+		}
+		else if( symbol == 18 )
+		{
+			code_size            = 0;
+			number_of_extra_bits = 7;
+			times_to_repeat      = 11;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size symbol value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( symbol_code_size + number_of_extra_bits ) > bit_stream->bit_buffer_size )
+		{
+			return( 0 );
+		}
+		times_to_repeat += (uint32_t) ( bit_stream->bit_buffer >> symbol_code_size ) & bit_stream_mask_64bit( number_of_extra_bits );
+
+		bit_stream_back_to_front_consume(
+		 bit_stream,
+		 symbol_code_size + number_of_extra_bits );
+
+		if( times_to_repeat > (uint32_t) ( deflate_stream->number_of_code_sizes - deflate_stream->code_size_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid times to repeat value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		while( times_to_repeat > 0 )
+		{
+			deflate_stream->code_size_array[ deflate_stream->code_size_index++ ] = (uint8_t) code_size;
+
+			times_to_repeat--;
+		}
+	}
+	if( deflate_stream->code_size_array[ 256 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: end-of-block code value missing in literal codes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree_build(
+	     deflate_stream->dynamic_literals_huffman_tree,
+	     deflate_stream->code_size_array,
+	     (int) deflate_stream->number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* A block that only contains literals can have no distance codes
+	 */
+	if( huffman_tree_build(
+	     deflate_stream->dynamic_distances_huffman_tree,
+	     &( deflate_stream->code_size_array[ deflate_stream->number_of_literal_codes ] ),
+	     (int) deflate_stream->number_of_distance_codes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream->literals_huffman_tree  = deflate_stream->dynamic_literals_huffman_tree;
+	deflate_stream->distances_huffman_tree = deflate_stream->dynamic_distances_huffman_tree;
+	deflate_stream->state                  = DEFLATE_STREAM_STATE_HUFFMAN_DATA;
+
+	return( 1 );
+}
+
+/* Decodes Huffman encoded compressed data up to the end of the block
+ * A literal or a match is only consumed from the bit stream if all its bits are available
+ * and a match that does not fit in the uncompressed data is continued in the next call
+ * Returns 1 on success, 0 if more compressed data or uncompressed data space is needed or -1 on error
+ */
+int deflate_stream_decode_huffman(
+     deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream     = NULL;
+	static char *function        = "deflate_stream_decode_huffman";
+	size_t copy_size             = 0;
+	size_t data_offset           = 0;
+	size_t history_size          = 0;
+	size_t window_index          = 0;
+	uint64_t bit_buffer          = 0;
+	uint32_t symbol              = 0;
+	uint16_t match_distance      = 0;
+	uint16_t match_size          = 0;
+	uint8_t bit_buffer_size      = 0;
+	uint8_t code_size            = 0;
+	uint8_t number_of_bits       = 0;
+	uint8_t number_of_extra_bits = 0;
+	int result                   = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream  = deflate_stream->bit_stream;
+	data_offset = *uncompressed_data_offset;
+
+	while( result == 0 )
+	{
+		if( deflate_stream->state == DEFLATE_STREAM_STATE_MATCH )
+		{
+			match_distance = deflate_stream->match_distance;
+			match_size     = deflate_stream->match_size;
+
+			while( ( match_size > 0 )
+			    && ( data_offset < uncompressed_data_size ) )
+			{
+				history_size = data_offset - deflate_stream->uncompressed_data_start_offset;
+
+				/* The start of the match is in the uncompressed data of the previous calls
+				 */
+				if( (size_t) match_distance > history_size )
+				{
+					window_index = ( deflate_stream->window_offset + DEFLATE_WINDOW_SIZE + history_size - match_distance ) & ( DEFLATE_WINDOW_SIZE - 1 );
+
+					uncompressed_data[ data_offset++ ] = deflate_stream->window[ window_index ];
+
+					match_size--;
+
+					continue;
+				}
+				copy_size = uncompressed_data_size - data_offset;
+
+				if( copy_size > (size_t) match_size )
+				{
+					copy_size = (size_t) match_size;
+				}
+				if( match_copy(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     data_offset,
+				     (size_t) match_distance,
+				     copy_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy match.",
+					 function );
+
+					return( -1 );
+				}
+				data_offset += copy_size;
+				match_size  -= (uint16_t) copy_size;
+			}
+			deflate_stream->match_size = match_size;
+
+			if( match_size > 0 )
+			{
+				deflate_stream->uncompressed_data_full = 1;
+
+				break;
+			}
+			deflate_stream->state = DEFLATE_STREAM_STATE_HUFFMAN_DATA;
+		}
+		/* A literal and distance code with their extra bits are at most 48 bits
+		 */
+		if( bit_stream->bit_buffer_size < 48 )
+		{
+			if( bit_stream_refill(
+			     bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to refill bit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		bit_buffer      = bit_stream->bit_buffer;
+		bit_buffer_size = bit_stream->bit_buffer_size;
+
+		result = huffman_tree_get_symbol_from_bit_buffer(
+		          deflate_stream->literals_huffman_tree,
+		          bit_buffer,
+		          bit_buffer_size,
+		          &symbol,
+		          &code_size,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from literals Huffman tree.",
+				 function );
+			}
+			break;
+		}
+		result = 0;
+
+		if( symbol < 256 )
+		{
+			if( data_offset >= uncompressed_data_size )
+			{
+				deflate_stream->uncompressed_data_full = 1;
+
+				break;
+			}
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 code_size );
+
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		if( symbol == 256 )
+		{
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 code_size );
+
+			if( deflate_stream->last_block_flag == 0 )
+			{
+				deflate_stream->state = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+			}
+			else if( deflate_stream->format == DEFLATE_STREAM_FORMAT_ZLIB )
+			{
+				deflate_stream->state = DEFLATE_STREAM_STATE_DATA_FOOTER;
+			}
+			else
+			{
+				deflate_stream->state = DEFLATE_STREAM_STATE_END;
+			}
+			result = 1;
+
+			break;
+		}
+		if( symbol > 285 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literal symbol: %" PRIu32 " value out of bounds.",
+			 function,
+			 symbol );
+
+			result = -1;
+
+			break;
+		}
+		symbol -= 257;
+
+		number_of_extra_bits = (uint8_t) deflate_literal_codes_number_of_extra_bits[ symbol ];
+		number_of_bits       = code_size + number_of_extra_bits;
+
+		if( number_of_bits > bit_buffer_size )
+		{
+			break;
+		}
+		match_size = deflate_literal_codes_base[ symbol ]
+		           + (uint16_t) ( ( bit_buffer >> code_size ) & bit_stream_mask_64bit( number_of_extra_bits ) );
+
+		result = huffman_tree_get_symbol_from_bit_buffer(
+		          deflate_stream->distances_huffman_tree,
+		          bit_buffer >> number_of_bits,
+		          bit_buffer_size - number_of_bits,
+		          &symbol,
+		          &code_size,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from distances Huffman tree.",
+				 function );
+			}
+			break;
+		}
+		result = 0;
+
+		if( symbol > 29 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance symbol: %" PRIu32 " value out of bounds.",
+			 function,
+			 symbol );
+
+			result = -1;
+
+			break;
+		}
+		number_of_bits      += code_size;
+		number_of_extra_bits = (uint8_t) deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+		if( ( number_of_bits + number_of_extra_bits ) > bit_buffer_size )
+		{
+			break;
+		}
+		match_distance = deflate_distance_codes_base[ symbol ]
+		               + (uint16_t) ( ( bit_buffer >> number_of_bits ) & bit_stream_mask_64bit( number_of_extra_bits ) );
+
+		number_of_bits += number_of_extra_bits;
+
+		history_size = data_offset - deflate_stream->uncompressed_data_start_offset;
+
+		if( (size64_t) match_distance > ( deflate_stream->uncompressed_size + history_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid match distance value out of bounds.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		bit_stream_back_to_front_consume(
+		 bit_stream,
+		 number_of_bits );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: match size: %" PRIu16 ", distance: %" PRIu16 "\n",
+			 function,
+			 match_size,
+			 match_distance );
+		}
+		deflate_stream->match_distance = match_distance;
+		deflate_stream->match_size     = match_size;
+		deflate_stream->state          = DEFLATE_STREAM_STATE_MATCH;
+	}
+	*uncompressed_data_offset = data_offset;
+
+	return( result );
+}
+
+/* Reads the zlib compressed data footer and validates the checksum
+ * Returns 1 on success, 0 if more compressed data is needed or -1 on error
+ */
+int deflate_stream_read_data_footer(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "deflate_stream_read_data_footer";
+	uint32_t stored_checksum = 0;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	if( deflate_stream_update_window(
+	     deflate_stream,
+	     uncompressed_data,
+	     uncompressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update window.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore the bits in the buffer upto the next byte
+	 */
+	bit_stream_back_to_front_consume(
+	 deflate_stream->bit_stream,
+	 deflate_stream->bit_stream->bit_buffer_size & 0x07 );
+
+	result = deflate_stream_get_value(
+	          deflate_stream,
+	          32,
+	          &value_32bit,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+		}
+		return( result );
+	}
+	/* The checksum is stored in big-endian
+	 */
+	stored_checksum = ( ( value_32bit & 0x000000ffUL ) << 24 )
+	                | ( ( value_32bit & 0x0000ff00UL ) << 8 )
+	                | ( ( value_32bit >> 8 ) & 0x0000ff00UL )
+	                | ( value_32bit >> 24 );
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 deflate_stream->calculated_checksum );
+	}
+	if( stored_checksum != deflate_stream->calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 deflate_stream->calculated_checksum );
+
+		return( -1 );
+	}
+	deflate_stream->state = DEFLATE_STREAM_STATE_END;
+
+	return( 1 );
+}
+
+/* Decompresses a part of a DEFLATE compressed stream
+ * The compressed data and uncompressed data can be provided in chunks of any size,
+ * the decoder state and the last DEFLATE_WINDOW_SIZE bytes of uncompressed data
+ * are retained between calls. On return the offsets contain the compressed data
+ * consumed and the uncompressed data produced by the call.
+ * If stop at block boundary is set the call also returns at the start of every block
+ * Returns 1 if the end of the stream was reached, 0 if more compressed data
+ * or uncompressed data space is needed or -1 on error
+ */
+int deflate_stream_decompress(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream            = NULL;
+	static char *function               = "deflate_stream_decompress";
+	size_t compressed_data_start_offset = 0;
+	size_t data_offset                  = 0;
+	size_t read_ahead_size              = 0;
+	int result                          = 1;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_END )
+	{
+		return( 1 );
+	}
+	bit_stream = deflate_stream->bit_stream;
+
+	compressed_data_start_offset = *compressed_data_offset;
+	data_offset                  = *uncompressed_data_offset;
+
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
+	bit_stream->byte_stream_offset = compressed_data_start_offset;
+
+	deflate_stream->uncompressed_data_start_offset = data_offset;
+	deflate_stream->uncompressed_data_full         = 0;
+	deflate_stream->block_boundary_reached         = 0;
+
+	while( ( result == 1 )
+	    && ( deflate_stream->state != DEFLATE_STREAM_STATE_END ) )
+	{
+		switch( deflate_stream->state )
+		{
+			case DEFLATE_STREAM_STATE_DATA_HEADER:
+				result = deflate_stream_read_data_header(
+				          deflate_stream,
+				          error );
+				break;
+
+			case DEFLATE_STREAM_STATE_BLOCK_HEADER:
+				result = deflate_stream_read_block_header(
+				          deflate_stream,
+				          error );
+				break;
+
+			case DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER:
+			case DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA:
+				result = deflate_stream_read_uncompressed_block(
+				          deflate_stream,
+				          uncompressed_data,
+				          uncompressed_data_size,
+				          &data_offset,
+				          error );
+				break;
+
+			case DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER:
+			case DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_PRE_CODE_SIZES:
+			case DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_CODE_SIZES:
+				result = deflate_stream_read_dynamic_huffman_trees(
+				          deflate_stream,
+				          error );
+				break;
+
+			case DEFLATE_STREAM_STATE_HUFFMAN_DATA:
+			case DEFLATE_STREAM_STATE_MATCH:
+				result = deflate_stream_decode_huffman(
+				          deflate_stream,
+				          uncompressed_data,
+				          uncompressed_data_size,
+				          &data_offset,
+				          error );
+				break;
+
+			case DEFLATE_STREAM_STATE_DATA_FOOTER:
+				result = deflate_stream_read_data_footer(
+				          deflate_stream,
+				          uncompressed_data,
+				          data_offset,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported state: %" PRIu8 ".",
+				 function,
+				 deflate_stream->state );
+
+				result = -1;
+
+				break;
+		}
+		if( ( result == 1 )
+		 && ( deflate_stream->stop_at_block_boundary != 0 )
+		 && ( deflate_stream->state == DEFLATE_STREAM_STATE_BLOCK_HEADER ) )
+		{
+			deflate_stream->block_boundary_reached = 1;
+
+			result = 0;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Return the whole bytes that were read ahead into the bit buffer to the compressed data
+	 * if the end of the stream or a block boundary was reached or the uncompressed data is full,
+	 * otherwise the buffered bits are part of the next code and are needed to continue in the next call
+	 */
+	if( ( deflate_stream->state == DEFLATE_STREAM_STATE_END )
+	 || ( deflate_stream->uncompressed_data_full != 0 )
+	 || ( deflate_stream->block_boundary_reached != 0 ) )
+	{
+		read_ahead_size = bit_stream->bit_buffer_size >> 3;
+
+		if( read_ahead_size > ( bit_stream->byte_stream_offset - compressed_data_start_offset ) )
+		{
+			read_ahead_size = bit_stream->byte_stream_offset - compressed_data_start_offset;
+		}
+		bit_stream->byte_stream_offset -= read_ahead_size;
+		bit_stream->bit_buffer_size    -= (uint8_t) ( read_ahead_size << 3 );
+		bit_stream->bit_buffer         &= bit_stream_mask_64bit( bit_stream->bit_buffer_size );
+	}
+	/* The remaining bits of the last byte of a raw stream are padding
+	 */
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_END )
+	{
+		bit_stream->bit_buffer      = 0;
+		bit_stream->bit_buffer_size = 0;
+	}
+	if( deflate_stream_update_window(
+	     deflate_stream,
+	     uncompressed_data,
+	     data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update window.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_data_offset   = bit_stream->byte_stream_offset;
+	*uncompressed_data_offset = data_offset;
+
+	bit_stream->byte_stream        = NULL;
+	bit_stream->byte_stream_size   = 0;
+	bit_stream->byte_stream_offset = 0;
+
+	if( deflate_stream->state == DEFLATE_STREAM_STATE_END )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	bit_stream->byte_stream        = NULL;
+	bit_stream->byte_stream_size   = 0;
+	bit_stream->byte_stream_offset = 0;
+
+	return( -1 );
+}
+
@@ -0,0 +1,241 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_STREAM_H )
+#define _DEFLATE_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "bit_stream.h"
+#include "huffman_tree.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The stream formats
+ */
+enum DEFLATE_STREAM_FORMATS
+{
+	DEFLATE_STREAM_FORMAT_RAW				= 0x01,
+	DEFLATE_STREAM_FORMAT_ZLIB				= 0x02
+};
+
+/* The decoder states
+ */
+enum DEFLATE_STREAM_STATES
+{
+	DEFLATE_STREAM_STATE_DATA_HEADER			= 0x00,
+	DEFLATE_STREAM_STATE_BLOCK_HEADER			= 0x01,
+	DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER		= 0x02,
+	DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA		= 0x03,
+	DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_HEADER		= 0x04,
+	DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_PRE_CODE_SIZES	= 0x05,
+	DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_CODE_SIZES		= 0x06,
+	DEFLATE_STREAM_STATE_HUFFMAN_DATA			= 0x07,
+	DEFLATE_STREAM_STATE_MATCH				= 0x08,
+	DEFLATE_STREAM_STATE_DATA_FOOTER			= 0x09,
+	DEFLATE_STREAM_STATE_END				= 0x0a
+};
+
+typedef struct deflate_stream deflate_stream_t;
+
+struct deflate_stream
+{
+	/* The stream format
+	 */
+	uint8_t format;
+
+	/* The decoder state
+	 */
+	uint8_t state;
+
+	/* The bit stream, which references the compressed data of the current call
+	 * The bit buffer is retained between calls
+	 */
+	bit_stream_t *bit_stream;
+
+	/* The last block flag of the current block
+	 */
+	uint8_t last_block_flag;
+
+	/* The remaining size of the current uncompressed block
+	 */
+	uint16_t uncompressed_block_size;
+
+	/* The number of literal codes of the current dynamic Huffman block
+	 */
+	uint16_t number_of_literal_codes;
+
+	/* The number of distance codes of the current dynamic Huffman block
+	 */
+	uint16_t number_of_distance_codes;
+
+	/* The number of (pre-)code sizes of the current dynamic Huffman block
+	 */
+	uint16_t number_of_code_sizes;
+
+	/* The index of the next (pre-)code size
+	 */
+	uint16_t code_size_index;
+
+	/* The (pre-)code sizes of the current dynamic Huffman block
+	 */
+	uint8_t code_size_array[ 320 ];
+
+	/* The pre-codes Huffman tree
+	 */
+	huffman_tree_t *pre_codes_huffman_tree;
+
+	/* The dynamic literals Huffman tree
+	 */
+	huffman_tree_t *dynamic_literals_huffman_tree;
+
+	/* The dynamic distances Huffman tree
+	 */
+	huffman_tree_t *dynamic_distances_huffman_tree;
+
+	/* The literals Huffman tree of the current block
+	 */
+	const huffman_tree_t *literals_huffman_tree;
+
+	/* The distances Huffman tree of the current block
+	 */
+	const huffman_tree_t *distances_huffman_tree;
+
+	/* The remaining size of the current match
+	 */
+	uint16_t match_size;
+
+	/* The distance of the current match
+	 */
+	uint16_t match_distance;
+
+	/* Value to indicate decoding stopped because the uncompressed data is full
+	 */
+	uint8_t uncompressed_data_full;
+
+	/* Value to indicate decoding should stop at the start of every block
+	 */
+	uint8_t stop_at_block_boundary;
+
+	/* Value to indicate decoding stopped at the start of a block
+	 */
+	uint8_t block_boundary_reached;
+
+	/* The sliding window, which contains the last DEFLATE_WINDOW_SIZE bytes
+	 * of the uncompressed data of the previous calls
+	 */
+	uint8_t *window;
+
+	/* The offset of the next byte in the sliding window
+	 */
+	size_t window_offset;
+
+	/* The offset in the uncompressed data of the current call up to which
+	 * the uncompressed data was added to the sliding window
+	 */
+	size_t uncompressed_data_start_offset;
+
+	/* The total size of the uncompressed data
+	 */
+	size64_t uncompressed_size;
+
+	/* The calculated checksum of the uncompressed data
+	 */
+	uint32_t calculated_checksum;
+};
+
+int deflate_stream_initialize(
+     deflate_stream_t **deflate_stream,
+     uint8_t format,
+     libcerror_error_t **error );
+
+int deflate_stream_free(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_reset(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_get_value(
+     deflate_stream_t *deflate_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int deflate_stream_update_window(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int deflate_stream_read_data_header(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_read_block_header(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_read_uncompressed_block(
+     deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int deflate_stream_read_dynamic_huffman_trees(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_decode_huffman(
+     deflate_stream_t *deflate_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int deflate_stream_read_data_footer(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int deflate_stream_decompress(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_STREAM_H ) */
+
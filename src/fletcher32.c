@@ -74,13 +74,20 @@ int fletcher32_calculate(
 
 		return( -1 );
 	}
-/*
+	/* In ones' complement arithmetic 0 and 0xffff are equivalent, where 0xffff
+	 * is used so that a previous key of 0 calculates a new Fletcher-32
+	 */
 	lower_word = previous_key & 0xffff;
 	upper_word = ( previous_key >> 16 ) & 0xffff;
-*/
 
-	lower_word = 0xffff;
-	upper_word = 0xffff;
+	if( lower_word == 0 )
+	{
+		lower_word = 0xffff;
+	}
+	if( upper_word == 0 )
+	{
+		upper_word = 0xffff;
+	}
 
         while( size )
 	{
@@ -34,6 +34,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "block_reader.h"
 #include "fletcher32.h"
 
 /* Prints the executable usage information
@@ -47,11 +48,13 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use fletcher32sum to calculate a Fletcher-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: fletcher32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                     [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: fletcher32sum [ -b block_size ] [ -i initial_value ]\n"
+	                 "                     [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-b:     block size of the data read at once, must be a multiple\n"
+	                 "\t        of 512 and at most 1073741824 (default is 4194304)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial Fletcher-32 (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
@@ -72,11 +75,13 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error     = NULL;
 	libcfile_file_t *source_file = NULL;
 	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
+	block_reader_t *block_reader = NULL;
+	uint8_t *block_data          = NULL;
 	char *program                = "fletcher32sum";
 	system_integer_t option      = 0;
-	size_t source_size           = 0;
-	ssize_t read_count           = 0;
+	size_t block_data_size       = 0;
+	size_t block_size            = BLOCK_READER_DEFAULT_BLOCK_SIZE;
+	size64_t source_size         = 0;
 	off_t source_offset          = 0;
 	uint32_t fletcher32          = 0;
 	uint32_t previous_key        = 0;
@@ -90,7 +95,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -106,6 +111,14 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'b':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				block_size = (size_t) _wtol( optarg );
+#else
+				block_size = (size_t) atol( optarg );
+#endif
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -175,22 +188,14 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
+	if( block_reader_initialize(
+	     &block_reader,
+	     block_size,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Unable to create block reader.\n" );
 
 		goto on_error;
 	}
@@ -241,13 +246,49 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( block_reader_open(
+	     block_reader,
+	     source_file,
+	     source_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open block reader.\n" );
 
-	if( read_count != (ssize_t) source_size )
+		goto on_error;
+	}
+	fletcher32 = previous_key;
+
+	/* Calculate the checksum block by block, using the checksum
+	 * of the previous blocks as the initial value
+	 */
+	while( ( result = block_reader_get_next_block(
+	                   block_reader,
+	                   &block_data,
+	                   &block_data_size,
+	                   &error ) ) == 1 )
+	{
+		result = fletcher32_calculate(
+		          &fletcher32,
+		          block_data,
+		          block_data_size,
+		          fletcher32,
+		          &error );
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Fletcher-32.\n" );
+
+			goto on_error;
+		}
+		libcnotify_print_data(
+		 block_data,
+		 block_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
@@ -255,6 +296,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( block_reader_free(
+	     &block_reader,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free block reader.\n" );
+
+		goto on_error;
+	}
 	/* Clean up
 	 */
 	if( libcfile_file_close(
@@ -277,27 +328,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( fletcher32_calculate(
-	     &fletcher32,
-	     buffer,
-	     source_size,
-	     previous_key,
-	     NULL ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate Fletcher-32.\n" );
-
-		goto on_error;
-	}
-	libcnotify_print_data(
-	 buffer,
-	 source_size,
-	 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-	memory_free(
-	 buffer );
-
 	fprintf(
 	 stdout,
 	 "Calculated Fletcher-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
@@ -314,10 +344,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	if( block_reader != NULL )
 	{
-		memory_free(
-		 buffer );
+		block_reader_free(
+		 &block_reader,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
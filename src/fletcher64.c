@@ -100,6 +100,14 @@ int fletcher64_calculate(
 
 		lower_32bit += value_32bit;
 		upper_32bit += lower_32bit;
+
+		/* Reduce after every 0x10000 values to prevent the upper sum from overflowing
+		 */
+		if( ( data_offset % 0x40000 ) == 0x3fffc )
+		{
+			lower_32bit %= 0xffffffffUL;
+			upper_32bit %= 0xffffffffUL;
+		}
 	}
 	lower_32bit %= 0xffffffffUL;
 	upper_32bit %= 0xffffffffUL;
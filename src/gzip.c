@@ -0,0 +1,1392 @@
+/*
+ * GZIP (RFC 1952) compressed data format functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "bit_stream.h"
+#include "checksum.h"
+#include "deflate.h"
+#include "deflate_stream.h"
+#include "gzip.h"
+
+const uint8_t gzip_signature[ 2 ] = { 0x1f, 0x8b };
+
+/* Calculates the CRC-32 of a buffer as used by the gzip member footer
+ * Uses the fastest CRC-32 calculation supported by the CPU
+ * Use an initial value of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_calculate_crc32(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_calculate_crc32";
+
+	if( checksum_calculate_crc32(
+	     checksum_value,
+	     buffer,
+	     size,
+	     initial_value,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a member header
+ * On return the compressed data offset contains the offset of the DEFLATE compressed data
+ * of the member and the member size contains the size of the member as stored in the
+ * BGZF block size extra field or 0 if not available
+ * Returns 1 on success or -1 on error
+ */
+int gzip_read_member_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t *member_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "gzip_read_member_header";
+	size_t extra_field_end_offset      = 0;
+	size_t header_offset               = 0;
+	size_t safe_compressed_data_offset = 0;
+	size_t safe_member_size            = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t modification_time         = 0;
+	uint16_t extra_field_size          = 0;
+	uint16_t stored_checksum           = 0;
+	uint16_t sub_field_size            = 0;
+	uint8_t compression_method         = 0;
+	uint8_t flags                      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( ( compressed_data_size < GZIP_MEMBER_HEADER_SIZE )
+	 || ( safe_compressed_data_offset > ( compressed_data_size - GZIP_MEMBER_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	header_offset = safe_compressed_data_offset;
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: member header data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ header_offset ] ),
+		 GZIP_MEMBER_HEADER_SIZE,
+		 0 );
+	}
+	if( memory_compare(
+	     &( compressed_data[ header_offset ] ),
+	     gzip_signature,
+	     2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	compression_method = compressed_data[ header_offset + 2 ];
+	flags              = compressed_data[ header_offset + 3 ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ header_offset + 4 ] ),
+	 modification_time );
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compression method\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 compression_method );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 flags );
+
+		libcnotify_printf(
+		 "%s: modification time\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 modification_time );
+
+		libcnotify_printf(
+		 "%s: extra flags\t\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 compressed_data[ header_offset + 8 ] );
+
+		libcnotify_printf(
+		 "%s: operating system\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 compressed_data[ header_offset + 9 ] );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	if( compression_method != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %" PRIu8 ".",
+		 function,
+		 compression_method );
+
+		return( -1 );
+	}
+	if( ( flags & 0xe0 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset += GZIP_MEMBER_HEADER_SIZE;
+
+	if( ( flags & GZIP_FLAG_EXTRA_FIELD ) != 0 )
+	{
+		if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 extra_field_size );
+
+		safe_compressed_data_offset += 2;
+
+		if( (size_t) extra_field_size > ( compressed_data_size - safe_compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		extra_field_end_offset = safe_compressed_data_offset + extra_field_size;
+
+		/* The BGZF block size sub field contains the size of the member minus 1
+		 */
+		while( ( extra_field_end_offset - safe_compressed_data_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ safe_compressed_data_offset + 2 ] ),
+			 sub_field_size );
+
+			if( (size_t) sub_field_size > ( extra_field_end_offset - safe_compressed_data_offset - 4 ) )
+			{
+				break;
+			}
+			if( ( compressed_data[ safe_compressed_data_offset ] == 'B' )
+			 && ( compressed_data[ safe_compressed_data_offset + 1 ] == 'C' )
+			 && ( sub_field_size == 2 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+				 safe_member_size );
+
+				safe_member_size += 1;
+			}
+			safe_compressed_data_offset += 4 + (size_t) sub_field_size;
+		}
+		safe_compressed_data_offset = extra_field_end_offset;
+	}
+	if( ( flags & GZIP_FLAG_NAME ) != 0 )
+	{
+		while( ( safe_compressed_data_offset < compressed_data_size )
+		    && ( compressed_data[ safe_compressed_data_offset ] != 0 ) )
+		{
+			safe_compressed_data_offset++;
+		}
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset++;
+	}
+	if( ( flags & GZIP_FLAG_COMMENT ) != 0 )
+	{
+		while( ( safe_compressed_data_offset < compressed_data_size )
+		    && ( compressed_data[ safe_compressed_data_offset ] != 0 ) )
+		{
+			safe_compressed_data_offset++;
+		}
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset++;
+	}
+	if( ( flags & GZIP_FLAG_HEADER_CRC ) != 0 )
+	{
+		if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 stored_checksum );
+
+		/* The header CRC contains the lower 16 bits of the CRC-32 of the header
+		 */
+		if( gzip_calculate_crc32(
+		     &calculated_checksum,
+		     &( compressed_data[ header_offset ] ),
+		     safe_compressed_data_offset - header_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate header checksum.",
+			 function );
+
+			return( -1 );
+		}
+		calculated_checksum &= 0x0000ffffUL;
+
+		if( (uint32_t) stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: header checksum does not match (stored: 0x%04" PRIx16 ", calculated: 0x%04" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset += 2;
+	}
+	if( ( safe_member_size != 0 )
+	 && ( safe_member_size < ( safe_compressed_data_offset - header_offset + GZIP_MEMBER_FOOTER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+	*member_size            = safe_member_size;
+
+	return( 1 );
+}
+
+/* Reads a member footer
+ * Returns 1 on success or -1 on error
+ */
+int gzip_read_member_footer(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t *checksum,
+     uint32_t *uncompressed_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "gzip_read_member_footer";
+	size_t safe_compressed_data_offset = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( ( compressed_data_size < GZIP_MEMBER_FOOTER_SIZE )
+	 || ( safe_compressed_data_offset > ( compressed_data_size - GZIP_MEMBER_FOOTER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset ] ),
+	 *checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+	 *uncompressed_size );
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *checksum );
+
+		libcnotify_printf(
+		 "%s: uncompressed size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 *uncompressed_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	*compressed_data_offset = safe_compressed_data_offset + GZIP_MEMBER_FOOTER_SIZE;
+
+	return( 1 );
+}
+
+/* Decompresses a member
+ * The member starts at the compressed data offset and its uncompressed data is stored
+ * at the uncompressed data offset. Matches cannot refer to the uncompressed data of
+ * preceding members. On return the offsets contain the end of the member
+ * The Huffman trees and bit stream of the decoder are reused between calls
+ * Returns 1 on success or -1 on error
+ */
+int gzip_decoder_decompress_member(
+     deflate_decoder_t *deflate_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream           = NULL;
+	uint8_t *member_data               = NULL;
+	static char *function              = "gzip_decoder_decompress_member";
+	size_t checksum_data_offset        = 0;
+	size_t member_data_offset          = 0;
+	size_t member_data_size            = 0;
+	size_t member_size                 = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t stored_checksum           = 0;
+	uint32_t stored_uncompressed_size  = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_decoder->bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate decoder - missing bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( gzip_read_member_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     &member_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member header.",
+		 function );
+
+		return( -1 );
+	}
+	member_data      = &( uncompressed_data[ *uncompressed_data_offset ] );
+	member_data_size = uncompressed_data_size - *uncompressed_data_offset;
+
+	/* The bit stream is reset for every call
+	 */
+	bit_stream = deflate_decoder->bit_stream;
+
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
+	bit_stream->byte_stream_offset = safe_compressed_data_offset;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	while( last_block_flag == 0 )
+	{
+		if( deflate_read_block_header(
+		     bit_stream,
+		     &block_type,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block header.",
+			 function );
+
+			goto on_error;
+		}
+		if( deflate_read_block(
+		     deflate_decoder,
+		     block_type,
+		     member_data,
+		     member_data_size,
+		     &member_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block.",
+			 function );
+
+			goto on_error;
+		}
+		/* Update the checksum with the data of the block while it is still cached
+		 */
+		if( gzip_calculate_crc32(
+		     &calculated_checksum,
+		     &( member_data[ checksum_data_offset ] ),
+		     member_data_offset - checksum_data_offset,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		checksum_data_offset = member_data_offset;
+	}
+	/* The whole bytes that were read ahead into the bit buffer are part of the footer,
+	 * the remaining bits of the last byte are padding
+	 */
+	safe_compressed_data_offset = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size >> 3 );
+
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
+	bit_stream->bit_buffer       = 0;
+	bit_stream->bit_buffer_size  = 0;
+
+	if( gzip_read_member_footer(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     &stored_checksum,
+	     &stored_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member footer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( member_size != 0 )
+	 && ( member_size != ( safe_compressed_data_offset - *compressed_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in member size ( %" PRIzd " != %" PRIzd " ).",
+		 function,
+		 member_size,
+		 safe_compressed_data_offset - *compressed_data_offset );
+
+		return( -1 );
+	}
+	/* The uncompressed size contains the size modulo 2^32
+	 */
+	if( stored_uncompressed_size != (uint32_t) member_data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed size ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 stored_uncompressed_size,
+		 (uint32_t) member_data_offset );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	*compressed_data_offset    = safe_compressed_data_offset;
+	*uncompressed_data_offset += member_data_offset;
+
+	return( 1 );
+
+on_error:
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
+
+	return( -1 );
+}
+
+/* Decompresses data stored in the gzip compressed data format
+ * The compressed data can contain multiple members, the uncompressed data
+ * of the members is concatenated
+ * Returns 1 on success or -1 on error
+ */
+int gzip_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	deflate_decoder_t *deflate_decoder = NULL;
+	static char *function              = "gzip_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t uncompressed_data_offset    = 0;
+	int result                         = 1;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_decoder_initialize(
+	     &deflate_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( gzip_decoder_decompress_member(
+		     deflate_decoder,
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_offset,
+		     uncompressed_data,
+		     *uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress member at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			result = -1;
+
+			break;
+		}
+	}
+	while( compressed_data_offset < compressed_data_size );
+
+	if( deflate_decoder_free(
+	     &deflate_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free deflate decoder.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		*uncompressed_data_size = uncompressed_data_offset;
+	}
+	return( result );
+}
+
+/* Creates a member index
+ * Make sure the value member_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_index_initialize(
+     gzip_member_index_t **member_index,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_member_index_initialize";
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *member_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid member index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*member_index = memory_allocate_structure(
+	                 gzip_member_index_t );
+
+	if( *member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create member index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *member_index,
+	     0,
+	     sizeof( gzip_member_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear member index.",
+		 function );
+
+		memory_free(
+		 *member_index );
+
+		*member_index = NULL;
+
+		return( -1 );
+	}
+	if( deflate_stream_initialize(
+	     &( ( *member_index )->deflate_stream ),
+	     DEFLATE_STREAM_FORMAT_RAW,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *member_index )->skip_buffer = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * DEFLATE_WINDOW_SIZE );
+
+	if( ( *member_index )->skip_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create skip buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *member_index != NULL )
+	{
+		gzip_member_index_free(
+		 member_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a member index
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_index_free(
+     gzip_member_index_t **member_index,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_member_index_free";
+	int result            = 1;
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *member_index != NULL )
+	{
+		if( ( *member_index )->members != NULL )
+		{
+			memory_free(
+			 ( *member_index )->members );
+		}
+		if( ( *member_index )->skip_buffer != NULL )
+		{
+			memory_free(
+			 ( *member_index )->skip_buffer );
+		}
+		if( ( *member_index )->deflate_stream != NULL )
+		{
+			if( deflate_stream_free(
+			     &( ( *member_index )->deflate_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free deflate stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *member_index );
+
+		*member_index = NULL;
+	}
+	return( result );
+}
+
+/* Appends a member to the member index
+ * The uncompressed offset of the member is the end of the preceding member
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_index_append_member(
+     gzip_member_index_t *member_index,
+     uint64_t compressed_offset,
+     size64_t compressed_size,
+     size64_t uncompressed_size,
+     uint32_t checksum,
+     libcerror_error_t **error )
+{
+	gzip_member_t *member  = NULL;
+	gzip_member_t *members = NULL;
+	static char *function  = "gzip_member_index_append_member";
+	size_t array_size      = 0;
+	int members_array_size = 0;
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_index->number_of_members >= member_index->members_array_size )
+	{
+		members_array_size = member_index->members_array_size * 2;
+
+		if( members_array_size == 0 )
+		{
+			members_array_size = 16;
+		}
+		array_size = sizeof( gzip_member_t ) * members_array_size;
+
+		members = (gzip_member_t *) memory_reallocate(
+		                             member_index->members,
+		                             array_size );
+
+		if( members == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize members.",
+			 function );
+
+			return( -1 );
+		}
+		member_index->members            = members;
+		member_index->members_array_size = members_array_size;
+	}
+	member = &( member_index->members[ member_index->number_of_members ] );
+
+	member->compressed_offset   = compressed_offset;
+	member->compressed_size     = compressed_size;
+	member->uncompressed_offset = (uint64_t) member_index->uncompressed_data_size;
+	member->uncompressed_size   = uncompressed_size;
+	member->checksum            = checksum;
+
+	member_index->number_of_members      += 1;
+	member_index->compressed_data_size    = (size64_t) compressed_offset + compressed_size;
+	member_index->uncompressed_data_size += uncompressed_size;
+
+	return( 1 );
+}
+
+/* Determines the size of the member at the compressed data offset
+ * The size of a member with a BGZF block size extra field is determined without
+ * decompressing the member, otherwise the member is decompressed to determine its size
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_index_get_member_size(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t compressed_data_offset,
+     size_t *member_size,
+     size64_t *uncompressed_size,
+     libcerror_error_t **error )
+{
+	deflate_stream_t *deflate_stream   = NULL;
+	static char *function              = "gzip_member_index_get_member_size";
+	size_t data_offset                 = 0;
+	size_t safe_compressed_data_offset = 0;
+	size_t safe_member_size            = 0;
+	uint32_t stored_checksum           = 0;
+	uint32_t stored_uncompressed_size  = 0;
+	int result                         = 0;
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = compressed_data_offset;
+
+	if( gzip_read_member_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     &safe_member_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member header.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_member_size != 0 )
+	{
+		if( safe_member_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset = compressed_data_offset + safe_member_size - GZIP_MEMBER_FOOTER_SIZE;
+	}
+	else
+	{
+		deflate_stream = member_index->deflate_stream;
+
+		if( deflate_stream_reset(
+		     deflate_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset deflate stream.",
+			 function );
+
+			return( -1 );
+		}
+		while( result == 0 )
+		{
+			data_offset = 0;
+
+			result = deflate_stream_decompress(
+			          deflate_stream,
+			          compressed_data,
+			          compressed_data_size,
+			          &safe_compressed_data_offset,
+			          member_index->skip_buffer,
+			          DEFLATE_WINDOW_SIZE,
+			          &data_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      && ( deflate_stream->uncompressed_data_full == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: compressed data is truncated.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( gzip_read_member_footer(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     &stored_checksum,
+	     &stored_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member footer.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream == NULL )
+	{
+		*uncompressed_size = (size64_t) stored_uncompressed_size;
+	}
+	else
+	{
+		if( stored_uncompressed_size != (uint32_t) deflate_stream->uncompressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed size ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 stored_uncompressed_size,
+			 (uint32_t) deflate_stream->uncompressed_size );
+
+			return( -1 );
+		}
+		*uncompressed_size = deflate_stream->uncompressed_size;
+	}
+	*member_size = safe_compressed_data_offset - compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Builds the member index of gzip compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_index_build(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "gzip_member_index_build";
+	size64_t uncompressed_size    = 0;
+	size_t compressed_data_offset = 0;
+	size_t member_size            = 0;
+	uint32_t stored_checksum      = 0;
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	member_index->number_of_members      = 0;
+	member_index->compressed_data_size   = 0;
+	member_index->uncompressed_data_size = 0;
+
+	do
+	{
+		if( gzip_member_index_get_member_size(
+		     member_index,
+		     compressed_data,
+		     compressed_data_size,
+		     compressed_data_offset,
+		     &member_size,
+		     &uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of member at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset + member_size - GZIP_MEMBER_FOOTER_SIZE ] ),
+		 stored_checksum );
+
+		if( gzip_member_index_append_member(
+		     member_index,
+		     (uint64_t) compressed_data_offset,
+		     (size64_t) member_size,
+		     uncompressed_size,
+		     stored_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append member.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_data_offset += member_size;
+	}
+	while( compressed_data_offset < compressed_data_size );
+
+	return( 1 );
+
+on_error:
+	member_index->number_of_members      = 0;
+	member_index->compressed_data_size   = 0;
+	member_index->uncompressed_data_size = 0;
+
+	return( -1 );
+}
@@ -0,0 +1,191 @@
+/*
+ * GZIP (RFC 1952) compressed data format functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GZIP_H )
+#define _GZIP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The member header flags
+ */
+enum GZIP_FLAGS
+{
+	GZIP_FLAG_TEXT				= 0x01,
+	GZIP_FLAG_HEADER_CRC			= 0x02,
+	GZIP_FLAG_EXTRA_FIELD			= 0x04,
+	GZIP_FLAG_NAME				= 0x08,
+	GZIP_FLAG_COMMENT			= 0x10
+};
+
+/* The size of the fixed part of the member header
+ */
+#define GZIP_MEMBER_HEADER_SIZE			10
+
+/* The size of the member footer
+ */
+#define GZIP_MEMBER_FOOTER_SIZE			8
+
+extern const uint8_t gzip_signature[ 2 ];
+
+typedef struct gzip_member gzip_member_t;
+
+struct gzip_member
+{
+	/* The offset of the member header in the compressed data
+	 */
+	uint64_t compressed_offset;
+
+	/* The size of the compressed data of the member, including the header and footer
+	 */
+	size64_t compressed_size;
+
+	/* The offset of the uncompressed data of the member
+	 */
+	uint64_t uncompressed_offset;
+
+	/* The size of the uncompressed data of the member
+	 */
+	size64_t uncompressed_size;
+
+	/* The stored CRC-32 of the uncompressed data of the member
+	 */
+	uint32_t checksum;
+};
+
+typedef struct gzip_member_index gzip_member_index_t;
+
+struct gzip_member_index
+{
+	/* The members
+	 */
+	gzip_member_t *members;
+
+	/* The number of members
+	 */
+	int number_of_members;
+
+	/* The number of allocated members
+	 */
+	int members_array_size;
+
+	/* The size of the compressed data
+	 */
+	size64_t compressed_data_size;
+
+	/* The size of the uncompressed data
+	 */
+	size64_t uncompressed_data_size;
+
+	/* The deflate stream, used to determine the size of members
+	 * that do not contain a block size extra field
+	 */
+	deflate_stream_t *deflate_stream;
+
+	/* The buffer used to skip uncompressed data
+	 */
+	uint8_t *skip_buffer;
+};
+
+int gzip_calculate_crc32(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int gzip_read_member_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t *member_size,
+     libcerror_error_t **error );
+
+int gzip_read_member_footer(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t *checksum,
+     uint32_t *uncompressed_size,
+     libcerror_error_t **error );
+
+int gzip_decoder_decompress_member(
+     deflate_decoder_t *deflate_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int gzip_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int gzip_member_index_initialize(
+     gzip_member_index_t **member_index,
+     libcerror_error_t **error );
+
+int gzip_member_index_free(
+     gzip_member_index_t **member_index,
+     libcerror_error_t **error );
+
+int gzip_member_index_append_member(
+     gzip_member_index_t *member_index,
+     uint64_t compressed_offset,
+     size64_t compressed_size,
+     size64_t uncompressed_size,
+     uint32_t checksum,
+     libcerror_error_t **error );
+
+int gzip_member_index_get_member_size(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t compressed_data_offset,
+     size_t *member_size,
+     size64_t *uncompressed_size,
+     libcerror_error_t **error );
+
+int gzip_member_index_build(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GZIP_H ) */
+
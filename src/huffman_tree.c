@@ -226,6 +226,11 @@ int huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -295,6 +300,10 @@ int huffman_tree_build(
 
 		return( -1 );
 	}
+	/* Make sure a lookup table of a previous build is not used
+	 */
+	huffman_tree->lookup_table_bits = 0;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -436,6 +445,23 @@ int huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	if( huffman_tree_build_lookup_table(
+	     huffman_tree,
+	     code_sizes_array,
+	     number_of_code_sizes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build lookup table.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -447,16 +473,429 @@ on_error:
 	return( -1 );
 }
 
+/* Builds the lookup table of the Huffman tree
+ * The primary lookup table is indexed by the next lookup table bits in a back-to-front bit stream,
+ * Huffman codes that are larger than the lookup table bits are stored in sub tables
+ * that follow the primary lookup table.
+ * Note that this function expects the symbols to be sorted by code size
+ * Returns 1 on success, 0 if no lookup table is available or -1 on error
+ */
+int huffman_tree_build_lookup_table(
+     huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error )
+{
+	uint8_t sub_table_bits_array[ 1 << HUFFMAN_TREE_LOOKUP_TABLE_BITS ];
+
+	uint32_t *lookup_table         = NULL;
+	static char *function          = "huffman_tree_build_lookup_table";
+	size_t array_size              = 0;
+	uint32_t huffman_code          = 0;
+	uint32_t lookup_table_entry    = 0;
+	uint32_t lookup_table_index    = 0;
+	uint32_t prefix_code           = 0;
+	uint32_t reversed_code         = 0;
+	uint32_t sub_table_offset      = 0;
+	uint8_t bit_index              = 0;
+	uint8_t code_size              = 0;
+	uint8_t largest_code_size      = 0;
+	uint8_t lookup_table_bits      = 0;
+	uint8_t remaining_code_size    = 0;
+	uint8_t sub_table_bits         = 0;
+	int code_size_count            = 0;
+	int current_prefix_code        = -1;
+	int number_of_entries          = 0;
+	int symbol                     = 0;
+	int symbol_index               = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_code_sizes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	huffman_tree->lookup_table_bits = 0;
+
+	for( bit_index = huffman_tree->maximum_code_size;
+	     bit_index > 0;
+	     bit_index-- )
+	{
+		if( huffman_tree->code_size_counts[ bit_index ] != 0 )
+		{
+			largest_code_size = bit_index;
+
+			break;
+		}
+	}
+	/* The lookup table only supports Huffman codes that fit in the sub tables
+	 */
+	if( ( largest_code_size == 0 )
+	 || ( largest_code_size > 16 ) )
+	{
+		return( 0 );
+	}
+	if( largest_code_size < HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+	{
+		lookup_table_bits = largest_code_size;
+	}
+	else
+	{
+		lookup_table_bits = HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+	}
+	if( memory_set(
+	     sub_table_bits_array,
+	     0,
+	     sizeof( uint8_t ) * ( 1 << HUFFMAN_TREE_LOOKUP_TABLE_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub table bits array.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the size of the sub tables, where the codes that share a prefix
+	 * are consecutive and the last code has the largest code size
+	 */
+	huffman_code = 0;
+
+	for( code_size = 1;
+	     code_size <= largest_code_size;
+	     code_size++ )
+	{
+		for( code_size_count = huffman_tree->code_size_counts[ code_size ];
+		     code_size_count > 0;
+		     code_size_count-- )
+		{
+			if( code_size > lookup_table_bits )
+			{
+				prefix_code = huffman_code >> ( code_size - lookup_table_bits );
+
+				sub_table_bits_array[ prefix_code ] = code_size - lookup_table_bits;
+			}
+			huffman_code++;
+		}
+		huffman_code <<= 1;
+	}
+	number_of_entries = 1 << lookup_table_bits;
+
+	for( prefix_code = 0;
+	     prefix_code < ( (uint32_t) 1 << lookup_table_bits );
+	     prefix_code++ )
+	{
+		if( sub_table_bits_array[ prefix_code ] != 0 )
+		{
+			number_of_entries += 1 << sub_table_bits_array[ prefix_code ];
+		}
+	}
+	/* The sub table offset is stored in 16 bits
+	 */
+	if( number_of_entries > 0x0000ffffL )
+	{
+		return( 0 );
+	}
+	if( number_of_entries > huffman_tree->lookup_table_size )
+	{
+		array_size = sizeof( uint32_t ) * number_of_entries;
+
+		lookup_table = (uint32_t *) memory_reallocate(
+		                             huffman_tree->lookup_table,
+		                             array_size );
+
+		if( lookup_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize lookup table.",
+			 function );
+
+			return( -1 );
+		}
+		huffman_tree->lookup_table      = lookup_table;
+		huffman_tree->lookup_table_size = number_of_entries;
+	}
+	array_size = sizeof( uint32_t ) * number_of_entries;
+
+	/* Entries of unused codes are 0 and are handled by the canonical Huffman code look up
+	 */
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Fill the lookup table with the bit reversed canonical Huffman codes
+	 */
+	huffman_code     = 0;
+	symbol_index     = 0;
+	sub_table_offset = (uint32_t) 1 << lookup_table_bits;
+
+	for( code_size = 1;
+	     code_size <= largest_code_size;
+	     code_size++ )
+	{
+		for( code_size_count = huffman_tree->code_size_counts[ code_size ];
+		     code_size_count > 0;
+		     code_size_count-- )
+		{
+			symbol = huffman_tree->symbols[ symbol_index++ ];
+
+			if( ( symbol < 0 )
+			 || ( symbol >= number_of_code_sizes )
+			 || ( code_sizes_array[ symbol ] != code_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid symbol: %d value out of bounds.",
+				 function,
+				 symbol );
+
+				return( -1 );
+			}
+			if( code_size <= lookup_table_bits )
+			{
+				reversed_code = 0;
+
+				for( bit_index = 0;
+				     bit_index < code_size;
+				     bit_index++ )
+				{
+					reversed_code <<= 1;
+					reversed_code  |= ( huffman_code >> bit_index ) & 0x00000001UL;
+				}
+				lookup_table_entry = ( (uint32_t) code_size << 16 ) | (uint32_t) symbol;
+
+				for( lookup_table_index = reversed_code;
+				     lookup_table_index < ( (uint32_t) 1 << lookup_table_bits );
+				     lookup_table_index += (uint32_t) 1 << code_size )
+				{
+					huffman_tree->lookup_table[ lookup_table_index ] = lookup_table_entry;
+				}
+			}
+			else
+			{
+				remaining_code_size = code_size - lookup_table_bits;
+				prefix_code         = huffman_code >> remaining_code_size;
+
+				if( (int) prefix_code != current_prefix_code )
+				{
+					current_prefix_code = (int) prefix_code;
+					sub_table_bits      = sub_table_bits_array[ prefix_code ];
+
+					reversed_code = 0;
+
+					for( bit_index = 0;
+					     bit_index < lookup_table_bits;
+					     bit_index++ )
+					{
+						reversed_code <<= 1;
+						reversed_code  |= ( prefix_code >> bit_index ) & 0x00000001UL;
+					}
+					huffman_tree->lookup_table[ reversed_code ] = HUFFMAN_TREE_LOOKUP_TABLE_ENTRY_FLAG_SUB_TABLE
+					                                            | ( (uint32_t) sub_table_bits << 16 )
+					                                            | sub_table_offset;
+
+					lookup_table_index = sub_table_offset;
+					sub_table_offset  += (uint32_t) 1 << sub_table_bits;
+				}
+				else
+				{
+					lookup_table_index = sub_table_offset - ( (uint32_t) 1 << sub_table_bits );
+				}
+				reversed_code = 0;
+
+				for( bit_index = 0;
+				     bit_index < remaining_code_size;
+				     bit_index++ )
+				{
+					reversed_code <<= 1;
+					reversed_code  |= ( huffman_code >> bit_index ) & 0x00000001UL;
+				}
+				lookup_table_entry = ( (uint32_t) remaining_code_size << 16 ) | (uint32_t) symbol;
+
+				for( reversed_code += lookup_table_index;
+				     reversed_code < sub_table_offset;
+				     reversed_code += (uint32_t) 1 << remaining_code_size )
+				{
+					huffman_tree->lookup_table[ reversed_code ] = lookup_table_entry;
+				}
+			}
+			huffman_code++;
+		}
+		huffman_code <<= 1;
+	}
+	huffman_tree->lookup_table_bits = lookup_table_bits;
+
+	return( 1 );
+}
+
 /* Retrieves a symbol based on the Huffman code read from the bit-stream
+ * Uses the lookup table if available and falls back to the canonical Huffman code look up otherwise
  * Returns 1 on success or -1 on error
  */
 int huffman_tree_get_symbol_from_bit_stream(
-     huffman_tree_t *huffman_tree,
+     const huffman_tree_t *huffman_tree,
+     bit_stream_t *bit_stream,
+     uint32_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function       = "huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_table_entry = 0;
+	uint32_t lookup_table_index = 0;
+	uint8_t code_size           = 0;
+	uint8_t sub_table_bits      = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( huffman_tree->lookup_table_bits != 0 )
+	 && ( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) )
+	{
+		if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+		{
+			if( bit_stream_refill(
+			     bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to refill bit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		lookup_table_index = bit_stream_back_to_front_peek_value(
+		                      bit_stream,
+		                      huffman_tree->lookup_table_bits );
+
+		lookup_table_entry = huffman_tree->lookup_table[ lookup_table_index ];
+
+		if( ( lookup_table_entry & HUFFMAN_TREE_LOOKUP_TABLE_ENTRY_FLAG_SUB_TABLE ) == 0 )
+		{
+			code_size = (uint8_t) ( lookup_table_entry >> 16 );
+		}
+		else
+		{
+			sub_table_bits = (uint8_t) ( lookup_table_entry >> 16 );
+
+			lookup_table_index  = (uint32_t) ( ( bit_stream->bit_buffer >> huffman_tree->lookup_table_bits ) & bit_stream_mask_64bit( sub_table_bits ) );
+			lookup_table_index += lookup_table_entry & 0x0000ffffUL;
+			lookup_table_entry  = huffman_tree->lookup_table[ lookup_table_index ];
+
+			code_size = (uint8_t) ( lookup_table_entry >> 16 );
+
+			if( code_size != 0 )
+			{
+				code_size += huffman_tree->lookup_table_bits;
+			}
+		}
+		/* Codes that are not in the lookup table or that are truncated by the end of the bit stream
+		 * are handled by the canonical Huffman code look up
+		 */
+		if( ( code_size != 0 )
+		 && ( code_size <= bit_stream->bit_buffer_size ) )
+		{
+			bit_stream_back_to_front_consume(
+			 bit_stream,
+			 code_size );
+
+			*symbol = lookup_table_entry & 0x0000ffffUL;
+
+			return( 1 );
+		}
+	}
+	return( huffman_tree_get_symbol_from_bit_stream_canonical(
+	         huffman_tree,
+	         bit_stream,
+	         symbol,
+	         error ) );
+}
+
+/* Retrieves a symbol based on the canonical Huffman code read bit-by-bit from the bit-stream
+ * Returns 1 on success or -1 on error
+ */
+int huffman_tree_get_symbol_from_bit_stream_canonical(
+     const huffman_tree_t *huffman_tree,
      bit_stream_t *bit_stream,
      uint32_t *symbol,
      libcerror_error_t **error )
 {
-	static char *function  = "huffman_tree_get_symbol_from_bit_stream";
+	static char *function  = "huffman_tree_get_symbol_from_bit_stream_canonical";
 	uint32_t safe_symbol   = 0;
 	uint32_t value_32bit   = 0;
 	uint8_t bit_index      = 0;
@@ -587,3 +1026,145 @@ int huffman_tree_get_symbol_from_bit_stream(
 	return( 1 );
 }
 
+/* Retrieves a symbol based on the Huffman code in a back-to-front bit buffer
+ * The bits are not consumed and the bits beyond the bit buffer size must be 0
+ * Returns 1 on success, 0 if the bit buffer does not contain sufficient bits or -1 on error
+ */
+int huffman_tree_get_symbol_from_bit_buffer(
+     const huffman_tree_t *huffman_tree,
+     uint64_t bit_buffer,
+     uint8_t bit_buffer_size,
+     uint32_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "huffman_tree_get_symbol_from_bit_buffer";
+	uint32_t lookup_table_entry = 0;
+	uint32_t lookup_table_index = 0;
+	uint8_t bit_index           = 0;
+	uint8_t safe_code_size      = 0;
+	uint8_t sub_table_bits      = 0;
+	int code_size_count         = 0;
+	int first_huffman_code      = 0;
+	int first_index             = 0;
+	int huffman_code            = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_buffer_size > 64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code size.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->lookup_table_bits != 0 )
+	{
+		lookup_table_index = (uint32_t) ( bit_buffer & bit_stream_mask_64bit( huffman_tree->lookup_table_bits ) );
+		lookup_table_entry = huffman_tree->lookup_table[ lookup_table_index ];
+
+		if( ( lookup_table_entry & HUFFMAN_TREE_LOOKUP_TABLE_ENTRY_FLAG_SUB_TABLE ) == 0 )
+		{
+			safe_code_size = (uint8_t) ( lookup_table_entry >> 16 );
+		}
+		else
+		{
+			sub_table_bits = (uint8_t) ( lookup_table_entry >> 16 );
+
+			lookup_table_index  = (uint32_t) ( ( bit_buffer >> huffman_tree->lookup_table_bits ) & bit_stream_mask_64bit( sub_table_bits ) );
+			lookup_table_index += lookup_table_entry & 0x0000ffffUL;
+			lookup_table_entry  = huffman_tree->lookup_table[ lookup_table_index ];
+
+			safe_code_size = (uint8_t) ( lookup_table_entry >> 16 );
+
+			if( safe_code_size != 0 )
+			{
+				safe_code_size += huffman_tree->lookup_table_bits;
+			}
+		}
+		/* The lookup table entry is only valid if the bit buffer contains all the bits of the code
+		 * unused codes are handled by the canonical Huffman code look up
+		 */
+		if( safe_code_size != 0 )
+		{
+			if( safe_code_size > bit_buffer_size )
+			{
+				return( 0 );
+			}
+			*symbol    = lookup_table_entry & 0x0000ffffUL;
+			*code_size = safe_code_size;
+
+			return( 1 );
+		}
+	}
+	for( bit_index = 1;
+	     bit_index <= huffman_tree->maximum_code_size;
+	     bit_index++ )
+	{
+		if( bit_index > bit_buffer_size )
+		{
+			return( 0 );
+		}
+		huffman_code <<= 1;
+		huffman_code  |= (int) ( bit_buffer & 0x00000001UL );
+		bit_buffer   >>= 1;
+
+		code_size_count = huffman_tree->code_size_counts[ bit_index ];
+
+		if( ( huffman_code - code_size_count ) < first_huffman_code )
+		{
+			*symbol    = (uint32_t) huffman_tree->symbols[ first_index + ( huffman_code - first_huffman_code ) ];
+			*code_size = bit_index;
+
+			return( 1 );
+		}
+		first_huffman_code  += code_size_count;
+		first_huffman_code <<= 1;
+		first_index         += code_size_count;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+	 function,
+	 huffman_code );
+
+	return( -1 );
+}
+
@@ -32,6 +32,14 @@
 extern "C" {
 #endif
 
+/* The maximum number of bits used to index the primary lookup table
+ */
+#define HUFFMAN_TREE_LOOKUP_TABLE_BITS			9
+
+/* The lookup table entry flags
+ */
+#define HUFFMAN_TREE_LOOKUP_TABLE_ENTRY_FLAG_SUB_TABLE	0x01000000UL
+
 typedef struct huffman_tree huffman_tree_t;
 
 struct huffman_tree
@@ -47,6 +55,22 @@ struct huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The lookup table
+	 * Every entry contains the symbol or the sub table offset in bits 0 - 15,
+	 * the code size or the number of sub table bits in bits 16 - 23
+	 * and the flags in bits 24 - 31
+	 */
+	uint32_t *lookup_table;
+
+	/* The number of entries allocated for the lookup table
+	 */
+	int lookup_table_size;
+
+	/* The number of bits used to index the primary lookup table
+	 * A value of 0 indicates the lookup table is not available
+	 */
+	uint8_t lookup_table_bits;
 };
 
 int huffman_tree_initialize(
@@ -65,12 +89,32 @@ int huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error );
 
-int huffman_tree_get_symbol_from_bit_stream(
+int huffman_tree_build_lookup_table(
      huffman_tree_t *huffman_tree,
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     libcerror_error_t **error );
+
+int huffman_tree_get_symbol_from_bit_stream(
+     const huffman_tree_t *huffman_tree,
      bit_stream_t *bit_stream,
      uint32_t *symbol,
      libcerror_error_t **error );
 
+int huffman_tree_get_symbol_from_bit_stream_canonical(
+     const huffman_tree_t *huffman_tree,
+     bit_stream_t *bit_stream,
+     uint32_t *symbol,
+     libcerror_error_t **error );
+
+int huffman_tree_get_symbol_from_bit_buffer(
+     const huffman_tree_t *huffman_tree,
+     uint64_t bit_buffer,
+     uint8_t bit_buffer_size,
+     uint32_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
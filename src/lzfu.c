@@ -26,7 +26,8 @@
 
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
-#include "crc32.h"
+#include "assorted_libcthreads.h"
+#include "checksum.h"
 #include "lzfu.h"
 
 #define LZFU_SIGNATURE_COMPRESSED        0x75465a4c
@@ -38,31 +39,18 @@ const char *lzfu_rtf_dictionary = \
 	"{\\f0\\fnil \\froman \\fswiss \\fmodern \\fscript \\fdecor MS Sans SerifSymbolArialTimes New RomanCourier"
 	"{\\colortbl\\red0\\green0\\blue0\r\n\\par \\pard\\plain\\f0\\fs20\\b\\i\\u\\tab\\tx";
 
-/* Determines the uncompressed data size from the LZFu header in the compressed data
- * Return 1 on success or -1 on error
+/* Reads the LZFu header
+ * The compressed data size in the LZFu header is corrected to the size of
+ * the compressed data after the header
+ * Returns 1 on success or -1 on error
  */
-int lzfu_get_uncompressed_data_size(
+int lzfu_read_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *uncompressed_data_size,
+     lzfu_header_t *lzfu_header,
      libcerror_error_t **error )
 {
-	lzfu_header_t lzfu_header;
-
-	uint8_t *lzfu_data                = 0;
-	static char *function             = "lzfu_get_uncompressed_data_size";
-
-	uint8_t lz_buffer[ 4096 ];
-
-	uint8_t *lzfu_reference_data      = 0;
-	size_t compressed_data_iterator   = 0;
-	size_t uncompressed_data_iterator = 0;
-	uint16_t lz_buffer_iterator       = 0;
-	uint16_t reference_offset         = 0;
-	uint16_t reference_size           = 0;
-	uint16_t reference_iterator       = 0;
-	uint8_t flag_byte_bit_mask        = 0;
-	uint8_t flag_byte                 = 0;
+	static char *function = "lzfu_read_header";
 
 	if( compressed_data == NULL )
 	{
@@ -75,50 +63,47 @@ int lzfu_get_uncompressed_data_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( ( compressed_data_size < sizeof( lzfu_header_t ) )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( lzfu_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid LZFu header.",
 		 function );
 
 		return( -1 );
 	}
-	lzfu_data = compressed_data;
-
 	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.compressed_data_size );
-
-	lzfu_data += 4;
+	 compressed_data,
+	 lzfu_header->compressed_data_size );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.uncompressed_data_size );
-
-	lzfu_data += 4;
+	 &( compressed_data[ 4 ] ),
+	 lzfu_header->uncompressed_data_size );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.signature );
+	 &( compressed_data[ 8 ] ),
+	 lzfu_header->signature );
 
-	lzfu_data += 8;
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 lzfu_header->crc );
 
-	if( ( lzfu_header.signature != LZFU_SIGNATURE_COMPRESSED )
-	 && ( lzfu_header.signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
+	if( ( lzfu_header->signature != LZFU_SIGNATURE_COMPRESSED )
+	 && ( lzfu_header->signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -126,31 +111,213 @@ int lzfu_get_uncompressed_data_size(
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
 		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
 		 function,
-		 lzfu_header.signature );
+		 lzfu_header->signature );
 
 		return( -1 );
 	}
-	compressed_data_size -= sizeof( lzfu_header_t );
-
 	/* The compressed data size includes 12 bytes of the header
 	 */
-	lzfu_header.compressed_data_size -= 12;
-
-#ifdef X
-	if( (size_t) lzfu_header.compressed_data_size != compressed_data_size )
+	if( ( lzfu_header->compressed_data_size < 12 )
+	 || ( (size_t) ( lzfu_header->compressed_data_size - 12 ) > ( compressed_data_size - sizeof( lzfu_header_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size in header value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-#endif
+	lzfu_header->compressed_data_size -= 12;
+
+	return( 1 );
+}
+
+/* Initializes the lz buffer with the RTF dictionary followed by zero bytes
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_initialize_lz_buffer(
+     uint8_t *lz_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "lzfu_initialize_lz_buffer";
+
+	if( lz_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     lz_buffer,
+	     lzfu_rtf_dictionary,
+	     LZFU_DICTIONARY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( lz_buffer[ LZFU_DICTIONARY_SIZE ] ),
+	     0,
+	     LZFU_LZ_BUFFER_SIZE - LZFU_DICTIONARY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Restores the lz buffer to its initialized state after decompressing data
+ * Decompressing writes the uncompressed data after the RTF dictionary, hence only
+ * this part is cleared unless the write position wrapped around and overwrote
+ * the RTF dictionary
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_restore_lz_buffer(
+     uint8_t *lz_buffer,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "lzfu_restore_lz_buffer";
+
+	if( lz_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size >= ( LZFU_LZ_BUFFER_SIZE - LZFU_DICTIONARY_SIZE ) )
+	{
+		if( lzfu_initialize_lz_buffer(
+		     lz_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize lz buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( memory_set(
+	          &( lz_buffer[ LZFU_DICTIONARY_SIZE ] ),
+	          0,
+	          uncompressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size from the LZFu header in the compressed data
+ * Return 1 on success or -1 on error
+ */
+int lzfu_get_uncompressed_data_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfu_header_t lzfu_header;
+
+	const uint8_t *lzfu_data = NULL;
+	static char *function    = "lzfu_get_uncompressed_data_size";
+
+	uint8_t lz_buffer[ 4096 ];
+
+	const uint8_t *lzfu_reference_data = NULL;
+	size_t compressed_data_iterator    = 0;
+	size_t uncompressed_data_iterator  = 0;
+	uint16_t lz_buffer_iterator        = 0;
+	uint16_t reference_offset          = 0;
+	uint16_t reference_size            = 0;
+	uint16_t reference_iterator        = 0;
+	uint8_t flag_byte_bit_mask         = 0;
+	uint8_t flag_byte                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_read_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &lzfu_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		return( -1 );
+	}
+	lzfu_data = &( compressed_data[ sizeof( lzfu_header_t ) ] );
+
 	if( memory_copy(
 	     lz_buffer,
 	     lzfu_rtf_dictionary,
@@ -258,206 +425,703 @@ int lzfu_get_uncompressed_data_size(
 	return( 1 );
 }
 
-/* Compresses data using LZFu compression
- * Returns 1 on success or -1 on error
+/* Finds the longest match in the hash chain
+ * The uncompressed data offset is relative to the end of the RTF dictionary,
+ * the hash chain offsets are relative to the start of the RTF dictionary.
+ * The dictionary data should contain the RTF dictionary followed by
+ * the first bytes of the uncompressed data
+ * The match size should contain the size of the match to improve on
+ * Returns 1 if a longer match was found, 0 if not or -1 on error
  */
-int lzfu_compress(
+int lzfu_find_longest_match(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
+     size_t uncompressed_data_offset,
+     const uint8_t *dictionary_data,
+     const size_t *hash_chain,
+     size_t hash_chain_offset,
+     uint16_t maximum_chain_length,
+     uint16_t *match_size,
+     uint16_t *match_offset,
      libcerror_error_t **error )
 {
-	static char *function = "lzfu_compress";
+	const uint8_t *candidate_data = NULL;
+	const uint8_t *match_data     = NULL;
+	static char *function         = "lzfu_find_longest_match";
+	size_t candidate_offset       = 0;
+	size_t data_offset            = 0;
+	uint16_t best_match_offset    = 0;
+	uint16_t best_match_size      = 0;
+	uint16_t candidate_size       = 0;
+	uint16_t maximum_match_size   = 0;
+	int result                    = 0;
 
-	if( compressed_data == NULL )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size == NULL )
+	if( uncompressed_data_offset >= uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( dictionary_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 "%s: invalid dictionary data.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
-
-	return( -1 );
-}
-
-/* Decompresses data using LZFu compression
- * Returns 1 on success or -1 on error
- */
-int lzfu_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
-{
-	uint8_t lz_buffer[ 4096 ];
-
-	lzfu_header_t lzfu_header;
-
-	const uint8_t *lzfu_data           = NULL;
-	const uint8_t *lzfu_reference_data = NULL;
-	static char *function              = "lzfu_decompress";
-	size_t compressed_data_iterator    = 0;
-	size_t uncompressed_data_iterator  = 0;
-	uint32_t calculated_crc            = 0;
-	uint16_t lz_buffer_iterator        = 0;
-	uint16_t reference_iterator        = 0;
-	uint16_t reference_offset          = 0;
-	uint16_t reference_size            = 0;
-	uint8_t flag_byte                  = 0;
-	uint8_t flag_byte_bit_mask         = 0;
-
-	if( uncompressed_data == NULL )
+	if( hash_chain == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid hash chain.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( match_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid match size.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( match_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid match offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( ( uncompressed_data_size - uncompressed_data_offset ) < LZFU_MAXIMUM_MATCH_SIZE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
+		maximum_match_size = (uint16_t) ( uncompressed_data_size - uncompressed_data_offset );
 	}
-	if( memory_copy(
-	     lz_buffer,
-	     lzfu_rtf_dictionary,
-	     207 ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to initialize lz buffer.",
-		 function );
+		maximum_match_size = LZFU_MAXIMUM_MATCH_SIZE;
+	}
+	best_match_size = *match_size;
 
-		return( -1 );
+	if( best_match_size >= maximum_match_size )
+	{
+		return( 0 );
 	}
-	lz_buffer_iterator = 207;
+	match_data  = &( uncompressed_data[ uncompressed_data_offset ] );
+	data_offset = uncompressed_data_offset + LZFU_DICTIONARY_SIZE;
 
-	if( memory_set(
-	     &( lz_buffer[ lz_buffer_iterator ] ),
-	     0,
-	     ( 4096 - lz_buffer_iterator ) ) == NULL )
+	while( ( hash_chain_offset != 0 )
+	    && ( maximum_chain_length > 0 ) )
 	{
-		libcerror_error_set(
-		 error,
+		candidate_offset = hash_chain_offset - 1;
+
+		/* The hash chain of candidates outside the lz buffer can have been overwritten
+		 */
+		if( ( data_offset - candidate_offset ) > LZFU_MAXIMUM_MATCH_DISTANCE )
+		{
+			break;
+		}
+		/* A candidate in the RTF dictionary can continue into the start of the uncompressed data,
+		 * which is why the dictionary data contains the first bytes of the uncompressed data
+		 */
+		if( candidate_offset < LZFU_DICTIONARY_SIZE )
+		{
+			candidate_data = &( dictionary_data[ candidate_offset ] );
+		}
+		else
+		{
+			candidate_data = &( uncompressed_data[ candidate_offset - LZFU_DICTIONARY_SIZE ] );
+		}
+		if( candidate_data[ best_match_size ] == match_data[ best_match_size ] )
+		{
+			candidate_size = 0;
+
+			while( ( candidate_size < maximum_match_size )
+			    && ( candidate_data[ candidate_size ] == match_data[ candidate_size ] ) )
+			{
+				candidate_size++;
+			}
+			if( candidate_size > best_match_size )
+			{
+				best_match_size   = candidate_size;
+				best_match_offset = (uint16_t) ( candidate_offset % LZFU_LZ_BUFFER_SIZE );
+
+				result = 1;
+
+				if( best_match_size >= maximum_match_size )
+				{
+					break;
+				}
+			}
+		}
+		hash_chain_offset = hash_chain[ candidate_offset % LZFU_LZ_BUFFER_SIZE ];
+
+		maximum_chain_length--;
+	}
+	if( result != 0 )
+	{
+		*match_size   = best_match_size;
+		*match_offset = best_match_offset;
+	}
+	return( result );
+}
+
+/* Compresses data using LZFu compression
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t dictionary_data[ LZFU_DICTIONARY_SIZE + LZFU_MAXIMUM_MATCH_SIZE ];
+
+	const uint8_t *hash_data      = NULL;
+	size_t *hash_chain            = NULL;
+	size_t *hash_heads            = NULL;
+	static char *function         = "lzfu_compress";
+	size_t compressed_data_offset = 0;
+	size_t data_offset            = 0;
+	size_t dictionary_data_size   = 0;
+	size_t flag_byte_offset       = 0;
+	size_t insert_data_offset     = 0;
+	size_t lzfu_data_size         = 0;
+	uint32_t calculated_crc       = 0;
+	uint32_t hash_value           = 0;
+	uint32_t value_32bit          = 0;
+	uint16_t match_offset         = 0;
+	uint16_t match_size           = 0;
+	uint8_t flag_byte_bit_mask    = 0;
+	int result                    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The uncompressed data size is stored as a 32-bit value in the header
+	 */
+	if( ( uncompressed_data_size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) uncompressed_data_size > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size < sizeof( lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	hash_heads = (size_t *) memory_allocate(
+	                         sizeof( size_t ) << LZFU_HASH_NUMBER_OF_BITS );
+
+	if( hash_heads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_heads,
+	     0,
+	     sizeof( size_t ) << LZFU_HASH_NUMBER_OF_BITS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear lz buffer.",
+		 "%s: unable to clear hash heads.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	lzfu_data = compressed_data;
+	hash_chain = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * LZFU_LZ_BUFFER_SIZE );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.compressed_data_size );
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chain.",
+		 function );
 
-	lzfu_data += 4;
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_chain,
+	     0,
+	     sizeof( size_t ) * LZFU_LZ_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash chain.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.uncompressed_data_size );
+		goto on_error;
+	}
+	/* The dictionary data contains the RTF dictionary followed by the first bytes
+	 * of the uncompressed data, so that matches and hash values that start in
+	 * the RTF dictionary can be determined without checking every byte
+	 */
+	if( memory_set(
+	     dictionary_data,
+	     0,
+	     LZFU_DICTIONARY_SIZE + LZFU_MAXIMUM_MATCH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dictionary data.",
+		 function );
 
-	lzfu_data += 4;
+		goto on_error;
+	}
+	if( memory_copy(
+	     dictionary_data,
+	     lzfu_rtf_dictionary,
+	     LZFU_DICTIONARY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy RTF dictionary.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.signature );
+		goto on_error;
+	}
+	if( uncompressed_data_size < LZFU_MAXIMUM_MATCH_SIZE )
+	{
+		dictionary_data_size = uncompressed_data_size;
+	}
+	else
+	{
+		dictionary_data_size = LZFU_MAXIMUM_MATCH_SIZE;
+	}
+	if( ( dictionary_data_size > 0 )
+	 && ( memory_copy(
+	       &( dictionary_data[ LZFU_DICTIONARY_SIZE ] ),
+	       uncompressed_data,
+	       dictionary_data_size ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy start of uncompressed data.",
+		 function );
 
-	lzfu_data += 4;
+		goto on_error;
+	}
+	compressed_data_offset = sizeof( lzfu_header_t );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.crc );
+	/* The final iteration writes the end of stream reference
+	 */
+	while( data_offset <= uncompressed_data_size )
+	{
+		/* Add the positions before the current position to the hash chains,
+		 * the positions are relative to the start of the RTF dictionary
+		 */
+		while( ( insert_data_offset < ( data_offset + LZFU_DICTIONARY_SIZE ) )
+		    && ( ( insert_data_offset + 3 ) <= ( uncompressed_data_size + LZFU_DICTIONARY_SIZE ) ) )
+		{
+			if( insert_data_offset < LZFU_DICTIONARY_SIZE )
+			{
+				hash_data = &( dictionary_data[ insert_data_offset ] );
+			}
+			else
+			{
+				hash_data = &( uncompressed_data[ insert_data_offset - LZFU_DICTIONARY_SIZE ] );
+			}
+			value_32bit = ( (uint32_t) hash_data[ 2 ] << 16 )
+			            | ( (uint32_t) hash_data[ 1 ] << 8 )
+			            | hash_data[ 0 ];
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - LZFU_HASH_NUMBER_OF_BITS );
+
+			hash_chain[ insert_data_offset % LZFU_LZ_BUFFER_SIZE ] = hash_heads[ hash_value ];
+			hash_heads[ hash_value ]                               = insert_data_offset + 1;
+
+			insert_data_offset++;
+		}
+		match_size   = 1;
+		match_offset = 0;
+
+		if( data_offset == uncompressed_data_size )
+		{
+			/* The end of stream reference refers to the current write position in the lz buffer
+			 */
+			match_size   = 2;
+			match_offset = (uint16_t) ( ( data_offset + LZFU_DICTIONARY_SIZE ) % LZFU_LZ_BUFFER_SIZE );
+		}
+		else if( ( uncompressed_data_size - data_offset ) >= 3 )
+		{
+			hash_data   = &( uncompressed_data[ data_offset ] );
+			value_32bit = ( (uint32_t) hash_data[ 2 ] << 16 )
+			            | ( (uint32_t) hash_data[ 1 ] << 8 )
+			            | hash_data[ 0 ];
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - LZFU_HASH_NUMBER_OF_BITS );
+
+			result = lzfu_find_longest_match(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          data_offset,
+			          dictionary_data,
+			          hash_chain,
+			          hash_heads[ hash_value ],
+			          LZFU_MAXIMUM_CHAIN_LENGTH,
+			          &match_size,
+			          &match_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find longest match.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Every 8 literals or references are preceded by a flag byte
+		 */
+		if( flag_byte_bit_mask == 0 )
+		{
+			if( compressed_data_offset >= *compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			flag_byte_offset   = compressed_data_offset++;
+			flag_byte_bit_mask = 0x01;
+
+			compressed_data[ flag_byte_offset ] = 0;
+		}
+		if( match_size == 1 )
+		{
+			if( compressed_data_offset >= *compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ data_offset ];
+		}
+		else
+		{
+			if( ( *compressed_data_size - compressed_data_offset ) < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_data[ flag_byte_offset ] |= flag_byte_bit_mask;
+
+			/* A reference consists of a 12-bit offset and a 4-bit size stored in big-endian
+			 */
+			byte_stream_copy_from_uint16_big_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 ( match_offset << 4 ) | ( match_size - 2 ) );
+
+			compressed_data_offset += 2;
+		}
+		flag_byte_bit_mask <<= 1;
+
+		if( data_offset == uncompressed_data_size )
+		{
+			break;
+		}
+		data_offset += match_size;
+	}
+	memory_free(
+	 hash_chain );
+
+	hash_chain = NULL;
+
+	memory_free(
+	 hash_heads );
+
+	hash_heads = NULL;
+
+	lzfu_data_size = compressed_data_offset - sizeof( lzfu_header_t );
+
+	if( lzfu_data_size > (size_t) ( UINT32_MAX - 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The CRC is calculated over the compressed data, in a single pass over
+	 * the written data instead of a byte at a time while writing it
+	 */
+	if( checksum_calculate_crc32(
+	     &calculated_crc,
+	     &( compressed_data[ sizeof( lzfu_header_t ) ] ),
+	     lzfu_data_size,
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate weak CRC.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 compressed_data,
+	 (uint32_t) ( lzfu_data_size + 12 ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 LZFU_SIGNATURE_COMPRESSED );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 calculated_crc );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( hash_chain != NULL )
+	{
+		memory_free(
+		 hash_chain );
+	}
+	if( hash_heads != NULL )
+	{
+		memory_free(
+		 hash_heads );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using LZFu compression
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t lz_buffer[ LZFU_LZ_BUFFER_SIZE ];
 
-	lzfu_data += 4;
+	lzfu_header_t lzfu_header;
+
+	const uint8_t *lzfu_data = NULL;
+	static char *function    = "lzfu_decompress";
+	uint32_t calculated_crc  = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_initialize_lz_buffer(
+	     lz_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_read_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &lzfu_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		return( -1 );
+	}
+	lzfu_data = &( compressed_data[ sizeof( lzfu_header_t ) ] );
 
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
 		 "%s: lzfu header compressed data size\t: %" PRIu32 "\n",
 		 function,
-		 lzfu_header.compressed_data_size );
+		 lzfu_header.compressed_data_size + 12 );
 
 		libcnotify_printf(
 		 "%s: lzfu header uncompressed data size\t: %" PRIu32 "\n",
@@ -474,86 +1138,151 @@ int lzfu_decompress(
 		 function,
 		 lzfu_header.crc );
 	}
-	if( ( lzfu_header.signature != LZFU_SIGNATURE_COMPRESSED )
-	 && ( lzfu_header.signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
+	/* Make sure the uncompressed buffer is large enough
+	 */
+	if( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data too small.",
+		 function );
+
+		*uncompressed_data_size = lzfu_header.uncompressed_data_size;
+
+		return( -1 );
+	}
+	if( checksum_calculate_crc32(
+	     &calculated_crc,
+	     lzfu_data,
+	     (size_t) lzfu_header.compressed_data_size,
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate weak CRC.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_header.crc != calculated_crc )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 lzfu_header.crc,
+		 calculated_crc );
+
+		return( -1 );
+	}
+	if( lzfu_decompress_with_lz_buffer(
+	     lz_buffer,
+	     lzfu_data,
+	     (size_t) lzfu_header.compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
-		 function,
-		 lzfu_header.signature );
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZFu compressed data.",
+		 function );
 
 		return( -1 );
 	}
-	compressed_data_size -= sizeof( lzfu_header_t );
+	return( 1 );
+}
 
-	/* The compressed data size includes 12 bytes of the header
-	 */
-	lzfu_header.compressed_data_size -= 12;
+/* Decompresses LZFu compressed data, without the LZFu header, using a lz buffer
+ * The lz buffer should contain the RTF dictionary followed by zero bytes,
+ * as set by lzfu_initialize_lz_buffer, and is not restored afterwards
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_decompress_with_lz_buffer(
+     uint8_t *lz_buffer,
+     const uint8_t *lzfu_data,
+     size_t lzfu_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *lzfu_reference_data = NULL;
+	static char *function              = "lzfu_decompress_with_lz_buffer";
+	size_t compressed_data_iterator    = 0;
+	size_t uncompressed_data_iterator  = 0;
+	uint16_t lz_buffer_iterator        = LZFU_DICTIONARY_SIZE;
+	uint16_t reference_iterator        = 0;
+	uint16_t reference_offset          = 0;
+	uint16_t reference_size            = 0;
+	uint8_t flag_byte                  = 0;
+	uint8_t flag_byte_bit_mask         = 0;
 
-#ifdef X
-	if( lzfu_header.compressed_data_size != compressed_data_size )
+	if( lz_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lz buffer.",
+		 function );
 
 		return( -1 );
 	}
-#endif
-	/* Make sure the uncompressed buffer is large enough
-	 */
-	if( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
+	if( lzfu_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: uncompressed data too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu data.",
 		 function );
 
-		*uncompressed_data_size = lzfu_header.uncompressed_data_size;
+		return( -1 );
+	}
+	if( lzfu_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid LZFu data size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	if( crc32_calculate(
-	     &calculated_crc,
-	     lzfu_data,
-	     (size_t) lzfu_header.compressed_data_size,
-	     0,
-	     1,
-	     error ) != 1 )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to calculate weak CRC.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( lzfu_header.crc != calculated_crc )
+	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
-		 function,
-		 lzfu_header.crc,
-		 calculated_crc );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
 
 		return( -1 );
 	}
-	while( compressed_data_iterator < (size_t) lzfu_header.compressed_data_size )
+	while( compressed_data_iterator < lzfu_data_size )
 	{
 		flag_byte = lzfu_data[ compressed_data_iterator++ ];
 
@@ -561,7 +1290,7 @@ int lzfu_decompress(
 		 */
 		for( flag_byte_bit_mask = 0x01; flag_byte_bit_mask != 0x00; flag_byte_bit_mask <<= 1 )
 		{
-			if( compressed_data_iterator == (size_t) lzfu_header.compressed_data_size )
+			if( compressed_data_iterator == lzfu_data_size )
 			{
 				break;
 			}
@@ -569,7 +1298,7 @@ int lzfu_decompress(
 			 */
 			if( ( flag_byte & flag_byte_bit_mask ) == 0 )
 			{
-				if( compressed_data_iterator >= (size_t) lzfu_header.compressed_data_size )
+				if( compressed_data_iterator >= lzfu_data_size )
 				{
 					libcerror_error_set(
 					 error,
@@ -608,7 +1337,7 @@ int lzfu_decompress(
 			}
 			else
 			{
-				if( ( compressed_data_iterator + 1 ) >= (size_t) lzfu_header.compressed_data_size )
+				if( ( compressed_data_iterator + 1 ) >= lzfu_data_size )
 				{
 					libcerror_error_set(
 					 error,
@@ -667,3 +1396,413 @@ int lzfu_decompress(
 	return( 1 );
 }
 
+/* Decompresses the messages of a message worker
+ * The lz buffer of the worker is initialized once and restored after every message
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_message_worker_decompress(
+     lzfu_message_worker_t *worker,
+     libcerror_error_t **error )
+{
+	lzfu_header_t lzfu_header;
+
+	lzfu_message_t *message = NULL;
+	static char *function   = "lzfu_message_worker_decompress";
+	int message_index       = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->messages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing messages.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->message_index_step <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker - message index step value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_initialize_lz_buffer(
+	     worker->lz_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( message_index = worker->first_message_index;
+	     message_index < worker->number_of_messages;
+	     message_index += worker->message_index_step )
+	{
+		message = &( worker->messages[ message_index ] );
+
+		if( lzfu_read_header(
+		     message->compressed_data,
+		     message->compressed_data_size,
+		     &lzfu_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read header of message: %d.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( lzfu_decompress_with_lz_buffer(
+		     worker->lz_buffer,
+		     &( message->compressed_data[ sizeof( lzfu_header_t ) ] ),
+		     (size_t) lzfu_header.compressed_data_size,
+		     message->uncompressed_data,
+		     &( message->uncompressed_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress message: %d.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( lzfu_restore_lz_buffer(
+		     worker->lz_buffer,
+		     message->uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to restore lz buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* The message worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int lzfu_message_worker_thread_function(
+     void *arguments )
+{
+	lzfu_message_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (lzfu_message_worker_t *) arguments;
+
+	worker->result = lzfu_message_worker_decompress(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Decompresses a batch of LZFu compressed messages, such as RTF bodies, using multiple threads
+ * The headers and CRCs of all messages are validated before any message is decompressed,
+ * after which every thread decompresses its messages using a single lz buffer
+ * Without multi-thread support the messages are decompressed one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int lzfu_decompress_messages(
+     lzfu_message_t *messages,
+     int number_of_messages,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	lzfu_header_t lzfu_header;
+
+	lzfu_message_t *message        = NULL;
+	lzfu_message_worker_t *workers = NULL;
+	static char *function          = "lzfu_decompress_messages";
+	uint32_t calculated_crc        = 0;
+	int message_index              = 0;
+	int number_of_workers          = 0;
+	int result                     = 1;
+	int worker_index               = 0;
+
+	if( messages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid messages.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_messages <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of messages value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZFU_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate the headers and CRCs of all messages in a single pass
+	 */
+	for( message_index = 0;
+	     message_index < number_of_messages;
+	     message_index++ )
+	{
+		message = &( messages[ message_index ] );
+
+		if( ( message->uncompressed_data == NULL )
+		 || ( message->uncompressed_data_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid message: %d - invalid uncompressed data.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( lzfu_read_header(
+		     message->compressed_data,
+		     message->compressed_data_size,
+		     &lzfu_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read header of message: %d.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( message->uncompressed_data_size < lzfu_header.uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data of message: %d too small.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( checksum_calculate_crc32(
+		     &calculated_crc,
+		     &( message->compressed_data[ sizeof( lzfu_header_t ) ] ),
+		     (size_t) lzfu_header.compressed_data_size,
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate weak CRC of message: %d.",
+			 function,
+			 message_index );
+
+			return( -1 );
+		}
+		if( lzfu_header.crc != calculated_crc )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in crc of message: %d ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 message_index,
+			 lzfu_header.crc,
+			 calculated_crc );
+
+			return( -1 );
+		}
+	}
+	number_of_workers = number_of_threads;
+
+	if( number_of_messages < number_of_workers )
+	{
+		number_of_workers = number_of_messages;
+	}
+	workers = (lzfu_message_worker_t *) memory_allocate(
+	                                     sizeof( lzfu_message_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( lzfu_message_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		workers[ worker_index ].messages            = messages;
+		workers[ worker_index ].number_of_messages  = number_of_messages;
+		workers[ worker_index ].first_message_index = worker_index;
+		workers[ worker_index ].message_index_step  = number_of_workers;
+		workers[ worker_index ].result              = -1;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     &lzfu_message_worker_thread_function,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+#else
+		lzfu_message_worker_thread_function(
+		 (void *) &( workers[ worker_index ] ) );
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Join all the threads that were created, also on error
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif
+	if( result == 1 )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress messages of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+	memory_free(
+	 workers );
+
+	return( result );
+}
+
@@ -26,11 +26,41 @@
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the RTF dictionary the lz buffer is initialized with
+ */
+#define LZFU_DICTIONARY_SIZE			207
+
+/* The size of the lz buffer, which is a ring buffer referenced by 12-bit offsets
+ */
+#define LZFU_LZ_BUFFER_SIZE			4096
+
+/* The largest distance of a match, the decompressor clears the byte after
+ * the write position in the lz buffer so the oldest byte cannot be referenced
+ */
+#define LZFU_MAXIMUM_MATCH_DISTANCE		( LZFU_LZ_BUFFER_SIZE - 2 )
+
+/* The maximum size of a match that fits in the 4-bit size of a reference
+ */
+#define LZFU_MAXIMUM_MATCH_SIZE			17
+
+/* The number of bits of the match finder hash value
+ */
+#define LZFU_HASH_NUMBER_OF_BITS		12
+
+/* The maximum number of candidates in the hash chain checked by the match finder
+ */
+#define LZFU_MAXIMUM_CHAIN_LENGTH		64
+
+#define LZFU_MAXIMUM_NUMBER_OF_THREADS		256
+
+extern const char *lzfu_rtf_dictionary;
+
 /* The LZFu compression header (compressed RTF header)
  */
 typedef struct lzfu_header lzfu_header_t;
@@ -54,12 +84,96 @@ struct lzfu_header
 	uint32_t crc;
 };
 
+typedef struct lzfu_message lzfu_message_t;
+
+struct lzfu_message
+{
+	/* The compressed data of the message, including the LZFu header
+	 */
+	const uint8_t *compressed_data;
+
+	/* The size of the compressed data of the message
+	 */
+	size_t compressed_data_size;
+
+	/* The buffer for the uncompressed data of the message
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The size of the uncompressed data of the message
+	 * On input the size of the buffer, on output the size of the uncompressed data
+	 */
+	size_t uncompressed_data_size;
+};
+
+typedef struct lzfu_message_worker lzfu_message_worker_t;
+
+struct lzfu_message_worker
+{
+	/* The messages
+	 */
+	lzfu_message_t *messages;
+
+	/* The number of messages
+	 */
+	int number_of_messages;
+
+	/* The index of the first message decompressed by the worker
+	 */
+	int first_message_index;
+
+	/* The number of messages between the messages decompressed by the worker
+	 */
+	int message_index_step;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The lz buffer, which is initialized once and restored after every message
+	 */
+	uint8_t lz_buffer[ LZFU_LZ_BUFFER_SIZE ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int lzfu_read_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     lzfu_header_t *lzfu_header,
+     libcerror_error_t **error );
+
+int lzfu_initialize_lz_buffer(
+     uint8_t *lz_buffer,
+     libcerror_error_t **error );
+
+int lzfu_restore_lz_buffer(
+     uint8_t *lz_buffer,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 int lzfu_get_uncompressed_data_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int lzfu_find_longest_match(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     const uint8_t *dictionary_data,
+     const size_t *hash_chain,
+     size_t hash_chain_offset,
+     uint16_t maximum_chain_length,
+     uint16_t *match_size,
+     uint16_t *match_offset,
+     libcerror_error_t **error );
+
 int lzfu_compress(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -74,6 +188,27 @@ int lzfu_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int lzfu_decompress_with_lz_buffer(
+     uint8_t *lz_buffer,
+     const uint8_t *lzfu_data,
+     size_t lzfu_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzfu_message_worker_decompress(
+     lzfu_message_worker_t *worker,
+     libcerror_error_t **error );
+
+int lzfu_message_worker_thread_function(
+     void *arguments );
+
+int lzfu_decompress_messages(
+     lzfu_message_t *messages,
+     int number_of_messages,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,12 +20,25 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
 #include "lzvn.h"
+#include "match_copy.h"
+#include "match_finder.h"
+
+/* Forces lzvn_decompress_loop to be inlined into both of its callers
+ */
+#if defined( __GNUC__ )
+#define LZVN_FORCE_INLINE	inline __attribute__(( always_inline ))
+#elif defined( _MSC_VER )
+#define LZVN_FORCE_INLINE	__forceinline
+#else
+#define LZVN_FORCE_INLINE	inline
+#endif
 
 enum LZVN_OPPCODE_TYPES
 {
@@ -318,33 +331,67 @@ uint8_t lzvn_oppcode_types[ 256 ] = {
 	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xff */
 };
 
-/* Decompresses LZVN compressed data
- * Returns 1 on success or -1 on error
+/* The maximum match size that can be stored in a small distance, large distance
+ * or previous distance oppcode per number of literals
  */
-int lzvn_decompress(
+const uint8_t lzvn_maximum_oppcode_match_sizes[ 4 ] = {
+	10, 8, 6, 4 };
+
+/* The compression level configurations: the maximum chain length, the nice match size
+ * and if lazy matching is used, where the first configuration is that of compression level 1
+ */
+const uint16_t lzvn_compression_level_configurations[ 2 ][ 3 ] = {
+	{ 1, 32, 0 },
+	{ 32, 256, 1 } };
+
+/* Decompresses LZVN compressed data while the compressed and uncompressed data
+ * contain at least LZVN_DECOMPRESS_FAST_MARGIN bytes after the current offsets
+ * The margin allows the oppcodes to be decoded without bounds checks and literals
+ * and matches to be copied in blocks of 16 bytes, that can write beyond their end.
+ * The oppcode handlers are dispatched with computed goto if supported by the compiler
+ * Returns 1 if the end of stream oppcode was reached, 0 if the margin was reached or -1 on error
+ */
+int lzvn_decompress_fast(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
+     size_t *compressed_data_offset,
      uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint16_t *distance,
      libcerror_error_t **error )
 {
-	static char *function           = "lzvn_decompress";
-	size_t compressed_data_offset   = 0;
-	size_t match_offset             = 0;
-	size_t uncompressed_data_offset = 0;
-	uint16_t distance               = 0;
-	uint16_t literal_size           = 0;
-	uint16_t match_size             = 0;
-	uint8_t oppcode                 = 0;
-	uint8_t oppcode_type            = 0;
-	uint8_t oppcode_value           = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t debug_match_offset       = 0;
-	size_t oppcode_data_offset      = 0;
-	size_t oppcode_data_size        = 0;
+#if defined( __GNUC__ )
+	static const void *oppcode_type_handlers[ 11 ] = {
+		&&distance_large,
+		&&distance_medium,
+		&&distance_previous,
+		&&distance_small,
+		&&end_of_stream,
+		&&invalid_oppcode,
+		&&literal_large,
+		&&literal_small,
+		&&match_large,
+		&&match_small,
+		&&no_operation };
 #endif
 
+	const uint8_t *literal_data          = NULL;
+	const uint8_t *match_data            = NULL;
+	uint8_t *output_data                 = NULL;
+	static char *function                = "lzvn_decompress_fast";
+	size_t compressed_data_end_offset    = 0;
+	size_t copy_offset                   = 0;
+	size_t safe_compressed_data_offset   = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	size_t uncompressed_data_end_offset  = 0;
+	uint16_t literal_size                = 0;
+	uint16_t match_size                  = 0;
+	uint16_t safe_distance               = 0;
+	uint8_t oppcode                      = 0;
+	uint8_t oppcode_value                = 0;
+	int result                           = 0;
+
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -367,29 +414,29 @@ int lzvn_decompress(
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( compressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -400,6 +447,299 @@ int lzvn_decompress(
 
 		return( -1 );
 	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( distance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distance.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < LZVN_DECOMPRESS_FAST_MARGIN )
+	 || ( uncompressed_data_size < LZVN_DECOMPRESS_FAST_MARGIN ) )
+	{
+		return( 0 );
+	}
+	compressed_data_end_offset   = compressed_data_size - LZVN_DECOMPRESS_FAST_MARGIN;
+	uncompressed_data_end_offset = uncompressed_data_size - LZVN_DECOMPRESS_FAST_MARGIN;
+
+	safe_compressed_data_offset   = *compressed_data_offset;
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+	safe_distance                 = *distance;
+
+	if( ( safe_compressed_data_offset > compressed_data_end_offset )
+	 || ( safe_uncompressed_data_offset > uncompressed_data_end_offset ) )
+	{
+		return( 0 );
+	}
+	goto dispatch_oppcode;
+
+distance_large:
+	oppcode_value = compressed_data[ safe_compressed_data_offset + 1 ];
+
+	literal_size  = ( oppcode & 0xc0 ) >> 6;
+	match_size    = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+	safe_distance = ( (uint16_t) compressed_data[ safe_compressed_data_offset + 2 ] << 8 ) | oppcode_value;
+
+	safe_compressed_data_offset += 3;
+
+	goto copy_literal_and_match;
+
+distance_medium:
+	oppcode_value = compressed_data[ safe_compressed_data_offset + 1 ];
+
+	literal_size  = ( oppcode & 0x18 ) >> 3;
+	match_size    = ( ( ( oppcode & 0x07 ) << 2 ) | ( oppcode_value & 0x03 ) ) + 3;
+	safe_distance = ( (uint16_t) compressed_data[ safe_compressed_data_offset + 2 ] << 6 ) | ( ( oppcode_value & 0xfc ) >> 2 );
+
+	safe_compressed_data_offset += 3;
+
+	goto copy_literal_and_match;
+
+distance_previous:
+	literal_size = ( oppcode & 0xc0 ) >> 6;
+	match_size   = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+
+	safe_compressed_data_offset += 1;
+
+	goto copy_literal_and_match;
+
+distance_small:
+	literal_size  = ( oppcode & 0xc0 ) >> 6;
+	match_size    = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+	safe_distance = ( (uint16_t) ( oppcode & 0x07 ) << 8 ) | compressed_data[ safe_compressed_data_offset + 1 ];
+
+	safe_compressed_data_offset += 2;
+
+	goto copy_literal_and_match;
+
+literal_large:
+	literal_size = (uint16_t) compressed_data[ safe_compressed_data_offset + 1 ] + 16;
+
+	safe_compressed_data_offset += 2;
+
+	goto copy_literal;
+
+literal_small:
+	literal_size = oppcode & 0x0f;
+
+	safe_compressed_data_offset += 1;
+
+	goto copy_literal;
+
+match_large:
+	match_size = (uint16_t) compressed_data[ safe_compressed_data_offset + 1 ] + 16;
+
+	safe_compressed_data_offset += 2;
+
+	goto copy_match;
+
+match_small:
+	match_size = oppcode & 0x0f;
+
+	safe_compressed_data_offset += 1;
+
+	goto copy_match;
+
+end_of_stream:
+	safe_compressed_data_offset += 1;
+
+	result = 1;
+
+	goto end_of_fast_loop;
+
+no_operation:
+	safe_compressed_data_offset += 1;
+
+	goto next_oppcode;
+
+invalid_oppcode:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: invalid oppcode: 0x%02" PRIx8 ".",
+	 function,
+	 oppcode );
+
+	return( -1 );
+
+copy_literal_and_match:
+	/* The upto 3 literals of a distance oppcode are copied as a block of 4 bytes
+	 */
+	memory_copy(
+	 &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+	 &( compressed_data[ safe_compressed_data_offset ] ),
+	 4 );
+
+	safe_compressed_data_offset   += literal_size;
+	safe_uncompressed_data_offset += literal_size;
+
+copy_match:
+	if( ( safe_distance == 0 )
+	 || ( (size_t) safe_distance > safe_uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: distance value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_distance >= 16 )
+	{
+		output_data = &( uncompressed_data[ safe_uncompressed_data_offset ] );
+		match_data  = &( uncompressed_data[ safe_uncompressed_data_offset - safe_distance ] );
+
+		for( copy_offset = 0;
+		     copy_offset < (size_t) match_size;
+		     copy_offset += 16 )
+		{
+			memory_copy(
+			 &( output_data[ copy_offset ] ),
+			 &( match_data[ copy_offset ] ),
+			 16 );
+		}
+	}
+	else if( match_copy(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          safe_uncompressed_data_offset,
+	          (size_t) safe_distance,
+	          (size_t) match_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy match.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset += match_size;
+
+	goto next_oppcode;
+
+copy_literal:
+	output_data  = &( uncompressed_data[ safe_uncompressed_data_offset ] );
+	literal_data = &( compressed_data[ safe_compressed_data_offset ] );
+
+	for( copy_offset = 0;
+	     copy_offset < (size_t) literal_size;
+	     copy_offset += 16 )
+	{
+		memory_copy(
+		 &( output_data[ copy_offset ] ),
+		 &( literal_data[ copy_offset ] ),
+		 16 );
+	}
+	safe_compressed_data_offset   += literal_size;
+	safe_uncompressed_data_offset += literal_size;
+
+next_oppcode:
+	if( ( safe_compressed_data_offset > compressed_data_end_offset )
+	 || ( safe_uncompressed_data_offset > uncompressed_data_end_offset ) )
+	{
+		goto end_of_fast_loop;
+	}
+dispatch_oppcode:
+	oppcode = compressed_data[ safe_compressed_data_offset ];
+
+#if defined( __GNUC__ )
+	goto *oppcode_type_handlers[ lzvn_oppcode_types[ oppcode ] ];
+#else
+	switch( lzvn_oppcode_types[ oppcode ] )
+	{
+		case LZVN_OPPCODE_TYPE_DISTANCE_LARGE:
+			goto distance_large;
+
+		case LZVN_OPPCODE_TYPE_DISTANCE_MEDIUM:
+			goto distance_medium;
+
+		case LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS:
+			goto distance_previous;
+
+		case LZVN_OPPCODE_TYPE_DISTANCE_SMALL:
+			goto distance_small;
+
+		case LZVN_OPPCODE_TYPE_END_OF_STREAM:
+			goto end_of_stream;
+
+		case LZVN_OPPCODE_TYPE_LITERAL_LARGE:
+			goto literal_large;
+
+		case LZVN_OPPCODE_TYPE_LITERAL_SMALL:
+			goto literal_small;
+
+		case LZVN_OPPCODE_TYPE_MATCH_LARGE:
+			goto match_large;
+
+		case LZVN_OPPCODE_TYPE_MATCH_SMALL:
+			goto match_small;
+
+		case LZVN_OPPCODE_TYPE_NONE:
+			goto no_operation;
+
+		case LZVN_OPPCODE_TYPE_INVALID:
+		default:
+			goto invalid_oppcode;
+	}
+#endif
+
+end_of_fast_loop:
+	*compressed_data_offset   = safe_compressed_data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+	*distance                 = safe_distance;
+
+	return( result );
+}
+
+/* Decompresses the LZVN oppcodes with bounds checks
+ * The decoding starts at the compressed and uncompressed data offsets and
+ * distance that were reached by the caller
+ * Since verbose is a constant in each caller the inlined loop of
+ * lzvn_decompress contains no verbose output
+ * Returns 1 on success or -1 on error
+ */
+static LZVN_FORCE_INLINE int lzvn_decompress_loop(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint16_t distance,
+     const int verbose,
+     const char *function,
+     libcerror_error_t **error )
+{
+	size_t debug_match_offset  = 0;
+	size_t oppcode_data_offset = 0;
+	size_t oppcode_data_size   = 0;
+	uint16_t literal_size      = 0;
+	uint16_t match_size        = 0;
+	uint8_t oppcode            = 0;
+	uint8_t oppcode_type       = 0;
+	uint8_t oppcode_value      = 0;
+
 	while( compressed_data_offset < compressed_data_size )
 	{
 		if( uncompressed_data_offset >= *uncompressed_data_size )
@@ -417,10 +757,9 @@ int lzvn_decompress(
 
 			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
 		oppcode_data_offset = compressed_data_offset;
 		oppcode_data_size   = 1;
-#endif
+
 		oppcode = compressed_data[ compressed_data_offset++ ];
 
 		oppcode_type = lzvn_oppcode_types[ oppcode ];
@@ -431,9 +770,7 @@ int lzvn_decompress(
 		switch( oppcode_type )
 		{
 			case LZVN_OPPCODE_TYPE_DISTANCE_LARGE:
-#if defined( HAVE_DEBUG_OUTPUT )
 				oppcode_data_size += 2;
-#endif
 				if( ( compressed_data_offset + 1 ) >= compressed_data_size )
 				{
 					libcerror_error_set(
@@ -454,9 +791,7 @@ int lzvn_decompress(
 				break;
 
 			case LZVN_OPPCODE_TYPE_DISTANCE_MEDIUM:
-#if defined( HAVE_DEBUG_OUTPUT )
 				oppcode_data_size += 2;
-#endif
 				if( ( compressed_data_offset + 1 ) >= compressed_data_size )
 				{
 					libcerror_error_set(
@@ -483,9 +818,7 @@ int lzvn_decompress(
 				break;
 
 			case LZVN_OPPCODE_TYPE_DISTANCE_SMALL:
-#if defined( HAVE_DEBUG_OUTPUT )
 				oppcode_data_size += 1;
-#endif
 				if( compressed_data_offset >= compressed_data_size )
 				{
 					libcerror_error_set(
@@ -504,9 +837,7 @@ int lzvn_decompress(
 				break;
 
 			case LZVN_OPPCODE_TYPE_LITERAL_LARGE:
-#if defined( HAVE_DEBUG_OUTPUT )
 				oppcode_data_size += 1;
-#endif
 				if( compressed_data_offset >= compressed_data_size )
 				{
 					libcerror_error_set(
@@ -528,9 +859,7 @@ int lzvn_decompress(
 				break;
 
 			case LZVN_OPPCODE_TYPE_MATCH_LARGE:
-#if defined( HAVE_DEBUG_OUTPUT )
 				oppcode_data_size += 1;
-#endif
 				if( compressed_data_offset >= compressed_data_size )
 				{
 					libcerror_error_set(
@@ -567,8 +896,7 @@ int lzvn_decompress(
 
 				return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( verbose != 0 )
 		{
 			libcnotify_printf(
 			 "%s: oppcode data:\n",
@@ -601,7 +929,6 @@ int lzvn_decompress(
 			libcnotify_printf(
 			 "\n" );
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
 		if( oppcode_type == LZVN_OPPCODE_TYPE_END_OF_STREAM )
 		{
@@ -633,8 +960,7 @@ int lzvn_decompress(
 
 				return( -1 );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: literal:\n",
@@ -644,7 +970,6 @@ int lzvn_decompress(
 				 literal_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
-#endif
 			if( memory_copy(
 			     &( uncompressed_data[ uncompressed_data_offset ] ),
 			     &( compressed_data[ compressed_data_offset ] ),
@@ -675,8 +1000,6 @@ int lzvn_decompress(
 
 				return( -1 );
 			}
-			match_offset = uncompressed_data_offset - distance;
-
 			if( ( (size_t) match_size > *uncompressed_data_size )
 			 || ( uncompressed_data_offset > ( *uncompressed_data_size - match_size ) ) )
 			{
@@ -689,25 +1012,35 @@ int lzvn_decompress(
 
 				return( -1 );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( verbose != 0 )
 			{
-				debug_match_offset = match_offset;
+				debug_match_offset = uncompressed_data_offset - distance;
 
 				libcnotify_printf(
 				 "%s: match offset\t\t\t\t\t\t: 0x%" PRIzx "\n",
 				 function,
 				 debug_match_offset );
 			}
-#endif
-			while( match_size > 0 )
+			if( match_copy(
+			     uncompressed_data,
+			     *uncompressed_data_size,
+			     uncompressed_data_offset,
+			     (size_t) distance,
+			     (size_t) match_size,
+			     error ) != 1 )
 			{
-				uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
 
-				match_size--;
+				return( -1 );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			uncompressed_data_offset += (size_t) match_size;
+
+			if( verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: match:\n",
@@ -717,7 +1050,6 @@ int lzvn_decompress(
 				 match_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
-#endif
 		}
 	}
 	*uncompressed_data_size = uncompressed_data_offset;
@@ -725,3 +1057,1040 @@ int lzvn_decompress(
 	return( 1 );
 }
 
+/* Decompresses LZVN compressed data
+ * The verbose output is checked once per call, so that the decoding loop
+ * does not need to check it per oppcode
+ * The oppcodes are decoded by lzvn_decompress_fast until the margin is reached,
+ * the remaining oppcodes are decoded with bounds checks
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "lzvn_decompress";
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+	uint16_t distance               = 0;
+	int result                      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		return( lzvn_decompress_verbose(
+		         compressed_data,
+		         compressed_data_size,
+		         uncompressed_data,
+		         uncompressed_data_size,
+		         error ) );
+	}
+#endif
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = lzvn_decompress_fast(
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          *uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          &distance,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 1 )
+	{
+		*uncompressed_data_size = uncompressed_data_offset;
+
+		return( 1 );
+	}
+	/* The remaining oppcodes are decoded with bounds checks
+	 */
+	return( lzvn_decompress_loop(
+	         compressed_data,
+	         compressed_data_size,
+	         compressed_data_offset,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         uncompressed_data_offset,
+	         distance,
+	         0,
+	         function,
+	         error ) );
+}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Decompresses LZVN compressed data and prints the decoded oppcodes
+ * This function is used by lzvn_decompress when verbose output is enabled
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_decompress_verbose(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "lzvn_decompress_verbose";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( lzvn_decompress_loop(
+	         compressed_data,
+	         compressed_data_size,
+	         0,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         0,
+	         1,
+	         function,
+	         error ) );
+}
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+
+/* Writes literal oppcodes
+ * Literals that exceed the maximum literal size of an oppcode are split into multiple oppcodes
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_write_literals(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const uint8_t *literal_data,
+     size_t literal_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "lzvn_write_literals";
+	size_t literal_data_offset         = 0;
+	size_t oppcode_literal_size        = 0;
+	size_t oppcode_size                = 0;
+	size_t safe_compressed_data_offset = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( literal_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literal data.",
+		 function );
+
+		return( -1 );
+	}
+	if( literal_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid literal size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( literal_data_offset < literal_size )
+	{
+		oppcode_literal_size = literal_size - literal_data_offset;
+
+		if( oppcode_literal_size > 271 )
+		{
+			oppcode_literal_size = 271;
+		}
+		if( oppcode_literal_size >= 16 )
+		{
+			oppcode_size = 2;
+		}
+		else
+		{
+			oppcode_size = 1;
+		}
+		if( ( compressed_data_size - safe_compressed_data_offset ) < ( oppcode_size + oppcode_literal_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( oppcode_size == 2 )
+		{
+			compressed_data[ safe_compressed_data_offset++ ] = 0xe0;
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( oppcode_literal_size - 16 );
+		}
+		else
+		{
+			compressed_data[ safe_compressed_data_offset++ ] = 0xe0 | (uint8_t) oppcode_literal_size;
+		}
+		if( memory_copy(
+		     &( compressed_data[ safe_compressed_data_offset ] ),
+		     &( literal_data[ literal_data_offset ] ),
+		     oppcode_literal_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy literal to compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset += oppcode_literal_size;
+		literal_data_offset         += oppcode_literal_size;
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the oppcodes of a match and the literals that precede it
+ * Up to 3 literals are stored in the match oppcode, preceding literals are written as literal oppcodes
+ * The distance oppcode is selected based on the match distance, where a match distance equal to
+ * the previous match distance does not need to be stored. The remainder of a match that exceeds
+ * the maximum match size of the distance oppcode is written as match oppcodes
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_write_match(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const uint8_t *literal_data,
+     size_t literal_size,
+     uint16_t match_size,
+     uint16_t match_distance,
+     uint16_t *previous_match_distance,
+     libcerror_error_t **error )
+{
+	static char *function              = "lzvn_write_match";
+	size_t oppcode_size                = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint16_t maximum_match_size        = 0;
+	uint16_t oppcode_match_size        = 0;
+	uint8_t oppcode_literal_size       = 0;
+	uint8_t oppcode_type               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( literal_data == NULL )
+	 && ( literal_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literal data.",
+		 function );
+
+		return( -1 );
+	}
+	if( literal_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid literal size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_distance == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match distance value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_match_distance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous match distance.",
+		 function );
+
+		return( -1 );
+	}
+	oppcode_literal_size = (uint8_t) ( literal_size & 0x03 );
+
+	if( literal_size > 3 )
+	{
+		if( lzvn_write_literals(
+		     compressed_data,
+		     compressed_data_size,
+		     compressed_data_offset,
+		     literal_data,
+		     literal_size - oppcode_literal_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write literals.",
+			 function );
+
+			return( -1 );
+		}
+		literal_data = &( literal_data[ literal_size - oppcode_literal_size ] );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	/* A match with the previous match distance and without literals is stored as match oppcodes
+	 */
+	if( ( oppcode_literal_size > 0 )
+	 || ( match_distance != *previous_match_distance ) )
+	{
+		maximum_match_size = lzvn_maximum_oppcode_match_sizes[ oppcode_literal_size ];
+
+		if( match_distance == *previous_match_distance )
+		{
+			oppcode_type = LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS;
+			oppcode_size = 1;
+		}
+		else if( ( match_distance < 0x0600 )
+		      && ( match_size <= maximum_match_size ) )
+		{
+			oppcode_type = LZVN_OPPCODE_TYPE_DISTANCE_SMALL;
+			oppcode_size = 2;
+		}
+		else if( match_distance < 0x4000 )
+		{
+			oppcode_type       = LZVN_OPPCODE_TYPE_DISTANCE_MEDIUM;
+			oppcode_size       = 3;
+			maximum_match_size = 34;
+		}
+		else
+		{
+			oppcode_type = LZVN_OPPCODE_TYPE_DISTANCE_LARGE;
+			oppcode_size = 3;
+		}
+		if( match_size > maximum_match_size )
+		{
+			oppcode_match_size = maximum_match_size;
+		}
+		else
+		{
+			oppcode_match_size = match_size;
+		}
+		if( ( compressed_data_size - safe_compressed_data_offset ) < ( oppcode_size + oppcode_literal_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		switch( oppcode_type )
+		{
+			case LZVN_OPPCODE_TYPE_DISTANCE_LARGE:
+				compressed_data[ safe_compressed_data_offset++ ] = ( oppcode_literal_size << 6 )
+				                                                 | (uint8_t) ( ( oppcode_match_size - 3 ) << 3 )
+				                                                 | 0x07;
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( match_distance & 0x00ff );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( match_distance >> 8 );
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_MEDIUM:
+				compressed_data[ safe_compressed_data_offset++ ] = 0xa0
+				                                                 | ( oppcode_literal_size << 3 )
+				                                                 | (uint8_t) ( ( oppcode_match_size - 3 ) >> 2 );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( ( match_distance & 0x003f ) << 2 )
+				                                                 | (uint8_t) ( ( oppcode_match_size - 3 ) & 0x03 );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( match_distance >> 6 );
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS:
+				compressed_data[ safe_compressed_data_offset++ ] = ( oppcode_literal_size << 6 )
+				                                                 | (uint8_t) ( ( oppcode_match_size - 3 ) << 3 )
+				                                                 | 0x06;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_SMALL:
+				compressed_data[ safe_compressed_data_offset++ ] = ( oppcode_literal_size << 6 )
+				                                                 | (uint8_t) ( ( oppcode_match_size - 3 ) << 3 )
+				                                                 | (uint8_t) ( match_distance >> 8 );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( match_distance & 0x00ff );
+
+				break;
+		}
+		if( oppcode_literal_size > 0 )
+		{
+			if( memory_copy(
+			     &( compressed_data[ safe_compressed_data_offset ] ),
+			     literal_data,
+			     (size_t) oppcode_literal_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy literal to compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			safe_compressed_data_offset += oppcode_literal_size;
+		}
+		*previous_match_distance = match_distance;
+
+		match_size -= oppcode_match_size;
+	}
+	while( match_size > 0 )
+	{
+		oppcode_match_size = match_size;
+
+		if( oppcode_match_size > 271 )
+		{
+			oppcode_match_size = 271;
+		}
+		if( oppcode_match_size >= 16 )
+		{
+			oppcode_size = 2;
+		}
+		else
+		{
+			oppcode_size = 1;
+		}
+		if( ( compressed_data_size - safe_compressed_data_offset ) < oppcode_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( oppcode_size == 2 )
+		{
+			compressed_data[ safe_compressed_data_offset++ ] = 0xf0;
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( oppcode_match_size - 16 );
+		}
+		else
+		{
+			compressed_data[ safe_compressed_data_offset++ ] = 0xf0 | (uint8_t) oppcode_match_size;
+		}
+		match_size -= oppcode_match_size;
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZVN compression
+ * Compression level 1 uses greedy matching of the most recent candidate and
+ * compression level 2 uses lazy matching of the candidates in the hash chain.
+ * A compression level of -1 represents the default compression level
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	size_t *hash_chain               = NULL;
+	size_t *hash_heads               = NULL;
+	static char *function            = "lzvn_compress";
+	size_t compressed_data_offset    = 0;
+	size_t data_offset               = 0;
+	size_t hash_chain_offset         = 0;
+	size_t insert_data_offset        = 0;
+	size_t literal_data_offset       = 0;
+	size_t match_data_offset         = 0;
+	size_t match_end_offset          = 0;
+	uint32_t hash_value              = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t match_distance          = 0;
+	uint16_t match_size              = 0;
+	uint16_t maximum_chain_length    = 0;
+	uint16_t nice_match_size         = 0;
+	uint16_t pending_match_distance  = 0;
+	uint16_t pending_match_size      = 0;
+	uint16_t previous_match_distance = 0;
+	uint8_t lazy_matching            = 0;
+	int result                       = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == -1 )
+	{
+		compression_level = LZVN_COMPRESSION_LEVEL_LAZY;
+	}
+	if( ( compression_level < LZVN_COMPRESSION_LEVEL_FAST )
+	 || ( compression_level > LZVN_COMPRESSION_LEVEL_LAZY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_chain_length = lzvn_compression_level_configurations[ compression_level - 1 ][ 0 ];
+	nice_match_size      = lzvn_compression_level_configurations[ compression_level - 1 ][ 1 ];
+	lazy_matching        = (uint8_t) lzvn_compression_level_configurations[ compression_level - 1 ][ 2 ];
+
+	hash_heads = (size_t *) memory_allocate(
+	                         sizeof( size_t ) << LZVN_HASH_NUMBER_OF_BITS );
+
+	if( hash_heads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_heads,
+	     0,
+	     sizeof( size_t ) << LZVN_HASH_NUMBER_OF_BITS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	hash_chain = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * LZVN_WINDOW_SIZE );
+
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_chain,
+	     0,
+	     sizeof( size_t ) * LZVN_WINDOW_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_offset < uncompressed_data_size )
+	{
+		match_size = 3;
+
+		if( ( uncompressed_data_size - data_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( uncompressed_data[ data_offset ] ),
+			 value_32bit );
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - LZVN_HASH_NUMBER_OF_BITS );
+
+			hash_chain_offset = hash_heads[ hash_value ];
+
+			if( ( hash_chain_offset != 0 )
+			 && ( pending_match_size < nice_match_size ) )
+			{
+				if( pending_match_size > 3 )
+				{
+					match_size = pending_match_size;
+				}
+				result = match_finder_find_longest_match(
+				          uncompressed_data,
+				          uncompressed_data_size,
+				          data_offset,
+				          hash_chain,
+				          hash_chain_offset,
+				          LZVN_WINDOW_SIZE,
+				          LZVN_MAXIMUM_MATCH_SIZE,
+				          maximum_chain_length,
+				          nice_match_size,
+				          &match_size,
+				          &match_distance,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find longest match.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					match_size = 3;
+				}
+				/* A match of 4 bytes is only stored when the distance fits in a small distance oppcode,
+				 * otherwise the oppcode is not smaller than the literals
+				 */
+				else if( ( match_size == 4 )
+				      && ( match_distance >= 0x0600 ) )
+				{
+					match_size = 3;
+				}
+			}
+			hash_chain[ data_offset & ( LZVN_WINDOW_SIZE - 1 ) ] = hash_chain_offset;
+			hash_heads[ hash_value ]                             = data_offset + 1;
+		}
+		if( lazy_matching == 0 )
+		{
+			if( match_size < 4 )
+			{
+				data_offset++;
+
+				continue;
+			}
+			match_data_offset = data_offset;
+		}
+		else if( ( pending_match_size >= 4 )
+		      && ( match_size <= pending_match_size ) )
+		{
+			match_data_offset = data_offset - 1;
+			match_size        = pending_match_size;
+			match_distance    = pending_match_distance;
+
+			pending_match_size = 0;
+		}
+		else
+		{
+			if( match_size >= 4 )
+			{
+				pending_match_size     = match_size;
+				pending_match_distance = match_distance;
+			}
+			else
+			{
+				pending_match_size = 0;
+			}
+			data_offset++;
+
+			continue;
+		}
+		if( lzvn_write_match(
+		     compressed_data,
+		     *compressed_data_size,
+		     &compressed_data_offset,
+		     &( uncompressed_data[ literal_data_offset ] ),
+		     match_data_offset - literal_data_offset,
+		     match_size,
+		     match_distance,
+		     &previous_match_distance,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write match.",
+			 function );
+
+			goto on_error;
+		}
+		match_end_offset    = match_data_offset + match_size;
+		insert_data_offset  = data_offset + 1;
+		data_offset         = match_end_offset;
+		literal_data_offset = match_end_offset;
+
+		/* Add the positions within the match to the hash chains
+		 */
+		while( ( insert_data_offset < match_end_offset )
+		    && ( ( uncompressed_data_size - insert_data_offset ) >= 4 ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( uncompressed_data[ insert_data_offset ] ),
+			 value_32bit );
+
+			hash_value = (uint32_t) ( value_32bit * 0x9e3779b1UL ) >> ( 32 - LZVN_HASH_NUMBER_OF_BITS );
+
+			hash_chain[ insert_data_offset & ( LZVN_WINDOW_SIZE - 1 ) ] = hash_heads[ hash_value ];
+			hash_heads[ hash_value ]                                    = insert_data_offset + 1;
+
+			insert_data_offset++;
+		}
+	}
+	if( literal_data_offset < uncompressed_data_size )
+	{
+		if( lzvn_write_literals(
+		     compressed_data,
+		     *compressed_data_size,
+		     &compressed_data_offset,
+		     &( uncompressed_data[ literal_data_offset ] ),
+		     uncompressed_data_size - literal_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write literals.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The end of stream oppcode is followed by 7 bytes of padding
+	 */
+	if( ( *compressed_data_size - compressed_data_offset ) < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data[ compressed_data_offset++ ] = 0x06;
+
+	if( memory_set(
+	     &( compressed_data[ compressed_data_offset ] ),
+	     0,
+	     7 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear end of stream padding.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offset += 7;
+
+	memory_free(
+	 hash_chain );
+
+	memory_free(
+	 hash_heads );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( hash_chain != NULL )
+	{
+		memory_free(
+		 hash_chain );
+	}
+	if( hash_heads != NULL )
+	{
+		memory_free(
+		 hash_heads );
+	}
+	return( -1 );
+}
@@ -31,6 +31,46 @@
 extern "C" {
 #endif
 
+/* The compression levels
+ */
+enum LZVN_COMPRESSION_LEVELS
+{
+	LZVN_COMPRESSION_LEVEL_FAST		= 1,
+	LZVN_COMPRESSION_LEVEL_LAZY		= 2
+};
+
+/* The size of the sliding window, the largest distance that can be stored is 65535
+ */
+#define LZVN_WINDOW_SIZE			65536
+
+/* The number of bits of the match finder hash value
+ */
+#define LZVN_HASH_NUMBER_OF_BITS		14
+
+/* The maximum size of a match determined by the match finder
+ */
+#define LZVN_MAXIMUM_MATCH_SIZE			1024
+
+/* The number of bytes of compressed and uncompressed data the fast decoding loop requires
+ * after an oppcode, which is that of a large literal oppcode with 271 literals copied
+ * in blocks of 16 bytes
+ */
+#define LZVN_DECOMPRESS_FAST_MARGIN		288
+
+extern const uint8_t lzvn_maximum_oppcode_match_sizes[ 4 ];
+
+extern const uint16_t lzvn_compression_level_configurations[ 2 ][ 3 ];
+
+int lzvn_decompress_fast(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint16_t *distance,
+     libcerror_error_t **error );
+
 int lzvn_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -38,6 +78,44 @@ int lzvn_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+#if defined( HAVE_DEBUG_OUTPUT )
+
+int lzvn_decompress_verbose(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+int lzvn_write_literals(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const uint8_t *literal_data,
+     size_t literal_size,
+     libcerror_error_t **error );
+
+int lzvn_write_match(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const uint8_t *literal_data,
+     size_t literal_size,
+     uint16_t match_size,
+     uint16_t match_distance,
+     uint16_t *previous_match_distance,
+     libcerror_error_t **error );
+
+int lzvn_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,992 @@
+/*
+ * LZFSE container and chunked LZVN compressed data functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "lzvn.h"
+#include "lzvn_container.h"
+
+const uint8_t lzvn_container_block_signature_end_of_stream[ 4 ] = { 'b', 'v', 'x', '$' };
+
+const uint8_t lzvn_container_block_signature_uncompressed[ 4 ] = { 'b', 'v', 'x', '-' };
+
+const uint8_t lzvn_container_block_signature_lzvn[ 4 ] = { 'b', 'v', 'x', 'n' };
+
+/* Reads a LZFSE container block header
+ * The compressed block size is 0 for blocks that have no compressed data
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_container_read_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *block_type,
+     size_t *block_header_size,
+     uint32_t *uncompressed_block_size,
+     uint32_t *compressed_block_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "lzvn_container_read_block_header";
+	size_t safe_block_header_size   = 0;
+	uint32_t safe_compressed_size   = 0;
+	uint32_t safe_uncompressed_size = 0;
+	uint8_t safe_block_type         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block type.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_header_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     compressed_data,
+	     lzvn_container_block_signature_end_of_stream,
+	     4 ) == 0 )
+	{
+		safe_block_type        = LZVN_CONTAINER_BLOCK_TYPE_END_OF_STREAM;
+		safe_block_header_size = 4;
+	}
+	else if( memory_compare(
+	          compressed_data,
+	          lzvn_container_block_signature_uncompressed,
+	          4 ) == 0 )
+	{
+		safe_block_type        = LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED;
+		safe_block_header_size = 8;
+	}
+	else if( memory_compare(
+	          compressed_data,
+	          lzvn_container_block_signature_lzvn,
+	          4 ) == 0 )
+	{
+		safe_block_type        = LZVN_CONTAINER_BLOCK_TYPE_LZVN;
+		safe_block_header_size = 12;
+	}
+	else if( ( compressed_data[ 0 ] == (uint8_t) 'b' )
+	      && ( compressed_data[ 1 ] == (uint8_t) 'v' )
+	      && ( compressed_data[ 2 ] == (uint8_t) 'x' )
+	      && ( ( compressed_data[ 3 ] == (uint8_t) '1' )
+	       || ( compressed_data[ 3 ] == (uint8_t) '2' ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported LZFSE compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < safe_block_header_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_block_header_size >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ 4 ] ),
+		 safe_uncompressed_size );
+	}
+	if( safe_block_header_size >= 12 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ 8 ] ),
+		 safe_compressed_size );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t\t: %c%c%c%c\n",
+		 function,
+		 compressed_data[ 0 ],
+		 compressed_data[ 1 ],
+		 compressed_data[ 2 ],
+		 compressed_data[ 3 ] );
+
+		libcnotify_printf(
+		 "%s: uncompressed block size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 safe_uncompressed_size );
+
+		libcnotify_printf(
+		 "%s: compressed block size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 safe_compressed_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	*block_type              = safe_block_type;
+	*block_header_size       = safe_block_header_size;
+	*uncompressed_block_size = safe_uncompressed_size;
+	*compressed_block_size   = safe_compressed_size;
+
+	return( 1 );
+}
+
+/* Decompresses data stored in a LZFSE container with uncompressed and LZVN compressed blocks
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_container_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "lzvn_container_decompress";
+	size_t block_data_size           = 0;
+	size_t block_header_size         = 0;
+	size_t compressed_data_offset    = 0;
+	size_t safe_uncompressed_size    = 0;
+	size_t uncompressed_data_offset  = 0;
+	uint32_t compressed_block_size   = 0;
+	uint32_t uncompressed_block_size = 0;
+	uint8_t block_type               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_size = *uncompressed_data_size;
+
+	do
+	{
+		if( lzvn_container_read_block_header(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &block_type,
+		     &block_header_size,
+		     &uncompressed_block_size,
+		     &compressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		compressed_data_offset += block_header_size;
+
+		if( (size_t) uncompressed_block_size > ( safe_uncompressed_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_type == LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			block_data_size = (size_t) uncompressed_block_size;
+		}
+		else
+		{
+			block_data_size = (size_t) compressed_block_size;
+		}
+		if( block_data_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_type == LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     block_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( block_type == LZVN_CONTAINER_BLOCK_TYPE_LZVN )
+		{
+			block_data_size = (size_t) uncompressed_block_size;
+
+			if( lzvn_decompress(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     (size_t) compressed_block_size,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &block_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress LZVN compressed block.",
+				 function );
+
+				return( -1 );
+			}
+			if( block_data_size != (size_t) uncompressed_block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in uncompressed block size.",
+				 function );
+
+				return( -1 );
+			}
+			block_data_size = (size_t) compressed_block_size;
+		}
+		compressed_data_offset   += block_data_size;
+		uncompressed_data_offset += (size_t) uncompressed_block_size;
+	}
+	while( block_type != LZVN_CONTAINER_BLOCK_TYPE_END_OF_STREAM );
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of chunks from a chunk table
+ * The chunk table consists of 32-bit little-endian offsets, where the first offset
+ * is that of the first chunk, which is the size of the chunk table, and the last
+ * offset is the end of the last chunk
+ * Only the first 4 bytes of the chunk table are needed to determine the number of chunks
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_container_get_number_of_chunks(
+     const uint8_t *chunk_table_data,
+     size_t chunk_table_data_size,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "lzvn_container_get_number_of_chunks";
+	uint32_t chunk_offset = 0;
+
+	if( chunk_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_table_data_size < 4 )
+	 || ( chunk_table_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk table data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 chunk_table_data,
+	 chunk_offset );
+
+	if( ( chunk_offset < 8 )
+	 || ( ( chunk_offset % 4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first chunk offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = (int) ( chunk_offset / 4 ) - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the offset and size of a chunk from a chunk table
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_container_get_chunk_range(
+     const uint8_t *chunk_table_data,
+     size_t chunk_table_data_size,
+     int chunk_index,
+     uint32_t *chunk_offset,
+     uint32_t *chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "lzvn_container_get_chunk_range";
+	size_t chunk_table_offset  = 0;
+	uint32_t next_chunk_offset = 0;
+	uint32_t safe_chunk_offset = 0;
+	int number_of_chunks       = 0;
+
+	if( lzvn_container_get_number_of_chunks(
+	     chunk_table_data,
+	     chunk_table_data_size,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index < 0 )
+	 || ( chunk_index >= number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_table_offset = (size_t) chunk_index * 4;
+
+	if( ( chunk_table_offset + 8 ) > chunk_table_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid chunk table data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_table_data[ chunk_table_offset ] ),
+	 safe_chunk_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_table_data[ chunk_table_offset + 4 ] ),
+	 next_chunk_offset );
+
+	if( next_chunk_offset < safe_chunk_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk: %d offset value out of bounds.",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	*chunk_offset = safe_chunk_offset;
+	*chunk_size   = next_chunk_offset - safe_chunk_offset;
+
+	return( 1 );
+}
+
+/* Decompresses a chunk of chunked LZVN compressed data
+ * A chunk that starts with 0x06, which would otherwise be an empty LZVN stream,
+ * contains the uncompressed data after the first byte
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_container_decompress_chunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "lzvn_container_decompress_chunk";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == 0x06 )
+	{
+		if( ( compressed_data_size - 1 ) > *uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     uncompressed_data,
+		     &( compressed_data[ 1 ] ),
+		     compressed_data_size - 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		*uncompressed_data_size = compressed_data_size - 1;
+	}
+	else if( lzvn_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZVN compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the chunks of a worker
+ * The worker decompresses every chunk index step chunk starting with the first chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int lzvn_container_chunk_worker_decompress(
+     lzvn_container_chunk_worker_t *worker,
+     libcerror_error_t **error )
+{
+	lzvn_container_chunk_t *chunk = NULL;
+	static char *function         = "lzvn_container_chunk_worker_decompress";
+	int chunk_index               = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->chunk_index_step <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker - chunk index step value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = worker->first_chunk_index;
+	     chunk_index < worker->number_of_chunks;
+	     chunk_index += worker->chunk_index_step )
+	{
+		chunk = &( worker->chunks[ chunk_index ] );
+
+		if( lzvn_container_decompress_chunk(
+		     chunk->compressed_data,
+		     chunk->compressed_data_size,
+		     chunk->uncompressed_data,
+		     &( chunk->uncompressed_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* The chunk worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int lzvn_container_chunk_worker_thread_function(
+     void *arguments )
+{
+	lzvn_container_chunk_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (lzvn_container_chunk_worker_t *) arguments;
+
+	worker->result = lzvn_container_chunk_worker_decompress(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Decompresses chunks of chunked LZVN compressed data using multiple threads
+ * The chunks are independent, hence every thread decompresses its chunks
+ * directly into their uncompressed data buffers
+ * Without multi-thread support the chunks are decompressed one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int lzvn_container_decompress_chunks(
+     lzvn_container_chunk_t *chunks,
+     int number_of_chunks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	lzvn_container_chunk_worker_t *workers = NULL;
+	static char *function                  = "lzvn_container_decompress_chunks";
+	int number_of_workers                  = 0;
+	int result                             = 1;
+	int worker_index                       = 0;
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZVN_CONTAINER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_workers = number_of_threads;
+
+	if( number_of_chunks < number_of_workers )
+	{
+		number_of_workers = number_of_chunks;
+	}
+	workers = (lzvn_container_chunk_worker_t *) memory_allocate(
+	                                             sizeof( lzvn_container_chunk_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( lzvn_container_chunk_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		workers[ worker_index ].chunks            = chunks;
+		workers[ worker_index ].number_of_chunks  = number_of_chunks;
+		workers[ worker_index ].first_chunk_index = worker_index;
+		workers[ worker_index ].chunk_index_step  = number_of_workers;
+		workers[ worker_index ].result            = -1;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     &lzvn_container_chunk_worker_thread_function,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+#else
+		lzvn_container_chunk_worker_thread_function(
+		 (void *) &( workers[ worker_index ] ) );
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Join all the threads that were created, also on error
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif
+	if( result == 1 )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunks of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+	memory_free(
+	 workers );
+
+	return( result );
+}
+
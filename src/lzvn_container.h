@@ -0,0 +1,168 @@
+/*
+ * LZFSE container and chunked LZVN compressed data functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LZVN_CONTAINER_H )
+#define _LZVN_CONTAINER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The container block types
+ */
+enum LZVN_CONTAINER_BLOCK_TYPES
+{
+	LZVN_CONTAINER_BLOCK_TYPE_END_OF_STREAM	= 1,
+	LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED	= 2,
+	LZVN_CONTAINER_BLOCK_TYPE_LZVN		= 3
+};
+
+#define LZVN_CONTAINER_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The maximum size of a supported block header, which is that of a LZVN compressed block
+ */
+#define LZVN_CONTAINER_BLOCK_HEADER_MAXIMUM_SIZE	12
+
+/* The size of the uncompressed data of a chunk of chunked LZVN compressed data
+ */
+#define LZVN_CONTAINER_CHUNK_SIZE			65536
+
+extern const uint8_t lzvn_container_block_signature_end_of_stream[ 4 ];
+
+extern const uint8_t lzvn_container_block_signature_uncompressed[ 4 ];
+
+extern const uint8_t lzvn_container_block_signature_lzvn[ 4 ];
+
+typedef struct lzvn_container_chunk lzvn_container_chunk_t;
+
+struct lzvn_container_chunk
+{
+	/* The compressed data of the chunk
+	 */
+	const uint8_t *compressed_data;
+
+	/* The size of the compressed data of the chunk
+	 */
+	size_t compressed_data_size;
+
+	/* The buffer for the uncompressed data of the chunk
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The size of the uncompressed data of the chunk
+	 * On input the size of the buffer, on output the size of the uncompressed data
+	 */
+	size_t uncompressed_data_size;
+};
+
+typedef struct lzvn_container_chunk_worker lzvn_container_chunk_worker_t;
+
+struct lzvn_container_chunk_worker
+{
+	/* The chunks
+	 */
+	lzvn_container_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the first chunk decompressed by the worker
+	 */
+	int first_chunk_index;
+
+	/* The number of chunks between the chunks decompressed by the worker
+	 */
+	int chunk_index_step;
+
+	/* The result of the worker
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int lzvn_container_read_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *block_type,
+     size_t *block_header_size,
+     uint32_t *uncompressed_block_size,
+     uint32_t *compressed_block_size,
+     libcerror_error_t **error );
+
+int lzvn_container_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzvn_container_get_number_of_chunks(
+     const uint8_t *chunk_table_data,
+     size_t chunk_table_data_size,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+int lzvn_container_get_chunk_range(
+     const uint8_t *chunk_table_data,
+     size_t chunk_table_data_size,
+     int chunk_index,
+     uint32_t *chunk_offset,
+     uint32_t *chunk_size,
+     libcerror_error_t **error );
+
+int lzvn_container_decompress_chunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzvn_container_chunk_worker_decompress(
+     lzvn_container_chunk_worker_t *worker,
+     libcerror_error_t **error );
+
+int lzvn_container_chunk_worker_thread_function(
+     void *arguments );
+
+int lzvn_container_decompress_chunks(
+     lzvn_container_chunk_t *chunks,
+     int number_of_chunks,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LZVN_CONTAINER_H ) */
+
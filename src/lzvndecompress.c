@@ -36,6 +36,7 @@
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
 #include "lzvn.h"
+#include "lzvn_container.h"
 
 /* Prints the executable usage information
  */
@@ -48,16 +49,25 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzvndecompress to decompress data as LZVN compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzvndecompress [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzvndecompress [ -o offset ] [ -s size ] [ -t threads ]\n"
+	                 "                      [ -chvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-c:     the data is chunked, it starts with a table of the offsets\n"
+	                 "\t        of 64 KiB chunks that are compressed independently, such as\n"
+	                 "\t        the resource fork of a decmpfs compressed file\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     number of threads to decompress chunked data with\n"
+	                 "\t        (default is 1)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
+	fprintf( stream, "Data that starts with a LZFSE block signature is decompressed\n"
+	                 "block by block, other data as a single LZVN stream.\n" );
+	fprintf( stream, "\n" );
 }
 
 /* The main program
@@ -68,21 +78,45 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
+	uint8_t block_header[ LZVN_CONTAINER_BLOCK_HEADER_MAXIMUM_SIZE ];
 	char destination[ 128 ];
 
 	libcerror_error_t *error          = NULL;
 	libcfile_file_t *destination_file = NULL;
 	libcfile_file_t *source_file      = NULL;
+	lzvn_container_chunk_t *chunks    = NULL;
 	system_character_t *source        = NULL;
 	uint8_t *buffer                   = NULL;
+	uint8_t *chunk_table_data         = NULL;
+	uint8_t *reallocation             = NULL;
 	uint8_t *uncompressed_data        = NULL;
 	char *program                     = "lzvndecompress";
 	system_integer_t option           = 0;
+	size64_t source_data_offset       = 0;
 	size64_t source_size              = 0;
+	size_t block_data_size            = 0;
+	size_t block_header_size          = 0;
+	size_t buffer_size                = 0;
+	size_t chunk_table_data_size      = 0;
+	size_t read_size                  = 0;
 	size_t uncompressed_data_size     = 0;
 	ssize_t read_count                = 0;
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
+	uint32_t chunk_offset             = 0;
+	uint32_t chunk_size               = 0;
+	uint32_t compressed_block_size    = 0;
+	uint32_t first_chunk_offset       = 0;
+	uint32_t uncompressed_block_size  = 0;
+	uint8_t block_type                = 0;
+	int chunk_index                   = 0;
+	int chunked_format                = 0;
+	int container_format              = 0;
+	int first_chunk_index             = 0;
+	int number_of_batch_chunks        = 0;
+	int number_of_chunks              = 0;
+	int number_of_chunks_per_batch    = 0;
+	int number_of_threads             = 1;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -94,7 +128,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "cho:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -110,6 +144,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'c':
+				chunked_format = 1;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -132,6 +171,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -157,6 +204,30 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LZVN_CONTAINER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( chunked_format == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Threads are only supported for chunked data.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -226,30 +297,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	uncompressed_data_size = source_size * 16;
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -264,6 +311,44 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Determine if the data is stored in a LZFSE container
+	 */
+	if( ( chunked_format == 0 )
+	 && ( source_size >= 4 ) )
+	{
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      block_header,
+			      4,
+			      &error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( ( block_header[ 0 ] == (uint8_t) 'b' )
+		 && ( block_header[ 1 ] == (uint8_t) 'v' )
+		 && ( block_header[ 2 ] == (uint8_t) 'x' ) )
+		{
+			container_format = 1;
+		}
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     source_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
+
+			goto on_error;
+		}
+	}
 	print_count = narrow_string_snprintf(
 	               destination,
 	               128,
@@ -279,35 +364,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Read and decompress the data
-	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
-
-		goto on_error;
-	}
-	if( lzvn_decompress(
-	     buffer,
-	     source_size,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to decompress data.\n" );
-
-		goto on_error;
-	}
 	/* Open the destination file
 	 */
 	if( libcfile_file_initialize(
@@ -341,19 +397,526 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+	if( chunked_format != 0 )
+	{
+		/* The chunks are read and decompressed in batches so that the memory usage
+		 * does not depend on the size of the source or uncompressed data
+		 */
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      block_header,
+			      4,
+			      &error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( lzvn_container_get_number_of_chunks(
+		     block_header,
+		     4,
+		     &number_of_chunks,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of chunks.\n" );
+
+			goto on_error;
+		}
+		chunk_table_data_size = ( (size_t) number_of_chunks + 1 ) * 4;
+
+		if( (size64_t) chunk_table_data_size > source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid chunk table size value out of bounds.\n" );
+
+			goto on_error;
+		}
+		chunk_table_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * chunk_table_data_size );
+
+		if( chunk_table_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create chunk table data.\n" );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     chunk_table_data,
+		     block_header,
+		     4 ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy chunk table data.\n" );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      &( chunk_table_data[ 4 ] ),
+			      chunk_table_data_size - 4,
+			      &error );
+
+		if( read_count != (ssize_t) ( chunk_table_data_size - 4 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read chunk table from source file.\n" );
+
+			goto on_error;
+		}
+		/* A batch contains multiple chunks per thread to limit the number
+		 * of times threads are created
+		 */
+		number_of_chunks_per_batch = number_of_threads * 16;
+
+		chunks = (lzvn_container_chunk_t *) memory_allocate(
+		                                     sizeof( lzvn_container_chunk_t ) * number_of_chunks_per_batch );
+
+		if( chunks == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create chunks.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data_size = (size_t) number_of_chunks_per_batch * LZVN_CONTAINER_CHUNK_SIZE;
 
-	if( write_count != (ssize_t) uncompressed_data_size )
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		for( first_chunk_index = 0;
+		     first_chunk_index < number_of_chunks;
+		     first_chunk_index += number_of_batch_chunks )
+		{
+			number_of_batch_chunks = number_of_chunks - first_chunk_index;
+
+			if( number_of_batch_chunks > number_of_chunks_per_batch )
+			{
+				number_of_batch_chunks = number_of_chunks_per_batch;
+			}
+			/* The chunks of a batch are stored consecutively
+			 */
+			read_size = 0;
+
+			for( chunk_index = 0;
+			     chunk_index < number_of_batch_chunks;
+			     chunk_index++ )
+			{
+				if( lzvn_container_get_chunk_range(
+				     chunk_table_data,
+				     chunk_table_data_size,
+				     first_chunk_index + chunk_index,
+				     &chunk_offset,
+				     &chunk_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to retrieve range of chunk: %d.\n",
+					 first_chunk_index + chunk_index );
+
+					goto on_error;
+				}
+				if( chunk_index == 0 )
+				{
+					first_chunk_offset = chunk_offset;
+				}
+				chunks[ chunk_index ].compressed_data_size   = (size_t) chunk_size;
+				chunks[ chunk_index ].uncompressed_data      = &( uncompressed_data[ chunk_index * LZVN_CONTAINER_CHUNK_SIZE ] );
+				chunks[ chunk_index ].uncompressed_data_size = LZVN_CONTAINER_CHUNK_SIZE;
+
+				read_size += (size_t) chunk_size;
+			}
+			if( ( (size64_t) first_chunk_offset > source_size )
+			 || ( (size64_t) read_size > ( source_size - first_chunk_offset ) ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid chunk offset value out of bounds.\n" );
+
+				goto on_error;
+			}
+			if( read_size > buffer_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            buffer,
+				                            sizeof( uint8_t ) * read_size );
+
+				if( reallocation == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resize buffer.\n" );
+
+					goto on_error;
+				}
+				buffer      = reallocation;
+				buffer_size = read_size;
+			}
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     source_offset + (off_t) first_chunk_offset,
+			     SEEK_SET,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to seek chunk offset in source file.\n" );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			read_size = 0;
+
+			for( chunk_index = 0;
+			     chunk_index < number_of_batch_chunks;
+			     chunk_index++ )
+			{
+				chunks[ chunk_index ].compressed_data = &( buffer[ read_size ] );
+
+				read_size += chunks[ chunk_index ].compressed_data_size;
+			}
+			if( lzvn_container_decompress_chunks(
+			     chunks,
+			     number_of_batch_chunks,
+			     number_of_threads,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress chunks.\n" );
+
+				goto on_error;
+			}
+			for( chunk_index = 0;
+			     chunk_index < number_of_batch_chunks;
+			     chunk_index++ )
+			{
+				write_count = libcfile_file_write_buffer(
+					       destination_file,
+					       chunks[ chunk_index ].uncompressed_data,
+					       chunks[ chunk_index ].uncompressed_data_size,
+					       &error );
+
+				if( write_count != (ssize_t) chunks[ chunk_index ].uncompressed_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to destination file.\n" );
+
+					goto on_error;
+				}
+			}
+		}
+		memory_free(
+		 chunks );
+
+		chunks = NULL;
+
+		memory_free(
+		 chunk_table_data );
+
+		chunk_table_data = NULL;
+	}
+	else if( container_format != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		/* The blocks are read and decompressed one at a time so that the memory usage
+		 * depends on the size of the largest block
+		 */
+		do
+		{
+			read_size = LZVN_CONTAINER_BLOCK_HEADER_MAXIMUM_SIZE;
 
-		goto on_error;
+			if( (size64_t) read_size > ( source_size - source_data_offset ) )
+			{
+				read_size = (size_t) ( source_size - source_data_offset );
+			}
+			if( read_size < 4 )
+			{
+				fprintf(
+				 stderr,
+				 "Missing end of stream block.\n" );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      block_header,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			if( lzvn_container_read_block_header(
+			     block_header,
+			     read_size,
+			     &block_type,
+			     &block_header_size,
+			     &uncompressed_block_size,
+			     &compressed_block_size,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read block header at offset: %" PRIu64 ".\n",
+				 source_data_offset );
+
+				goto on_error;
+			}
+			source_data_offset += block_header_size;
+
+			if( block_type == LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED )
+			{
+				block_data_size = (size_t) uncompressed_block_size;
+			}
+			else
+			{
+				block_data_size = (size_t) compressed_block_size;
+			}
+			if( (size64_t) block_data_size > ( source_size - source_data_offset ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid block size value out of bounds.\n" );
+
+				goto on_error;
+			}
+			if( block_data_size > buffer_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            buffer,
+				                            sizeof( uint8_t ) * block_data_size );
+
+				if( reallocation == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resize buffer.\n" );
+
+					goto on_error;
+				}
+				buffer      = reallocation;
+				buffer_size = block_data_size;
+			}
+			if( block_type == LZVN_CONTAINER_BLOCK_TYPE_LZVN )
+			{
+				if( (size_t) uncompressed_block_size > uncompressed_data_size )
+				{
+					reallocation = (uint8_t *) memory_reallocate(
+					                            uncompressed_data,
+					                            sizeof( uint8_t ) * uncompressed_block_size );
+
+					if( reallocation == NULL )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to resize uncompressed data buffer.\n" );
+
+						goto on_error;
+					}
+					uncompressed_data      = reallocation;
+					uncompressed_data_size = (size_t) uncompressed_block_size;
+				}
+			}
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     source_offset + (off_t) source_data_offset,
+			     SEEK_SET,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to seek block data offset in source file.\n" );
+
+				goto on_error;
+			}
+			if( block_data_size > 0 )
+			{
+				read_count = libcfile_file_read_buffer(
+					      source_file,
+					      buffer,
+					      block_data_size,
+					      &error );
+
+				if( read_count != (ssize_t) block_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read from source file.\n" );
+
+					goto on_error;
+				}
+			}
+			source_data_offset += block_data_size;
+
+			if( ( block_type == LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED )
+			 && ( block_data_size > 0 ) )
+			{
+				write_count = libcfile_file_write_buffer(
+					       destination_file,
+					       buffer,
+					       block_data_size,
+					       &error );
+
+				if( write_count != (ssize_t) block_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to destination file.\n" );
+
+					goto on_error;
+				}
+			}
+			else if( block_type == LZVN_CONTAINER_BLOCK_TYPE_LZVN )
+			{
+				block_data_size = (size_t) uncompressed_block_size;
+
+				if( lzvn_decompress(
+				     buffer,
+				     (size_t) compressed_block_size,
+				     uncompressed_data,
+				     &block_data_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to decompress block.\n" );
+
+					goto on_error;
+				}
+				if( block_data_size != (size_t) uncompressed_block_size )
+				{
+					fprintf(
+					 stderr,
+					 "Mismatch in uncompressed block size.\n" );
+
+					goto on_error;
+				}
+				write_count = libcfile_file_write_buffer(
+					       destination_file,
+					       uncompressed_data,
+					       block_data_size,
+					       &error );
+
+				if( write_count != (ssize_t) block_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to destination file.\n" );
+
+					goto on_error;
+				}
+			}
+		}
+		while( block_type != LZVN_CONTAINER_BLOCK_TYPE_END_OF_STREAM );
+	}
+	else
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data_size = source_size * 16;
+
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		/* Read and decompress the data
+		 */
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      source_size,
+			      &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( lzvn_decompress(
+		     buffer,
+		     source_size,
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress data.\n" );
+
+			goto on_error;
+		}
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
+
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -397,12 +960,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
-	memory_free(
-	 buffer );
-
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
 	if( result == -1 )
 	{
 		fprintf(
@@ -431,6 +998,16 @@ on_error:
 		 &destination_file,
 		 NULL );
 	}
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	if( chunk_table_data != NULL )
+	{
+		memory_free(
+		 chunk_table_data );
+	}
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
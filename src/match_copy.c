@@ -0,0 +1,235 @@
+/*
+ * Overlapping match copy functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "match_copy.h"
+
+/* Copies a match of previous data in the buffer to the buffer offset
+ * The match starts distance bytes before the buffer offset and can overlap the data it produces
+ * If the buffer contains MATCH_COPY_SLACK_SIZE bytes after the end of the match, the match is
+ * copied in blocks of 8, 16 or 32 bytes depending on the distance, otherwise it is copied exactly
+ * Returns 1 if successful or -1 on error
+ */
+int match_copy(
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t distance,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t pattern[ 8 ];
+
+	uint8_t *match_data   = NULL;
+	uint8_t *match_end    = NULL;
+	uint8_t *output_data  = NULL;
+	static char *function = "match_copy";
+	size_t pattern_index  = 0;
+	size_t pattern_size   = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( distance == 0 )
+	 || ( distance > buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( buffer_size - buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	output_data = &( buffer[ buffer_offset ] );
+	match_data  = &( buffer[ buffer_offset - distance ] );
+	match_end   = &( output_data[ size ] );
+
+	if( distance == 1 )
+	{
+		if( memory_set(
+		     output_data,
+		     *match_data,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set match.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( buffer_size - buffer_offset - size ) < MATCH_COPY_SLACK_SIZE )
+	{
+		if( distance >= size )
+		{
+			if( memory_copy(
+			     output_data,
+			     match_data,
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			while( output_data < match_end )
+			{
+				*output_data++ = *match_data++;
+			}
+		}
+		return( 1 );
+	}
+	/* The source of a block does not overlap with its destination if the distance
+	 * is at least the block size, the last block can write upto the block size minus 1
+	 * bytes beyond the end of the match
+	 */
+	if( distance >= 32 )
+	{
+		do
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 32 );
+
+			output_data += 32;
+			match_data  += 32;
+		}
+		while( output_data < match_end );
+	}
+	else if( distance >= 16 )
+	{
+		do
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 16 );
+
+			output_data += 16;
+			match_data  += 16;
+		}
+		while( output_data < match_end );
+	}
+	else if( distance >= 8 )
+	{
+		do
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 8 );
+
+			output_data += 8;
+			match_data  += 8;
+		}
+		while( output_data < match_end );
+	}
+	else
+	{
+		/* Replicate the pattern of distance bytes into 8 bytes and advance by
+		 * the largest multiple of the distance so that the next block continues
+		 * the pattern
+		 */
+		for( pattern_index = 0;
+		     pattern_index < 8;
+		     pattern_index++ )
+		{
+			pattern[ pattern_index ] = match_data[ pattern_index % distance ];
+		}
+		pattern_size = 8 - ( 8 % distance );
+
+		do
+		{
+			memory_copy(
+			 output_data,
+			 pattern,
+			 8 );
+
+			output_data += pattern_size;
+		}
+		while( output_data < match_end );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,223 @@
+/*
+ * Hash chain match finder functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "match_finder.h"
+
+/* Finds the longest match in the hash chain
+ * The hash chain contains for every offset in the window the previous offset + 1 with the same
+ * hash or 0, where the window size must be a power of 2 of at most 65536 so that the distance
+ * fits in 16-bit
+ * The match size should contain the size of the match to improve on
+ * Returns 1 if a longer match was found, 0 if not or -1 on error
+ */
+int match_finder_find_longest_match(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     const size_t *hash_chain,
+     size_t hash_chain_offset,
+     size_t window_size,
+     uint16_t maximum_match_size,
+     uint16_t maximum_chain_length,
+     uint16_t nice_match_size,
+     uint16_t *match_size,
+     uint16_t *match_distance,
+     libcerror_error_t **error )
+{
+	const uint8_t *candidate_data  = NULL;
+	const uint8_t *match_data      = NULL;
+	static char *function          = "match_finder_find_longest_match";
+	size_t candidate_offset        = 0;
+	size_t distance                = 0;
+	uint64_t candidate_value_64bit = 0;
+	uint64_t match_value_64bit     = 0;
+	uint16_t best_match_distance   = 0;
+	uint16_t best_match_size       = 0;
+	uint16_t candidate_size        = 0;
+	int result                     = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset >= uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > 65536 )
+	 || ( ( window_size & ( window_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match size.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_distance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match distance.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size - uncompressed_data_offset ) < maximum_match_size )
+	{
+		maximum_match_size = (uint16_t) ( uncompressed_data_size - uncompressed_data_offset );
+	}
+	best_match_size = *match_size;
+
+	if( best_match_size >= maximum_match_size )
+	{
+		return( 0 );
+	}
+	if( nice_match_size > maximum_match_size )
+	{
+		nice_match_size = maximum_match_size;
+	}
+	match_data = &( uncompressed_data[ uncompressed_data_offset ] );
+
+	while( ( hash_chain_offset != 0 )
+	    && ( maximum_chain_length > 0 ) )
+	{
+		candidate_offset = hash_chain_offset - 1;
+
+		/* The hash chain of candidates outside the window can have been overwritten
+		 */
+		distance = uncompressed_data_offset - candidate_offset;
+
+		if( distance >= window_size )
+		{
+			break;
+		}
+		candidate_data = &( uncompressed_data[ candidate_offset ] );
+
+		if( ( candidate_data[ best_match_size ] == match_data[ best_match_size ] )
+		 && ( candidate_data[ 0 ] == match_data[ 0 ] )
+		 && ( candidate_data[ 1 ] == match_data[ 1 ] ) )
+		{
+			candidate_size = 2;
+
+			while( ( maximum_match_size - candidate_size ) >= 8 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( candidate_data[ candidate_size ] ),
+				 candidate_value_64bit );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 &( match_data[ candidate_size ] ),
+				 match_value_64bit );
+
+				match_value_64bit ^= candidate_value_64bit;
+
+				if( match_value_64bit != 0 )
+				{
+					while( ( match_value_64bit & 0xff ) == 0 )
+					{
+						match_value_64bit >>= 8;
+
+						candidate_size++;
+					}
+					break;
+				}
+				candidate_size += 8;
+			}
+			if( ( maximum_match_size - candidate_size ) < 8 )
+			{
+				while( ( candidate_size < maximum_match_size )
+				    && ( candidate_data[ candidate_size ] == match_data[ candidate_size ] ) )
+				{
+					candidate_size++;
+				}
+			}
+			if( candidate_size > best_match_size )
+			{
+				best_match_size     = candidate_size;
+				best_match_distance = (uint16_t) distance;
+
+				result = 1;
+
+				if( best_match_size >= nice_match_size )
+				{
+					break;
+				}
+			}
+		}
+		hash_chain_offset = hash_chain[ candidate_offset & ( window_size - 1 ) ];
+
+		maximum_chain_length--;
+	}
+	if( result != 0 )
+	{
+		*match_size     = best_match_size;
+		*match_distance = best_match_distance;
+	}
+	return( result );
+}
+
@@ -0,0 +1,572 @@
+/*
+ * Parallel checksum functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "adler32.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+#include "block_reader.h"
+#include "checksum.h"
+#include "crc32.h"
+#include "parallel_checksum.h"
+
+/* Calculates the checksum of the range of a worker
+ * The worker opens its own file so that the ranges can be read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_checksum_worker_calculate(
+     parallel_checksum_worker_t *worker,
+     libcerror_error_t **error )
+{
+	block_reader_t *block_reader = NULL;
+	libcfile_file_t *file        = NULL;
+	uint8_t *block_data          = NULL;
+	static char *function        = "parallel_checksum_worker_calculate";
+	size_t block_data_size       = 0;
+	uint32_t checksum_value      = 0;
+	int result                   = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker->checksum_type != PARALLEL_CHECKSUM_TYPE_ADLER32 )
+	 && ( worker->checksum_type != PARALLEL_CHECKSUM_TYPE_CRC32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          worker->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          worker->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_seek_offset(
+	     file,
+	     worker->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in file.",
+		 function,
+		 worker->offset );
+
+		goto on_error;
+	}
+	if( block_reader_initialize(
+	     &block_reader,
+	     worker->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( block_reader_open(
+	     block_reader,
+	     file,
+	     worker->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open block reader.",
+		 function );
+
+		goto on_error;
+	}
+	checksum_value = (uint32_t) worker->initial_value;
+
+	while( ( result = block_reader_get_next_block(
+	                   block_reader,
+	                   &block_data,
+	                   &block_data_size,
+	                   error ) ) == 1 )
+	{
+		if( worker->checksum_type == PARALLEL_CHECKSUM_TYPE_ADLER32 )
+		{
+			result = checksum_calculate_adler32(
+			          &checksum_value,
+			          block_data,
+			          block_data_size,
+			          checksum_value,
+			          error );
+		}
+		else
+		{
+			result = checksum_calculate_crc32(
+			          &checksum_value,
+			          block_data,
+			          block_data_size,
+			          checksum_value,
+			          worker->weak_crc,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		goto on_error;
+	}
+	if( block_reader_free(
+	     &block_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	worker->checksum = (uint64_t) checksum_value;
+
+	return( 1 );
+
+on_error:
+	if( block_reader != NULL )
+	{
+		block_reader_free(
+		 &block_reader,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_checksum_worker_thread_function(
+     void *arguments )
+{
+	parallel_checksum_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (parallel_checksum_worker_t *) arguments;
+
+	worker->result = parallel_checksum_worker_calculate(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Calculates the checksum of the data of a file using multiple threads
+ * The data is split into a consecutive range per thread, the checksums of
+ * the ranges are calculated concurrently and combined afterwards
+ * Without multi-thread support the ranges are calculated one after the other
+ * The polynomial is only used by the CRC-32 and must match the one used
+ * to initialize the CRC-32 table
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_checksum_calculate(
+     uint64_t *checksum,
+     int checksum_type,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size,
+     size_t block_size,
+     int number_of_threads,
+     uint64_t initial_value,
+     uint8_t weak_crc,
+     uint64_t polynomial,
+     libcerror_error_t **error )
+{
+	parallel_checksum_worker_t *workers = NULL;
+	static char *function               = "parallel_checksum_calculate";
+	size64_t range_size                 = 0;
+	uint32_t checksum_value             = 0;
+	int number_of_workers               = 0;
+	int result                          = 1;
+	int worker_index                    = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_type != PARALLEL_CHECKSUM_TYPE_ADLER32 )
+	 && ( checksum_type != PARALLEL_CHECKSUM_TYPE_CRC32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum type.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) BLOCK_READER_MAXIMUM_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > PARALLEL_CHECKSUM_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a single block per thread at minimum, more threads than blocks
+	 * only add overhead
+	 */
+	number_of_workers = number_of_threads;
+
+	if( size < ( (size64_t) number_of_workers * block_size ) )
+	{
+		number_of_workers = (int) ( size / block_size );
+
+		if( number_of_workers == 0 )
+		{
+			number_of_workers = 1;
+		}
+	}
+	range_size = size / number_of_workers;
+
+	workers = (parallel_checksum_worker_t *) memory_allocate(
+	                                          sizeof( parallel_checksum_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( parallel_checksum_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	/* The checksums of all but the first range are calculated with
+	 * an initial value of 0 as required to combine them
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		workers[ worker_index ].filename      = filename;
+		workers[ worker_index ].offset        = offset + (off64_t) ( worker_index * range_size );
+		workers[ worker_index ].size          = range_size;
+		workers[ worker_index ].block_size    = block_size;
+		workers[ worker_index ].checksum_type = checksum_type;
+		workers[ worker_index ].weak_crc      = weak_crc;
+		workers[ worker_index ].result        = -1;
+	}
+	workers[ 0 ].initial_value = initial_value;
+
+	/* The last range also contains the remainder of the data
+	 */
+	workers[ number_of_workers - 1 ].size += size % number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     &parallel_checksum_worker_thread_function,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+#else
+		parallel_checksum_worker_thread_function(
+		 (void *) &( workers[ worker_index ] ) );
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Join all the threads that were created, also on error
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	/* Combine the checksums of the ranges in order
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum of range: %d at offset: %" PRIi64 ".",
+			 function,
+			 worker_index,
+			 workers[ worker_index ].offset );
+
+			goto on_error;
+		}
+		if( worker_index == 0 )
+		{
+			checksum_value = (uint32_t) workers[ worker_index ].checksum;
+		}
+		else if( checksum_type == PARALLEL_CHECKSUM_TYPE_ADLER32 )
+		{
+			result = adler32_combine_checksums(
+			          &checksum_value,
+			          checksum_value,
+			          (uint32_t) workers[ worker_index ].checksum,
+			          workers[ worker_index ].size,
+			          error );
+		}
+		else
+		{
+			result = crc32_combine_checksums(
+			          &checksum_value,
+			          checksum_value,
+			          (uint32_t) workers[ worker_index ].checksum,
+			          workers[ worker_index ].size,
+			          (uint32_t) polynomial,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to combine checksum of range: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 workers );
+
+	*checksum = (uint64_t) checksum_value;
+
+	return( 1 );
+
+on_error:
+	if( workers != NULL )
+	{
+		memory_free(
+		 workers );
+	}
+	return( -1 );
+}
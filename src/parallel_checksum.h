@@ -0,0 +1,114 @@
+/*
+ * Parallel checksum functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PARALLEL_CHECKSUM_H )
+#define _PARALLEL_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define PARALLEL_CHECKSUM_MAXIMUM_NUMBER_OF_THREADS	256
+
+enum PARALLEL_CHECKSUM_TYPES
+{
+	PARALLEL_CHECKSUM_TYPE_ADLER32	= 1,
+	PARALLEL_CHECKSUM_TYPE_CRC32	= 2
+};
+
+typedef struct parallel_checksum_worker parallel_checksum_worker_t;
+
+struct parallel_checksum_worker
+{
+	/* The source filename
+	 */
+	const system_character_t *filename;
+
+	/* The offset of the range
+	 */
+	off64_t offset;
+
+	/* The size of the range
+	 */
+	size64_t size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The checksum type
+	 */
+	int checksum_type;
+
+	/* The initial value
+	 */
+	uint64_t initial_value;
+
+	/* Value to indicate a weak CRC should be calculated
+	 */
+	uint8_t weak_crc;
+
+	/* The calculated checksum of the range
+	 */
+	uint64_t checksum;
+
+	/* The result of the calculation
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int parallel_checksum_worker_calculate(
+     parallel_checksum_worker_t *worker,
+     libcerror_error_t **error );
+
+int parallel_checksum_worker_thread_function(
+     void *arguments );
+
+int parallel_checksum_calculate(
+     uint64_t *checksum,
+     int checksum_type,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size,
+     size_t block_size,
+     int number_of_threads,
+     uint64_t initial_value,
+     uint8_t weak_crc,
+     uint64_t polynomial,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PARALLEL_CHECKSUM_H ) */
@@ -0,0 +1,2833 @@
+/*
+ * Parallel deflate (zlib) functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "adler32.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "bit_stream.h"
+#include "deflate.h"
+#include "gzip.h"
+#include "huffman_tree.h"
+#include "parallel_deflate.h"
+
+/* Compresses the chunk of a worker as raw deflate blocks
+ * The chunk is compressed with the preceding uncompressed data as preset dictionary
+ * and, unless it is the last chunk, ends with an empty uncompressed block so that
+ * the compressed data ends on a byte boundary (sync flush)
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_worker_compress(
+     parallel_deflate_worker_t *worker,
+     libcerror_error_t **error )
+{
+	deflate_bit_writer_t bit_writer;
+
+	static char *function = "parallel_deflate_worker_compress";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->dictionary_size > worker->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker - dictionary size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_writer.byte_stream        = worker->compressed_data;
+	bit_writer.byte_stream_size   = worker->compressed_data_size;
+	bit_writer.byte_stream_offset = 0;
+	bit_writer.bit_buffer         = 0;
+	bit_writer.bit_buffer_size    = 0;
+
+	if( deflate_write_blocks(
+	     &bit_writer,
+	     worker->uncompressed_data,
+	     worker->uncompressed_data_size,
+	     worker->dictionary_size,
+	     worker->compression_level,
+	     worker->last_chunk_flag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->last_chunk_flag != 0 )
+	{
+		if( deflate_bit_writer_flush(
+		     &bit_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to flush bit writer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( deflate_write_stored_block(
+		     &bit_writer,
+		     &( worker->uncompressed_data[ worker->dictionary_size ] ),
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to write sync flush block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	worker->compressed_data_offset = bit_writer.byte_stream_offset;
+
+	if( deflate_calculate_adler32(
+	     &( worker->checksum ),
+	     &( worker->uncompressed_data[ worker->dictionary_size ] ),
+	     worker->uncompressed_data_size - worker->dictionary_size,
+	     worker->initial_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_worker_thread_function(
+     void *arguments )
+{
+	parallel_deflate_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (parallel_deflate_worker_t *) arguments;
+
+	worker->result = parallel_deflate_worker_compress(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Compresses data using zlib compression and multiple threads
+ * The data is split into chunks that are compressed concurrently, each with
+ * the last 32 KiB of the preceding chunk as preset dictionary. The compressed
+ * chunks are concatenated into a single zlib stream and the Adler-32s of the
+ * chunks are combined afterwards
+ * Without multi-thread support the chunks are compressed one after the other
+ * A compression level of -1 represents the default compression level
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     size_t chunk_size,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	parallel_deflate_worker_t *workers = NULL;
+	static char *function              = "parallel_deflate_compress";
+	size_t chunk_compressed_data_size  = 0;
+	size_t chunk_data_offset           = 0;
+	size_t compressed_data_offset      = 0;
+	size_t number_of_chunks            = 0;
+	size_t chunk_index                 = 0;
+	uint32_t checksum_value            = 0;
+	int number_of_active_workers       = 0;
+	int number_of_workers              = 0;
+	int result                         = 1;
+	int worker_index                   = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == -1 )
+	{
+		compression_level = 6;
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) ( SSIZE_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size < 6 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty data is compressed as a single empty chunk
+	 */
+	number_of_chunks = uncompressed_data_size / chunk_size;
+
+	if( ( ( uncompressed_data_size % chunk_size ) != 0 )
+	 || ( number_of_chunks == 0 ) )
+	{
+		number_of_chunks++;
+	}
+	number_of_workers = number_of_threads;
+
+	if( number_of_chunks < (size_t) number_of_workers )
+	{
+		number_of_workers = (int) number_of_chunks;
+	}
+	/* A compressed chunk is at most the size of the chunk stored as uncompressed blocks
+	 */
+	chunk_compressed_data_size = chunk_size + ( chunk_size >> 10 ) + 64;
+
+	workers = (parallel_deflate_worker_t *) memory_allocate(
+	                                         sizeof( parallel_deflate_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( parallel_deflate_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		workers[ worker_index ].compressed_data = (uint8_t *) memory_allocate(
+		                                                       sizeof( uint8_t ) * chunk_compressed_data_size );
+
+		if( workers[ worker_index ].compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		workers[ worker_index ].compressed_data_size = chunk_compressed_data_size;
+		workers[ worker_index ].compression_level    = compression_level;
+	}
+	if( deflate_write_data_header(
+	     compressed_data,
+	     *compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data header.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offset = 2;
+
+	/* The chunks are compressed in rounds of a chunk per worker so that
+	 * the compressed data of a round can be written in order
+	 */
+	while( chunk_index < number_of_chunks )
+	{
+		number_of_active_workers = number_of_workers;
+
+		if( ( number_of_chunks - chunk_index ) < (size_t) number_of_active_workers )
+		{
+			number_of_active_workers = (int) ( number_of_chunks - chunk_index );
+		}
+		/* The checksums of all but the first chunk are calculated with
+		 * an initial value of 0 as required to combine them
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			chunk_data_offset = ( chunk_index + worker_index ) * chunk_size;
+
+			workers[ worker_index ].dictionary_size = chunk_data_offset;
+
+			if( workers[ worker_index ].dictionary_size > DEFLATE_WINDOW_SIZE )
+			{
+				workers[ worker_index ].dictionary_size = DEFLATE_WINDOW_SIZE;
+			}
+			workers[ worker_index ].uncompressed_data      = &( uncompressed_data[ chunk_data_offset - workers[ worker_index ].dictionary_size ] );
+			workers[ worker_index ].uncompressed_data_size = uncompressed_data_size - chunk_data_offset;
+
+			if( workers[ worker_index ].uncompressed_data_size > chunk_size )
+			{
+				workers[ worker_index ].uncompressed_data_size = chunk_size;
+			}
+			workers[ worker_index ].uncompressed_data_size += workers[ worker_index ].dictionary_size;
+			workers[ worker_index ].last_chunk_flag         = (uint8_t) ( ( chunk_index + worker_index + 1 ) == number_of_chunks );
+			workers[ worker_index ].initial_value           = (uint32_t) ( chunk_data_offset == 0 );
+			workers[ worker_index ].result                  = -1;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_thread_create(
+			     &( workers[ worker_index ].thread ),
+			     NULL,
+			     &parallel_deflate_worker_thread_function,
+			     (void *) &( workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+#else
+			parallel_deflate_worker_thread_function(
+			 (void *) &( workers[ worker_index ] ) );
+#endif
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* Join all the threads that were created, also on error
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		/* Write the compressed chunks and combine their checksums in order
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			if( workers[ worker_index ].compressed_data_offset > ( *compressed_data_size - compressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     workers[ worker_index ].compressed_data,
+			     workers[ worker_index ].compressed_data_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy compressed data of chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			compressed_data_offset += workers[ worker_index ].compressed_data_offset;
+
+			if( chunk_index == 0 )
+			{
+				checksum_value = workers[ worker_index ].checksum;
+			}
+			else if( adler32_combine_checksums(
+			          &checksum_value,
+			          checksum_value,
+			          workers[ worker_index ].checksum,
+			          (size64_t) ( workers[ worker_index ].uncompressed_data_size - workers[ worker_index ].dictionary_size ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to combine checksum of chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_index++;
+		}
+	}
+	if( ( *compressed_data_size - compressed_data_offset ) < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 checksum_value );
+
+	*compressed_data_size = compressed_data_offset + 4;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		memory_free(
+		 workers[ worker_index ].compressed_data );
+	}
+	memory_free(
+	 workers );
+
+	return( 1 );
+
+on_error:
+	if( workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].compressed_data != NULL )
+			{
+				memory_free(
+				 workers[ worker_index ].compressed_data );
+			}
+		}
+		memory_free(
+		 workers );
+	}
+	return( -1 );
+}
+
+/* Sets the bit offset of a bit stream
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_bit_stream_set_bit_offset(
+     bit_stream_t *bit_stream,
+     uint64_t bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "parallel_deflate_bit_stream_set_bit_offset";
+	uint32_t value_32bit  = 0;
+	uint8_t skip_bits     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_offset > ( (uint64_t) bit_stream->byte_stream_size << 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->byte_stream_offset = (size_t) ( bit_offset >> 3 );
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	skip_bits = (uint8_t) ( bit_offset & 0x07 );
+
+	if( skip_bits > 0 )
+	{
+		if( bit_stream_get_value(
+		     bit_stream,
+		     skip_bits,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Checks if the bit offset is a plausible start of a dynamic Huffman block
+ * The header values must be within bounds and the pre-code sizes must form a complete code
+ * Returns 1 if plausible, 0 if not or -1 on error
+ */
+int parallel_deflate_check_dynamic_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset,
+     libcerror_error_t **error )
+{
+	int code_size_counts[ 8 ];
+
+	bit_stream_t bit_stream;
+
+	static char *function         = "parallel_deflate_check_dynamic_block_header";
+	size_t byte_offset            = 0;
+	uint32_t code_size            = 0;
+	uint32_t code_size_index      = 0;
+	uint32_t number_of_code_sizes = 0;
+	uint32_t value_32bit          = 0;
+	int left_value                = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block header, the number of codes and 4 pre-code sizes require 29 bits
+	 */
+	if( ( compressed_data_size < 4 )
+	 || ( bit_offset > ( ( (uint64_t) compressed_data_size << 3 ) - 29 ) ) )
+	{
+		return( 0 );
+	}
+	/* Check the block type, ignoring the last block flag, before using the bit stream
+	 */
+	byte_offset = (size_t) ( bit_offset >> 3 );
+	value_32bit = (uint32_t) compressed_data[ byte_offset ] | ( (uint32_t) compressed_data[ byte_offset + 1 ] << 8 );
+
+	value_32bit >>= bit_offset & 0x07;
+
+	if( ( value_32bit & 0x00000006UL ) != ( DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC << 1 ) )
+	{
+		return( 0 );
+	}
+	bit_stream.byte_stream        = compressed_data;
+	bit_stream.byte_stream_size   = compressed_data_size;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.storage_type       = BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	if( parallel_deflate_bit_stream_set_bit_offset(
+	     &bit_stream,
+	     bit_offset + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream_get_value(
+	     &bit_stream,
+	     14,
+	     &number_of_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of literal codes and distance codes cannot exceed 286 and 30
+	 */
+	if( ( ( number_of_code_sizes & 0x0000001fUL ) > 29 )
+	 || ( ( ( number_of_code_sizes >> 5 ) & 0x0000001fUL ) > 29 ) )
+	{
+		return( 0 );
+	}
+	number_of_code_sizes = ( number_of_code_sizes >> 10 ) + 4;
+
+	if( ( bit_offset + 17 + ( number_of_code_sizes * 3 ) ) > ( (uint64_t) compressed_data_size << 3 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( int ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_sizes;
+	     code_size_index++ )
+	{
+		if( bit_stream_get_value(
+		     &bit_stream,
+		     3,
+		     &code_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	/* The pre-code sizes of an encoder form a complete code
+	 */
+	left_value = 1;
+
+	for( code_size = 1;
+	     code_size < 8;
+	     code_size++ )
+	{
+		left_value <<= 1;
+		left_value  -= code_size_counts[ code_size ];
+
+		if( left_value < 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( left_value != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Checks if the code sizes of a Huffman tree form a complete code
+ * Returns 1 if complete, 0 if not or -1 on error
+ */
+int parallel_deflate_check_huffman_tree(
+     const huffman_tree_t *huffman_tree,
+     uint8_t allow_single_code,
+     libcerror_error_t **error )
+{
+	static char *function = "parallel_deflate_check_huffman_tree";
+	uint8_t code_size     = 0;
+	int left_value        = 1;
+	int number_of_codes   = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size = 1;
+	     code_size <= huffman_tree->maximum_code_size;
+	     code_size++ )
+	{
+		left_value     <<= 1;
+		left_value      -= huffman_tree->code_size_counts[ code_size ];
+		number_of_codes += huffman_tree->code_size_counts[ code_size ];
+	}
+	if( left_value == 0 )
+	{
+		return( 1 );
+	}
+	/* An encoder uses a single distance code when only one distance is used
+	 */
+	if( ( allow_single_code != 0 )
+	 && ( number_of_codes == 1 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Resizes the decoded data of a worker so that it can contain the number of additional values
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_worker_resize_data(
+     parallel_deflate_decompress_worker_t *worker,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	uint16_t *data        = NULL;
+	static char *function = "parallel_deflate_decompress_worker_resize_data";
+	size_t data_size      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values <= ( worker->data_size - worker->data_offset ) )
+	{
+		return( 1 );
+	}
+	if( number_of_values > ( ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) - worker->data_offset - 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = worker->data_offset + number_of_values + 65536;
+
+	if( ( worker->data_size < ( (size_t) SSIZE_MAX / ( 2 * sizeof( uint16_t ) ) ) )
+	 && ( data_size < ( worker->data_size * 2 ) ) )
+	{
+		data_size = worker->data_size * 2;
+	}
+	data = (uint16_t *) memory_reallocate(
+	                     worker->data,
+	                     sizeof( uint16_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	worker->data      = data;
+	worker->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Decodes an uncompressed block into the decoded data of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_worker_decode_uncompressed_block(
+     parallel_deflate_decompress_worker_t *worker,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream = NULL;
+	static char *function    = "parallel_deflate_decompress_worker_decode_uncompressed_block";
+	uint32_t block_size      = 0;
+	uint32_t block_size_copy = 0;
+	uint32_t value_32bit     = 0;
+	uint8_t skip_bits        = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = worker->deflate_decoder->bit_stream;
+
+	/* Ignore the bits in the buffer upto the next byte
+	 */
+	skip_bits = bit_stream->bit_buffer_size & 0x07;
+
+	if( skip_bits > 0 )
+	{
+		if( bit_stream_get_value(
+		     bit_stream,
+		     skip_bits,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( bit_stream_get_value(
+	     bit_stream,
+	     32,
+	     &block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
+	block_size     &= 0x0000ffffUL;
+
+	if( block_size != block_size_copy )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 block_size,
+		 block_size_copy );
+
+		return( -1 );
+	}
+	/* The bit buffer is byte aligned at this point, the bytes that were read ahead
+	 * are returned to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer          = 0;
+	bit_stream->bit_buffer_size     = 0;
+
+	if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_deflate_decompress_worker_resize_data(
+	     worker,
+	     (size_t) block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	while( block_size > 0 )
+	{
+		worker->data[ worker->data_offset++ ] = bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ];
+
+		block_size--;
+	}
+	return( 1 );
+}
+
+/* Decodes a Huffman compressed block into the decoded data of a worker
+ * A match that refers to data preceding the chunk is stored as markers
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_worker_decode_huffman_block(
+     parallel_deflate_decompress_worker_t *worker,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream    = NULL;
+	uint16_t *data              = NULL;
+	static char *function       = "parallel_deflate_decompress_worker_decode_huffman_block";
+	size_t data_offset          = 0;
+	uint32_t extra_bits         = 0;
+	uint32_t symbol             = 0;
+	uint16_t compression_offset = 0;
+	uint16_t compression_size   = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = worker->deflate_decoder->bit_stream;
+
+	do
+	{
+		if( huffman_tree_get_symbol_from_bit_stream(
+		     literals_huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol from literals Huffman tree.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol < 256 )
+		{
+			if( worker->data_offset >= worker->data_size )
+			{
+				if( parallel_deflate_decompress_worker_resize_data(
+				     worker,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			worker->data[ worker->data_offset++ ] = (uint16_t) symbol;
+		}
+		else if( ( symbol > 256 )
+		      && ( symbol < 286 ) )
+		{
+			symbol -= 257;
+
+			if( bit_stream_get_value(
+			     bit_stream,
+			     (uint8_t) deflate_literal_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve literal extra value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			compression_size = deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( huffman_tree_get_symbol_from_bit_stream(
+			     distances_huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from distances Huffman tree.",
+				 function );
+
+				return( -1 );
+			}
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance symbol: %" PRIu32 " value out of bounds.",
+				 function,
+				 symbol );
+
+				return( -1 );
+			}
+			if( bit_stream_get_value(
+			     bit_stream,
+			     (uint8_t) deflate_distance_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			compression_offset = deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( parallel_deflate_decompress_worker_resize_data(
+			     worker,
+			     (size_t) compression_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize data.",
+				 function );
+
+				return( -1 );
+			}
+			data        = worker->data;
+			data_offset = worker->data_offset;
+
+			/* The part of the match that refers to the window preceding the chunk
+			 * is stored as markers of the corresponding window offsets
+			 */
+			while( ( compression_size > 0 )
+			    && ( data_offset < (size_t) compression_offset ) )
+			{
+				data[ data_offset ] = (uint16_t) ( PARALLEL_DEFLATE_MARKER_BASE + DEFLATE_WINDOW_SIZE + data_offset - compression_offset );
+
+				data_offset++;
+				compression_size--;
+			}
+			while( compression_size > 0 )
+			{
+				data[ data_offset ] = data[ data_offset - compression_offset ];
+
+				data_offset++;
+				compression_size--;
+			}
+			worker->data_offset = data_offset;
+		}
+		else if( symbol != 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid symbol: %" PRIu32 ".",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+	}
+	while( symbol != 256 );
+
+	return( 1 );
+}
+
+/* Decodes the blocks of the compressed data of a worker
+ * Decoding starts at the start bit offset, which must be the start of a block, and stops
+ * at the start of the first block at or after the end bit offset or at the end of the last block
+ * If check first block is set the first block must be a dynamic Huffman block with complete codes
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_worker_decode_blocks(
+     parallel_deflate_decompress_worker_t *worker,
+     uint64_t start_bit_offset,
+     uint8_t check_first_block,
+     libcerror_error_t **error )
+{
+	bit_stream_t *bit_stream = NULL;
+	static char *function    = "parallel_deflate_decompress_worker_decode_blocks";
+	uint64_t bit_offset      = 0;
+	uint8_t block_type       = 0;
+	uint8_t last_block_flag  = 0;
+	int result               = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->deflate_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing deflate decoder.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = worker->deflate_decoder->bit_stream;
+
+	bit_stream->byte_stream      = worker->compressed_data;
+	bit_stream->byte_stream_size = worker->compressed_data_size;
+
+	if( parallel_deflate_bit_stream_set_bit_offset(
+	     bit_stream,
+	     start_bit_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bit offset.",
+		 function );
+
+		goto on_error;
+	}
+	worker->start_bit_offset = start_bit_offset;
+	worker->data_offset      = 0;
+	worker->end_of_stream    = 0;
+
+	bit_offset = start_bit_offset;
+
+	while( bit_offset < worker->end_bit_offset )
+	{
+		if( deflate_read_block_header(
+		     bit_stream,
+		     &block_type,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block header.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( check_first_block != 0 )
+		 && ( block_type != DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported first block type.",
+			 function );
+
+			goto on_error;
+		}
+		switch( block_type )
+		{
+			case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+				result = parallel_deflate_decompress_worker_decode_uncompressed_block(
+				          worker,
+				          error );
+				break;
+
+			case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+				result = parallel_deflate_decompress_worker_decode_huffman_block(
+				          worker,
+				          &deflate_fixed_literals_huffman_tree,
+				          &deflate_fixed_distances_huffman_tree,
+				          error );
+				break;
+
+			case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+				if( deflate_build_dynamic_huffman_trees(
+				     bit_stream,
+				     worker->deflate_decoder->pre_codes_huffman_tree,
+				     worker->deflate_decoder->literals_huffman_tree,
+				     worker->deflate_decoder->distances_huffman_tree,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build dynamic Huffman trees.",
+					 function );
+
+					goto on_error;
+				}
+				if( check_first_block != 0 )
+				{
+					if( ( parallel_deflate_check_huffman_tree(
+					       worker->deflate_decoder->literals_huffman_tree,
+					       0,
+					       error ) != 1 )
+					 || ( parallel_deflate_check_huffman_tree(
+					       worker->deflate_decoder->distances_huffman_tree,
+					       1,
+					       error ) != 1 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid dynamic Huffman trees - incomplete codes.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				result = parallel_deflate_decompress_worker_decode_huffman_block(
+				          worker,
+				          worker->deflate_decoder->literals_huffman_tree,
+				          worker->deflate_decoder->distances_huffman_tree,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type.",
+				 function );
+
+				goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to decode compressed data block.",
+			 function );
+
+			goto on_error;
+		}
+		check_first_block = 0;
+
+		bit_offset = ( (uint64_t) bit_stream->byte_stream_offset << 3 ) - bit_stream->bit_buffer_size;
+
+		if( last_block_flag != 0 )
+		{
+			worker->end_of_stream = 1;
+
+			break;
+		}
+	}
+	worker->last_bit_offset = bit_offset;
+
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
+
+	return( 1 );
+
+on_error:
+	bit_stream->byte_stream      = NULL;
+	bit_stream->byte_stream_size = 0;
+
+	return( -1 );
+}
+
+/* Decodes the chunk of a worker
+ * If the start of the chunk is not known the first bit offset, at or after the search bit offset,
+ * from which the blocks can be decoded upto the end bit offset is used as the start of the chunk
+ * Returns 1 if successful, 0 if no start of a block was found or -1 on error
+ */
+int parallel_deflate_decompress_worker_decode(
+     parallel_deflate_decompress_worker_t *worker,
+     libcerror_error_t **error )
+{
+	static char *function     = "parallel_deflate_decompress_worker_decode";
+	uint64_t bit_offset       = 0;
+	uint64_t search_bit_limit = 0;
+	int result                = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->search_bit_offset_is_block_start != 0 )
+	{
+		if( parallel_deflate_decompress_worker_decode_blocks(
+		     worker,
+		     worker->search_bit_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode blocks.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	search_bit_limit = (uint64_t) worker->compressed_data_size << 3;
+
+	if( search_bit_limit > worker->end_bit_offset )
+	{
+		search_bit_limit = worker->end_bit_offset;
+	}
+	for( bit_offset = worker->search_bit_offset;
+	     bit_offset < search_bit_limit;
+	     bit_offset++ )
+	{
+		result = parallel_deflate_check_dynamic_block_header(
+		          worker->compressed_data,
+		          worker->compressed_data_size,
+		          bit_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check dynamic block header at bit offset: %" PRIu64 ".",
+			 function,
+			 bit_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		/* A candidate that cannot be decoded is not the start of a block
+		 */
+		if( parallel_deflate_decompress_worker_decode_blocks(
+		     worker,
+		     bit_offset,
+		     1,
+		     NULL ) == 1 )
+		{
+			return( 1 );
+		}
+	}
+	worker->data_offset = 0;
+
+	return( 0 );
+}
+
+/* The decompress worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful, 0 if no start of a block was found or -1 on error
+ */
+int parallel_deflate_decompress_worker_thread_function(
+     void *arguments )
+{
+	parallel_deflate_decompress_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (parallel_deflate_decompress_worker_t *) arguments;
+
+	worker->result = parallel_deflate_decompress_worker_decode(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Copies the decoded data of a worker to the uncompressed data
+ * The markers are replaced by the corresponding bytes of the uncompressed data preceding the chunk
+ * and the Adler-32 checksum is updated with the copied data
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_worker_copy_data(
+     parallel_deflate_decompress_worker_t *worker,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint32_t *checksum_value,
+     libcerror_error_t **error )
+{
+	static char *function   = "parallel_deflate_decompress_worker_copy_data";
+	size_t chunk_offset     = 0;
+	size_t data_index       = 0;
+	size_t distance         = 0;
+	size_t safe_data_offset = 0;
+	size_t slice_end_index  = 0;
+	size_t slice_offset     = 0;
+	uint16_t value_16bit    = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = *uncompressed_data_offset;
+
+	if( chunk_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->data_offset > ( uncompressed_data_size - chunk_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = chunk_offset;
+
+	while( data_index < worker->data_offset )
+	{
+		slice_end_index = worker->data_offset;
+
+		if( ( slice_end_index - data_index ) > PARALLEL_DEFLATE_COPY_SLICE_SIZE )
+		{
+			slice_end_index = data_index + PARALLEL_DEFLATE_COPY_SLICE_SIZE;
+		}
+		slice_offset = safe_data_offset;
+
+		while( data_index < slice_end_index )
+		{
+			value_16bit = worker->data[ data_index++ ];
+
+			if( value_16bit >= PARALLEL_DEFLATE_MARKER_BASE )
+			{
+				distance = DEFLATE_WINDOW_SIZE + PARALLEL_DEFLATE_MARKER_BASE - (size_t) value_16bit;
+
+				if( distance > chunk_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid marker: %" PRIu16 " value out of bounds.",
+					 function,
+					 value_16bit );
+
+					return( -1 );
+				}
+				value_16bit = uncompressed_data[ chunk_offset - distance ];
+			}
+			uncompressed_data[ safe_data_offset++ ] = (uint8_t) value_16bit;
+		}
+		if( deflate_calculate_adler32(
+		     checksum_value,
+		     &( uncompressed_data[ slice_offset ] ),
+		     safe_data_offset - slice_offset,
+		     *checksum_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*uncompressed_data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using zlib compression and multiple threads
+ * The compressed data is split into chunks and every thread searches its chunk for
+ * the start of a block and decodes the blocks speculatively, without the window that
+ * precedes the chunk. Matches that refer to this window are stored as markers and are
+ * replaced once the preceding chunk has been decoded. If the start of a block that was
+ * found does not match the end of the preceding chunk, the chunk is decoded again from
+ * the end of the preceding chunk, hence the uncompressed data is the same as that of
+ * deflate_decompress_zlib
+ * Without multi-thread support the chunks are decoded one after the other
+ * The uncompressed data size contains the size of the uncompressed data buffer. If the
+ * decoded data does not fit, the buffer, which must be allocated with memory_allocate,
+ * is resized up to the maximum uncompressed data size
+ * Returns 1 if successful, 0 if the uncompressed data exceeds the maximum size or -1 on error
+ */
+int parallel_deflate_decompress_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     size_t maximum_uncompressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	parallel_deflate_decompress_worker_t *workers = NULL;
+	static char *function                         = "parallel_deflate_decompress_data";
+	uint8_t *reallocation                         = NULL;
+	size_t compressed_data_offset                 = 0;
+	size_t number_of_chunks                       = 0;
+	size_t chunk_index                            = 0;
+	size_t resized_data_size                      = 0;
+	size_t safe_uncompressed_data_size            = 0;
+	size_t uncompressed_data_offset               = 0;
+	uint64_t chunk_bit_offset                     = 0;
+	uint64_t data_bit_offset                      = 0;
+	uint64_t last_bit_offset                      = 0;
+	uint32_t calculated_checksum                  = 1;
+	uint32_t stored_checksum                      = 0;
+	uint8_t end_of_stream                         = 0;
+	int number_of_active_workers                  = 0;
+	int number_of_workers                         = 0;
+	int result                                    = 1;
+	int worker_index                              = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data == NULL )
+	 || ( *uncompressed_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > maximum_uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( deflate_read_data_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data header.",
+		 function );
+
+		return( -1 );
+	}
+	data_bit_offset = (uint64_t) compressed_data_offset << 3;
+
+	number_of_chunks = ( compressed_data_size - compressed_data_offset ) / chunk_size;
+
+	if( ( ( ( compressed_data_size - compressed_data_offset ) % chunk_size ) != 0 )
+	 || ( number_of_chunks == 0 ) )
+	{
+		number_of_chunks++;
+	}
+	number_of_workers = number_of_threads;
+
+	if( number_of_chunks < (size_t) number_of_workers )
+	{
+		number_of_workers = (int) number_of_chunks;
+	}
+	workers = (parallel_deflate_decompress_worker_t *) memory_allocate(
+	                                                    sizeof( parallel_deflate_decompress_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( parallel_deflate_decompress_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( deflate_decoder_initialize(
+		     &( workers[ worker_index ].deflate_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create deflate decoder of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		workers[ worker_index ].compressed_data      = compressed_data;
+		workers[ worker_index ].compressed_data_size = compressed_data_size;
+	}
+	last_bit_offset = data_bit_offset;
+
+	/* The chunks are decoded in rounds of a chunk per worker, after which
+	 * the decoded data of the round is copied in order
+	 */
+	while( ( chunk_index < number_of_chunks )
+	    && ( end_of_stream == 0 )
+	    && ( result == 1 ) )
+	{
+		number_of_active_workers = number_of_workers;
+
+		if( ( number_of_chunks - chunk_index ) < (size_t) number_of_active_workers )
+		{
+			number_of_active_workers = (int) ( number_of_chunks - chunk_index );
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			chunk_bit_offset = data_bit_offset + ( (uint64_t) ( chunk_index + worker_index ) * chunk_size * 8 );
+
+			workers[ worker_index ].search_bit_offset                = chunk_bit_offset;
+			workers[ worker_index ].search_bit_offset_is_block_start = (uint8_t) ( ( chunk_index + worker_index ) == 0 );
+			workers[ worker_index ].result                           = -1;
+
+			if( ( chunk_index + worker_index + 1 ) == number_of_chunks )
+			{
+				workers[ worker_index ].end_bit_offset = (uint64_t) compressed_data_size << 3;
+			}
+			else
+			{
+				workers[ worker_index ].end_bit_offset = chunk_bit_offset + ( (uint64_t) chunk_size * 8 );
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_thread_create(
+			     &( workers[ worker_index ].thread ),
+			     NULL,
+			     &parallel_deflate_decompress_worker_thread_function,
+			     (void *) &( workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				break;
+			}
+#else
+			parallel_deflate_decompress_worker_thread_function(
+			 (void *) &( workers[ worker_index ] ) );
+#endif
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* Join all the threads that were created, also on error
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].thread == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_active_workers;
+		     worker_index++ )
+		{
+			if( ( workers[ worker_index ].result != 1 )
+			 || ( workers[ worker_index ].start_bit_offset != last_bit_offset ) )
+			{
+				if( chunk_index == 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decode chunk: 0.",
+					 function );
+
+					goto on_error;
+				}
+				/* The speculation failed, decode the chunk from the end of the preceding chunk
+				 */
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: decoding chunk: %" PRIzd " from bit offset: %" PRIu64 "\n",
+					 function,
+					 chunk_index,
+					 last_bit_offset );
+				}
+				workers[ worker_index ].search_bit_offset                = last_bit_offset;
+				workers[ worker_index ].search_bit_offset_is_block_start = 1;
+
+				if( parallel_deflate_decompress_worker_decode(
+				     &( workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decode chunk: %" PRIzd ".",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+			/* The uncompressed data is resized when the decoded data of the chunk
+			 * does not fit, at least doubling its size to limit the number of resizes
+			 */
+			if( workers[ worker_index ].data_offset > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				if( workers[ worker_index ].data_offset > ( maximum_uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					result = 0;
+
+					break;
+				}
+				resized_data_size = uncompressed_data_offset + workers[ worker_index ].data_offset;
+
+				if( safe_uncompressed_data_size > ( maximum_uncompressed_data_size / 2 ) )
+				{
+					resized_data_size = maximum_uncompressed_data_size;
+				}
+				else if( resized_data_size < ( safe_uncompressed_data_size * 2 ) )
+				{
+					resized_data_size = safe_uncompressed_data_size * 2;
+				}
+				reallocation = (uint8_t *) memory_reallocate(
+				                            *uncompressed_data,
+				                            sizeof( uint8_t ) * resized_data_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize uncompressed data.",
+					 function );
+
+					goto on_error;
+				}
+				*uncompressed_data          = reallocation;
+				*uncompressed_data_size     = resized_data_size;
+				safe_uncompressed_data_size = resized_data_size;
+			}
+			if( parallel_deflate_decompress_worker_copy_data(
+			     &( workers[ worker_index ] ),
+			     *uncompressed_data,
+			     safe_uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     &calculated_checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy decoded data of chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			last_bit_offset = workers[ worker_index ].last_bit_offset;
+			end_of_stream   = workers[ worker_index ].end_of_stream;
+
+			chunk_index++;
+
+			if( end_of_stream != 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( ( result == 1 )
+	 && ( end_of_stream == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: invalid compressed data - missing last block.",
+		 function );
+
+		goto on_error;
+	}
+	/* The checksum follows the last block at the next byte boundary
+	 */
+	compressed_data_offset = (size_t) ( ( last_bit_offset + 7 ) >> 3 );
+
+	if( ( result == 1 )
+	 && ( ( compressed_data_size - compressed_data_offset ) >= 4 ) )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 stored_checksum );
+
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].data != NULL )
+		{
+			memory_free(
+			 workers[ worker_index ].data );
+		}
+		if( deflate_decoder_free(
+		     &( workers[ worker_index ].deflate_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free deflate decoder of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 workers );
+
+	if( result == 1 )
+	{
+		*uncompressed_data_size = uncompressed_data_offset;
+	}
+	return( result );
+
+on_error:
+	if( workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( workers[ worker_index ].data != NULL )
+			{
+				memory_free(
+				 workers[ worker_index ].data );
+			}
+			if( workers[ worker_index ].deflate_decoder != NULL )
+			{
+				deflate_decoder_free(
+				 &( workers[ worker_index ].deflate_decoder ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 workers );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using zlib compression and multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "parallel_deflate_decompress";
+	int result            = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The maximum uncompressed data size is the size of the buffer
+	 * so that the buffer is never resized
+	 */
+	result = parallel_deflate_decompress_data(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_size,
+	          number_of_threads,
+	          *uncompressed_data_size,
+	          &uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the members of a worker
+ * The worker decompresses every member index step member starting with the first member index
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_gzip_worker_decompress(
+     parallel_deflate_gzip_worker_t *worker,
+     libcerror_error_t **error )
+{
+	gzip_member_t *member           = NULL;
+	static char *function           = "parallel_deflate_gzip_worker_decompress";
+	size_t compressed_data_end      = 0;
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_end    = 0;
+	size_t uncompressed_data_offset = 0;
+	int member_index                = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->member_index_step <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker - member index step value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( member_index = worker->first_member_index;
+	     member_index < worker->member_index->number_of_members;
+	     member_index += worker->member_index_step )
+	{
+		member = &( worker->member_index->members[ member_index ] );
+
+		if( ( member->compressed_offset > (uint64_t) worker->compressed_data_size )
+		 || ( member->compressed_size > ( (size64_t) worker->compressed_data_size - member->compressed_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member: %d compressed data value out of bounds.",
+			 function,
+			 member_index );
+
+			return( -1 );
+		}
+		if( ( member->uncompressed_offset > (uint64_t) worker->uncompressed_data_size )
+		 || ( member->uncompressed_size > ( (size64_t) worker->uncompressed_data_size - member->uncompressed_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid member: %d uncompressed data value out of bounds.",
+			 function,
+			 member_index );
+
+			return( -1 );
+		}
+		compressed_data_offset   = (size_t) member->compressed_offset;
+		compressed_data_end      = (size_t) ( member->compressed_offset + member->compressed_size );
+		uncompressed_data_offset = (size_t) member->uncompressed_offset;
+		uncompressed_data_end    = (size_t) ( member->uncompressed_offset + member->uncompressed_size );
+
+		/* The data passed to the decoder ends with the member so that a member
+		 * cannot be decompressed beyond the boundaries stored in the index
+		 */
+		if( gzip_decoder_decompress_member(
+		     worker->deflate_decoder,
+		     worker->compressed_data,
+		     compressed_data_end,
+		     &compressed_data_offset,
+		     worker->uncompressed_data,
+		     uncompressed_data_end,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress member: %d.",
+			 function,
+			 member_index );
+
+			return( -1 );
+		}
+		if( ( compressed_data_offset != compressed_data_end )
+		 || ( uncompressed_data_offset != uncompressed_data_end ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in size of member: %d.",
+			 function,
+			 member_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* The gzip worker thread function
+ * This function does not take an error argument, the result is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_gzip_worker_thread_function(
+     void *arguments )
+{
+	parallel_deflate_gzip_worker_t *worker = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (parallel_deflate_gzip_worker_t *) arguments;
+
+	worker->result = parallel_deflate_gzip_worker_decompress(
+	                  worker,
+	                  NULL );
+
+	return( worker->result );
+}
+
+/* Decompresses data stored in the gzip compressed data format using multiple threads
+ * The members are independent and their boundaries are known from the member index,
+ * hence every thread decompresses its members directly into the uncompressed data
+ * Without multi-thread support the members are decompressed one after the other
+ * Returns 1 if successful or -1 on error
+ */
+int parallel_deflate_decompress_gzip(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	parallel_deflate_gzip_worker_t *workers = NULL;
+	static char *function                   = "parallel_deflate_decompress_gzip";
+	int number_of_workers                   = 0;
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( member_index->compressed_data_size != (size64_t) compressed_data_size )
+	 || ( member_index->number_of_members == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member index - compressed data size does not match.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_index->uncompressed_data_size > (size64_t) *uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_workers = number_of_threads;
+
+	if( member_index->number_of_members < number_of_workers )
+	{
+		number_of_workers = member_index->number_of_members;
+	}
+	workers = (parallel_deflate_gzip_worker_t *) memory_allocate(
+	                                              sizeof( parallel_deflate_gzip_worker_t ) * number_of_workers );
+
+	if( workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( parallel_deflate_gzip_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 workers );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( deflate_decoder_initialize(
+		     &( workers[ worker_index ].deflate_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create deflate decoder of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		workers[ worker_index ].member_index           = member_index;
+		workers[ worker_index ].first_member_index     = worker_index;
+		workers[ worker_index ].member_index_step      = number_of_workers;
+		workers[ worker_index ].compressed_data        = compressed_data;
+		workers[ worker_index ].compressed_data_size   = compressed_data_size;
+		workers[ worker_index ].uncompressed_data      = uncompressed_data;
+		workers[ worker_index ].uncompressed_data_size = (size_t) member_index->uncompressed_data_size;
+		workers[ worker_index ].result                 = -1;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_create(
+		     &( workers[ worker_index ].thread ),
+		     NULL,
+		     &parallel_deflate_gzip_worker_thread_function,
+		     (void *) &( workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+#else
+		parallel_deflate_gzip_worker_thread_function(
+		 (void *) &( workers[ worker_index ] ) );
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Join all the threads that were created, also on error
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress members of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( deflate_decoder_free(
+		     &( workers[ worker_index ].deflate_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free deflate decoder of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 workers );
+
+	if( result == 1 )
+	{
+		*uncompressed_data_size = (size_t) member_index->uncompressed_data_size;
+	}
+	return( result );
+
+on_error:
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( workers[ worker_index ].deflate_decoder != NULL )
+		{
+			deflate_decoder_free(
+			 &( workers[ worker_index ].deflate_decoder ),
+			 NULL );
+		}
+	}
+	memory_free(
+	 workers );
+
+	return( -1 );
+}
@@ -0,0 +1,334 @@
+/*
+ * Parallel deflate (zlib) functions
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PARALLEL_DEFLATE_H )
+#define _PARALLEL_DEFLATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "bit_stream.h"
+#include "deflate.h"
+#include "gzip.h"
+#include "huffman_tree.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The default size of the uncompressed data of a chunk
+ */
+#define PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE		131072
+
+/* The default size of the compressed data of a chunk
+ */
+#define PARALLEL_DEFLATE_DEFAULT_COMPRESSED_CHUNK_SIZE	4194304
+
+/* The value of the first marker in the decoded data of a chunk
+ * A marker refers to a byte in the window preceding the chunk,
+ * which is unknown until the preceding chunk has been decoded
+ */
+#define PARALLEL_DEFLATE_MARKER_BASE			256
+
+/* The size of the slices in which the decoded data of a chunk is copied
+ * The checksum is updated per slice while the slice is still cached
+ */
+#define PARALLEL_DEFLATE_COPY_SLICE_SIZE		65536
+
+typedef struct parallel_deflate_worker parallel_deflate_worker_t;
+
+struct parallel_deflate_worker
+{
+	/* The uncompressed data, which starts with the preset dictionary
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The size of the uncompressed data including the preset dictionary
+	 */
+	size_t uncompressed_data_size;
+
+	/* The size of the preset dictionary
+	 */
+	size_t dictionary_size;
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* Value to indicate the chunk is the last chunk of the data
+	 */
+	uint8_t last_chunk_flag;
+
+	/* The compressed data of the chunk
+	 */
+	uint8_t *compressed_data;
+
+	/* The allocated size of the compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The size of the compressed data written
+	 */
+	size_t compressed_data_offset;
+
+	/* The initial Adler-32 value
+	 */
+	uint32_t initial_value;
+
+	/* The calculated Adler-32 of the chunk
+	 */
+	uint32_t checksum;
+
+	/* The result of the compression
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+typedef struct parallel_deflate_decompress_worker parallel_deflate_decompress_worker_t;
+
+struct parallel_deflate_decompress_worker
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The size of the compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The bit offset from which the start of a block is searched
+	 */
+	uint64_t search_bit_offset;
+
+	/* Value to indicate the search bit offset is the start of a block
+	 */
+	uint8_t search_bit_offset_is_block_start;
+
+	/* The bit offset at or after which decoding stops at the start of the next block
+	 */
+	uint64_t end_bit_offset;
+
+	/* The bit offset of the start of the block at which decoding started
+	 */
+	uint64_t start_bit_offset;
+
+	/* The bit offset at which decoding stopped, which is the start of a block
+	 * or the end of the last block
+	 */
+	uint64_t last_bit_offset;
+
+	/* Value to indicate decoding stopped at the end of the last block
+	 */
+	uint8_t end_of_stream;
+
+	/* The deflate decoder
+	 */
+	deflate_decoder_t *deflate_decoder;
+
+	/* The decoded data, where values of PARALLEL_DEFLATE_MARKER_BASE and above are markers
+	 */
+	uint16_t *data;
+
+	/* The number of values allocated for the decoded data
+	 */
+	size_t data_size;
+
+	/* The number of values decoded
+	 */
+	size_t data_offset;
+
+	/* The result of the decoding
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+typedef struct parallel_deflate_gzip_worker parallel_deflate_gzip_worker_t;
+
+struct parallel_deflate_gzip_worker
+{
+	/* The member index
+	 */
+	gzip_member_index_t *member_index;
+
+	/* The index of the first member decompressed by the worker
+	 */
+	int first_member_index;
+
+	/* The number of members between the members decompressed by the worker
+	 */
+	int member_index_step;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The deflate decoder
+	 */
+	deflate_decoder_t *deflate_decoder;
+
+	/* The result of the worker
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int parallel_deflate_worker_compress(
+     parallel_deflate_worker_t *worker,
+     libcerror_error_t **error );
+
+int parallel_deflate_worker_thread_function(
+     void *arguments );
+
+int parallel_deflate_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     size_t chunk_size,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int parallel_deflate_bit_stream_set_bit_offset(
+     bit_stream_t *bit_stream,
+     uint64_t bit_offset,
+     libcerror_error_t **error );
+
+int parallel_deflate_check_dynamic_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset,
+     libcerror_error_t **error );
+
+int parallel_deflate_check_huffman_tree(
+     const huffman_tree_t *huffman_tree,
+     uint8_t allow_single_code,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_resize_data(
+     parallel_deflate_decompress_worker_t *worker,
+     size_t number_of_values,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_decode_uncompressed_block(
+     parallel_deflate_decompress_worker_t *worker,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_decode_huffman_block(
+     parallel_deflate_decompress_worker_t *worker,
+     const huffman_tree_t *literals_huffman_tree,
+     const huffman_tree_t *distances_huffman_tree,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_decode_blocks(
+     parallel_deflate_decompress_worker_t *worker,
+     uint64_t start_bit_offset,
+     uint8_t check_first_block,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_decode(
+     parallel_deflate_decompress_worker_t *worker,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_worker_thread_function(
+     void *arguments );
+
+int parallel_deflate_decompress_worker_copy_data(
+     parallel_deflate_decompress_worker_t *worker,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint32_t *checksum_value,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     size_t maximum_uncompressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int parallel_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t chunk_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int parallel_deflate_gzip_worker_decompress(
+     parallel_deflate_gzip_worker_t *worker,
+     libcerror_error_t **error );
+
+int parallel_deflate_gzip_worker_thread_function(
+     void *arguments );
+
+int parallel_deflate_decompress_gzip(
+     gzip_member_index_t *member_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PARALLEL_DEFLATE_H ) */
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
@@ -123,16 +124,15 @@ int xor32_calculate_checksum_little_endian_cpu_aligned(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
+	uint8_t aligned_data[ sizeof( xor32_aligned_t ) ];
+
 	xor32_aligned_t *aligned_buffer_iterator = NULL;
 	uint8_t *buffer_iterator                 = NULL;
 	static char *function                    = "xor32_calculate_checksum_little_endian_cpu_aligned";
 	xor32_aligned_t value_aligned            = 0;
 	uint32_t value_32bit                     = 0;
-	uint8_t alignment_count                  = 0;
-	uint8_t alignment_size                   = 0;
 	uint8_t byte_count                       = 0;
-	uint8_t byte_order                       = 0;
-	uint8_t byte_size                        = 0;
+	uint8_t byte_index                       = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -171,7 +171,7 @@ int xor32_calculate_checksum_little_endian_cpu_aligned(
 
 	buffer_iterator = (uint8_t *) buffer;
 
-	/* Only optimize when there is the alignment is a multitude of 32-bit
+	/* Only optimize when the alignment is a multitude of 32-bit
 	 * and for buffers larger than the alignment
 	 */
 	if( ( ( sizeof( xor32_aligned_t ) % 4 ) == 0 )
@@ -179,58 +179,20 @@ int xor32_calculate_checksum_little_endian_cpu_aligned(
 	{
 		/* Align the buffer iterator
 		 */
-		alignment_size = (uint8_t) ( (intptr_t) buffer_iterator % sizeof( xor32_aligned_t ) );
-
-		byte_size = alignment_size;
-
-		while( byte_size != 0 )
+		while( ( (intptr_t) buffer_iterator % sizeof( xor32_aligned_t ) ) != 0 )
 		{
-			value_32bit = 0;
-			byte_count  = 1;
-
-			if( byte_size >= 4 )
-			{
-				value_32bit |= buffer_iterator[ 3 ];
-				value_32bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 3 )
-			{
-				value_32bit |= buffer_iterator[ 2 ];
-				value_32bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 2 )
-			{
-				value_32bit |= buffer_iterator[ 1 ];
-				value_32bit <<= 8;
-
-				byte_count++;
-			}
-			value_32bit |= buffer_iterator[ 0 ];
+			value_32bit      = buffer_iterator[ 0 ];
+			*checksum_value ^= value_32bit << ( ( byte_index % 4 ) * 8 );
 
-			buffer_iterator += byte_count;
-			byte_size       -= byte_count;
-
-			*checksum_value ^= value_32bit;
+			buffer_iterator += 1;
+			size            -= 1;
+			byte_index      += 1;
 		}
 		aligned_buffer_iterator = (xor32_aligned_t *) buffer_iterator;
 
-		size -= alignment_size;
-
-		if( *buffer_iterator != (uint8_t) ( *aligned_buffer_iterator & 0xff ) )
-		{
-			byte_order = _BYTE_STREAM_ENDIAN_BIG;
-		}
-		else
-		{
-			byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
-		}
 		/* Determine the aligned XOR value
 		 */
-		while( size > sizeof( xor32_aligned_t ) )
+		while( size >= sizeof( xor32_aligned_t ) )
 		{
 			value_aligned ^= *aligned_buffer_iterator;
 
@@ -238,125 +200,41 @@ int xor32_calculate_checksum_little_endian_cpu_aligned(
 
 			size -= sizeof( xor32_aligned_t );
 		}
-		/* Align the aligned XOR value with the 32-bit XOR value
-		 */
-		if( alignment_size > 0 )
-		{
-			byte_count      = ( alignment_size % 4 ) * 8;
-			alignment_count = ( sizeof( xor32_aligned_t ) - alignment_size ) * 8;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				/* Shift twice to set unused bytes to 0
-				 */
-				value_32bit = (uint32_t) ( ( value_aligned >> alignment_count ) << byte_count );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_32bit = (uint32_t) ( value_aligned << byte_count );
+		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
 
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned >>= alignment_count;
-			}
-			*checksum_value ^= value_32bit;
-		}
-		/* Update the 32-bit XOR value with the aligned XOR value
+		/* Update the 32-bit XOR value with the aligned XOR value, where the
+		 * bytes of the aligned XOR value are rotated by the alignment
 		 */
-		byte_size = (uint8_t) sizeof( xor32_aligned_t );
-
-		while( byte_size != 0 )
+		if( memory_copy(
+		     aligned_data,
+		     &value_aligned,
+		     sizeof( xor32_aligned_t ) ) == NULL )
 		{
-			byte_count = ( ( byte_size / 4 ) - 1 ) * 32;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				value_32bit = (uint32_t) ( value_aligned >> byte_count );
-
-				/* Change big-endian into little-endian
-				 */
-				value_32bit = ( ( value_32bit & 0x00ff ) << 24 )
-				            | ( ( value_32bit & 0xff00 ) << 8 )
-				            | ( ( value_32bit >> 8 ) & 0xff00 )
-				            | ( ( value_32bit >> 24 ) & 0x00ff );
-
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_32bit = (uint32_t) value_aligned;
-
-				value_aligned >>= byte_count;
-			}
-			byte_size -= 4;
-
-			*checksum_value ^= value_32bit;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy aligned value.",
+			 function );
+
+			return( -1 );
 		}
-		/* Re-align the buffer iterator
-		 */
-		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
-
-		byte_size = 4 - ( alignment_size % 4 );
-
-		if( byte_size != 4 )
+		for( byte_count = 0;
+		     byte_count < (uint8_t) sizeof( xor32_aligned_t );
+		     byte_count++ )
 		{
-			value_32bit   = buffer_iterator[ 0 ];
-			value_32bit <<= 8;
-
-			if( byte_size >= 2 )
-			{
-				value_32bit |= buffer_iterator[ 1 ];
-			}
-			value_32bit <<= 8;
-
-			if( byte_size >= 3 )
-			{
-				value_32bit |= buffer_iterator[ 2 ];
-			}
-			value_32bit <<= 8;
-
-			buffer_iterator += byte_size;
-			size            -= byte_size;
-
-			*checksum_value ^= value_32bit;
+			value_32bit      = aligned_data[ byte_count ];
+			*checksum_value ^= value_32bit << ( ( ( byte_index + byte_count ) % 4 ) * 8 );
 		}
 	}
 	while( size > 0 )
 	{
-		value_32bit = 0;
-		byte_count  = 1;
+		value_32bit      = buffer_iterator[ 0 ];
+		*checksum_value ^= value_32bit << ( ( byte_index % 4 ) * 8 );
 
-		if( size >= 4 )
-		{
-			value_32bit |= buffer_iterator[ 3 ];
-			value_32bit <<= 8;
-
-			byte_count++;
-		}
-		if( size >= 3 )
-		{
-			value_32bit |= buffer_iterator[ 2 ];
-			value_32bit <<= 8;
-
-			byte_count++;
-		}
-		if( size >= 2 )
-		{
-			value_32bit |= buffer_iterator[ 1 ];
-			value_32bit <<= 8;
-
-			byte_count++;
-		}
-		value_32bit |= buffer_iterator[ 0 ];
-
-		buffer_iterator += byte_count;
-		size            -= byte_count;
-
-		*checksum_value ^= value_32bit;
+		buffer_iterator += 1;
+		size            -= 1;
+		byte_index      += 1;
 	}
 	return( 1 );
 }
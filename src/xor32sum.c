@@ -35,6 +35,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "block_reader.h"
 #include "xor32.h"
 
 /* Prints the executable usage information
@@ -48,13 +49,15 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use xor32sum to calculate a 32-bit XOR-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: xor32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: xor32sum [ -b block_size ] [ -i initial_value ] [ -o offset ]\n"
+	                 "                [ -s size ] [ -12hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
 	fprintf( stream, "\t-2:     use the cpu-aligned calculation method (default)\n" );
+	fprintf( stream, "\t-b:     block size of the data read at once, must be a multiple\n"
+	                 "\t        of 512 and at most 1073741824 (default is 4194304)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial XOR-32 (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
@@ -75,11 +78,13 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error     = NULL;
 	libcfile_file_t *source_file = NULL;
 	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
+	block_reader_t *block_reader = NULL;
+	uint8_t *block_data          = NULL;
 	char *program                = "xor32sum";
 	system_integer_t option      = 0;
+	size_t block_data_size       = 0;
+	size_t block_size            = BLOCK_READER_DEFAULT_BLOCK_SIZE;
 	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
 	off_t source_offset          = 0;
 	uint32_t checksum_value      = 0;
 	uint32_t initial_value       = 0;
@@ -94,7 +99,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12b:hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -120,6 +125,14 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'b':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				block_size = (size_t) _wtol( optarg );
+#else
+				block_size = (size_t) atol( optarg );
+#endif
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -236,22 +249,14 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * (size_t) source_size );
-
-	if( buffer == NULL )
+	if( block_reader_initialize(
+	     &block_reader,
+	     block_size,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Unable to create block reader.\n" );
 
 		goto on_error;
 	}
@@ -269,13 +274,64 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( block_reader_open(
+	     block_reader,
+	     source_file,
+	     source_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open block reader.\n" );
 
-	if( read_count != (ssize_t) source_size )
+		goto on_error;
+	}
+	checksum_value = initial_value;
+
+	/* Calculate the checksum block by block, using the checksum
+	 * of the previous blocks as the initial value
+	 */
+	while( ( result = block_reader_get_next_block(
+	                   block_reader,
+	                   &block_data,
+	                   &block_data_size,
+	                   &error ) ) == 1 )
+	{
+		if( calculation_method == 1 )
+		{
+			result = xor32_calculate_checksum_little_endian_basic(
+			          &checksum_value,
+			          block_data,
+			          block_data_size,
+			          checksum_value,
+			          NULL );
+		}
+		else if( calculation_method == 2 )
+		{
+			result = xor32_calculate_checksum_little_endian_cpu_aligned(
+			          &checksum_value,
+			          block_data,
+			          block_data_size,
+			          checksum_value,
+			          NULL );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate XOR-32.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 block_data,
+			 block_data_size,
+			 0 );
+		}
+	}
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
@@ -283,6 +339,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( block_reader_free(
+	     &block_reader,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free block reader.\n" );
+
+		goto on_error;
+	}
 	/* Clean up
 	 */
 	if( libcfile_file_close(
@@ -305,42 +371,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = xor32_calculate_checksum_little_endian_basic(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          NULL );
-	}
-	else if( calculation_method == 2 )
-	{
-		result = xor32_calculate_checksum_little_endian_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          NULL );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate XOR-32.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	memory_free(
-	 buffer );
-
 	fprintf(
 	 stdout,
 	 "Calculated XOR-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
@@ -357,10 +387,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	if( block_reader != NULL )
 	{
-		memory_free(
-		 buffer );
+		block_reader_free(
+		 &block_reader,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
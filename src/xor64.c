@@ -21,15 +21,16 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "xor64.h"
 
-/* The largest primary (or scalar) available
- * supported by a single load and store instruction
+/* The 64-bit primary used for aligned loads
+ * a smaller primary would mix the bytes of adjacent 64-bit values
  */
-typedef unsigned long int xor64_aligned_t;
+typedef uint64_t xor64_aligned_t;
 
 /* Calculates the little-endian XOR-64 of a buffer
  * Use a intial value to calculate a new XOR-64
@@ -131,7 +132,7 @@ int xor64_calculate_checksum_little_endian_basic(
 
 		*checksum_value ^= value_64bit;
 
-		buffer += 4;
+		buffer += 8;
 	}
 	return( 1 );
 }
@@ -147,16 +148,15 @@ int xor64_calculate_checksum_little_endian_cpu_aligned(
      uint64_t initial_value,
      libcerror_error_t **error )
 {
+	uint8_t aligned_data[ 8 ];
+
 	xor64_aligned_t *aligned_buffer_iterator = NULL;
 	uint8_t *buffer_iterator                 = NULL;
 	static char *function                    = "xor64_calculate_checksum_little_endian_cpu_aligned";
 	xor64_aligned_t value_aligned            = 0;
 	uint64_t value_64bit                     = 0;
-	uint8_t alignment_count                  = 0;
-	uint8_t alignment_size                   = 0;
 	uint8_t byte_count                       = 0;
-	uint8_t byte_order                       = 0;
-	uint8_t byte_size                        = 0;
+	uint8_t byte_index                       = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -195,66 +195,26 @@ int xor64_calculate_checksum_little_endian_cpu_aligned(
 
 	buffer_iterator = (uint8_t *) buffer;
 
-	/* Only optimize when there is the alignment is a multitude of 64-bit
-	 * and for buffers larger than the alignment
+	/* Only optimize for buffers larger than the alignment
 	 */
-	if( ( ( sizeof( xor64_aligned_t ) % 4 ) == 0 )
-	 && ( size > ( 2 * sizeof( xor64_aligned_t ) ) ) )
+	if( size > ( 2 * sizeof( xor64_aligned_t ) ) )
 	{
 		/* Align the buffer iterator
 		 */
-		alignment_size = (uint8_t) ( (intptr_t) buffer_iterator % sizeof( xor64_aligned_t ) );
-
-		byte_size = alignment_size;
-
-		while( byte_size != 0 )
+		while( ( (intptr_t) buffer_iterator % sizeof( xor64_aligned_t ) ) != 0 )
 		{
-			value_64bit = 0;
-			byte_count  = 1;
-
-			if( byte_size >= 4 )
-			{
-				value_64bit |= buffer_iterator[ 3 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 3 )
-			{
-				value_64bit |= buffer_iterator[ 2 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 2 )
-			{
-				value_64bit |= buffer_iterator[ 1 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			value_64bit |= buffer_iterator[ 0 ];
+			value_64bit      = buffer_iterator[ 0 ];
+			*checksum_value ^= value_64bit << ( byte_index * 8 );
 
-			buffer_iterator += byte_count;
-			byte_size       -= byte_count;
-
-			*checksum_value ^= value_64bit;
+			buffer_iterator += 1;
+			size            -= 1;
+			byte_index      += 1;
 		}
 		aligned_buffer_iterator = (xor64_aligned_t *) buffer_iterator;
 
-		size -= alignment_size;
-
-		if( *buffer_iterator != (uint8_t) ( *aligned_buffer_iterator & 0xff ) )
-		{
-			byte_order = _BYTE_STREAM_ENDIAN_BIG;
-		}
-		else
-		{
-			byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
-		}
 		/* Determine the aligned XOR value
 		 */
-		while( size > sizeof( xor64_aligned_t ) )
+		while( size >= sizeof( xor64_aligned_t ) )
 		{
 			value_aligned ^= *aligned_buffer_iterator;
 
@@ -262,125 +222,41 @@ int xor64_calculate_checksum_little_endian_cpu_aligned(
 
 			size -= sizeof( xor64_aligned_t );
 		}
-		/* Align the aligned XOR value with the 64-bit XOR value
-		 */
-		if( alignment_size > 0 )
-		{
-			byte_count      = ( alignment_size % 4 ) * 8;
-			alignment_count = ( sizeof( xor64_aligned_t ) - alignment_size ) * 8;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				/* Shift twice to set unused bytes to 0
-				 */
-				value_64bit = (uint64_t) ( ( value_aligned >> alignment_count ) << byte_count );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_64bit = (uint64_t) ( value_aligned << byte_count );
+		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
 
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned >>= alignment_count;
-			}
-			*checksum_value ^= value_64bit;
-		}
-		/* Update the 64-bit XOR value with the aligned XOR value
+		/* Update the 64-bit XOR value with the aligned XOR value, where the
+		 * bytes of the aligned XOR value are rotated by the alignment
 		 */
-		byte_size = (uint8_t) sizeof( xor64_aligned_t );
-
-		while( byte_size != 0 )
+		if( memory_copy(
+		     aligned_data,
+		     &value_aligned,
+		     sizeof( xor64_aligned_t ) ) == NULL )
 		{
-			byte_count = ( ( byte_size / 4 ) - 1 ) * 64;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				value_64bit = (uint64_t) ( value_aligned >> byte_count );
-
-				/* Change big-endian into little-endian
-				 */
-				value_64bit = ( ( value_64bit & 0x00ff ) << 24 )
-				            | ( ( value_64bit & 0xff00 ) << 8 )
-				            | ( ( value_64bit >> 8 ) & 0xff00 )
-				            | ( ( value_64bit >> 24 ) & 0x00ff );
-
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_64bit = (uint64_t) value_aligned;
-
-				value_aligned >>= byte_count;
-			}
-			byte_size -= 4;
-
-			*checksum_value ^= value_64bit;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy aligned value.",
+			 function );
+
+			return( -1 );
 		}
-		/* Re-align the buffer iterator
-		 */
-		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
-
-		byte_size = 4 - ( alignment_size % 4 );
-
-		if( byte_size != 4 )
+		for( byte_count = 0;
+		     byte_count < 8;
+		     byte_count++ )
 		{
-			value_64bit   = buffer_iterator[ 0 ];
-			value_64bit <<= 8;
-
-			if( byte_size >= 2 )
-			{
-				value_64bit |= buffer_iterator[ 1 ];
-			}
-			value_64bit <<= 8;
-
-			if( byte_size >= 3 )
-			{
-				value_64bit |= buffer_iterator[ 2 ];
-			}
-			value_64bit <<= 8;
-
-			buffer_iterator += byte_size;
-			size            -= byte_size;
-
-			*checksum_value ^= value_64bit;
+			value_64bit      = aligned_data[ byte_count ];
+			*checksum_value ^= value_64bit << ( ( ( byte_index + byte_count ) % 8 ) * 8 );
 		}
 	}
 	while( size > 0 )
 	{
-		value_64bit = 0;
-		byte_count  = 1;
+		value_64bit      = buffer_iterator[ 0 ];
+		*checksum_value ^= value_64bit << ( ( byte_index % 8 ) * 8 );
 
-		if( size >= 4 )
-		{
-			value_64bit |= buffer_iterator[ 3 ];
-			value_64bit <<= 8;
-
-			byte_count++;
-		}
-		if( size >= 3 )
-		{
-			value_64bit |= buffer_iterator[ 2 ];
-			value_64bit <<= 8;
-
-			byte_count++;
-		}
-		if( size >= 2 )
-		{
-			value_64bit |= buffer_iterator[ 1 ];
-			value_64bit <<= 8;
-
-			byte_count++;
-		}
-		value_64bit |= buffer_iterator[ 0 ];
-
-		buffer_iterator += byte_count;
-		size            -= byte_count;
-
-		*checksum_value ^= value_64bit;
+		buffer_iterator += 1;
+		size            -= 1;
+		byte_index      += 1;
 	}
 	return( 1 );
 }
@@ -40,6 +40,7 @@
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
 #include "deflate.h"
+#include "parallel_deflate.h"
 
 /* Prints the executable usage information
  */
@@ -53,7 +54,7 @@ void usage_fprint(
 	fprintf( stream, "Use zcompress to compress data as zlib compressed data.\n\n" );
 
 	fprintf( stream, "Usage: zcompress [ -l compression_level ] [ -o offset ]\n"
-	                 "                 [ -s size ] [ -12hvV ] source\n\n" );
+	                 "                 [ -s size ] [ -t threads ] [ -12hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -63,6 +64,9 @@ void usage_fprint(
 	fprintf( stream, "\t-l:     compression level (default is -1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     number of threads to compress with, the data is split into\n"
+	                 "\t        chunks that are compressed concurrently, only supported by\n"
+	                 "\t        the internal compression method (default is 1)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -92,6 +96,7 @@ int main( int argc, char * const argv[] )
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
 	int compression_method            = 2;
+	int number_of_threads             = 1;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -127,7 +132,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hl:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12hl:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -183,6 +188,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -208,6 +221,30 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( compression_method != 2 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Threads are only supported by the internal compression method.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -438,13 +475,29 @@ int main( int argc, char * const argv[] )
 	}
 	else if( compression_method == 2 )
 	{
-		if( deflate_compress(
-		     buffer,
-		     source_size,
-		     compression_level,
-		     compressed_data,
-		     &compressed_data_size,
-		     &error ) != 1 )
+		if( number_of_threads > 1 )
+		{
+			result = parallel_deflate_compress(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+			          number_of_threads,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
+		}
+		else
+		{
+			result = deflate_compress(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
@@ -39,7 +39,15 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
-#include "deflate.h"
+#include "block_reader.h"
+#include "deflate_stream.h"
+#include "gzip.h"
+#include "parallel_deflate.h"
+
+/* The maximum size of the uncompressed data that is kept in memory
+ * when decompressing with multiple threads
+ */
+#define ZDECOMPRESS_MAXIMUM_PARALLEL_DATA_SIZE	( 1024 * 1024 * 1024 )
 
 /* Prints the executable usage information
  */
@@ -50,17 +58,26 @@ void usage_fprint(
 	{
 		return;
 	}
-	fprintf( stream, "Use zdecompress to decompress data as zlib compressed data.\n\n" );
+	fprintf( stream, "Use zdecompress to decompress data as zlib or gzip compressed data.\n\n" );
 
-	fprintf( stream, "Usage: zdecompress [ -o offset ] [ -s size ] [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: zdecompress [ -o offset ] [ -s size ] [ -t threads ]\n"
+	                 "                   [ -12ghvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the zlib decompression method\n" );
 	fprintf( stream, "\t-2:     use the internal decompression method (default)\n" );
+	fprintf( stream, "\t-g:     the data is gzip compressed, members are decompressed\n"
+	                 "\t        concurrently when multiple threads are used, only supported\n"
+	                 "\t        by the internal decompression method\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     number of threads to decompress with, the data is split into\n"
+	                 "\t        chunks that are decompressed speculatively, only supported by\n"
+	                 "\t        the internal decompression method (default is 1), if the\n"
+	                 "\t        compressed or uncompressed data exceeds 1073741824 bytes it\n"
+	                 "\t        is decompressed with a single thread\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -76,20 +93,30 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
+	block_reader_t *block_reader       = NULL;
+	deflate_stream_t *deflate_stream   = NULL;
+	gzip_member_index_t *member_index  = NULL;
 	libcerror_error_t *error           = NULL;
 	libcfile_file_t *destination_file  = NULL;
 	libcfile_file_t *source_file       = NULL;
 	system_character_t *source         = NULL;
+	uint8_t *block_data                = NULL;
 	uint8_t *buffer                    = NULL;
 	uint8_t *uncompressed_data         = NULL;
 	char *program                      = "zdecompress";
 	system_integer_t option            = 0;
 	size64_t source_size               = 0;
+	size_t block_data_offset           = 0;
+	size_t block_data_size             = 0;
+	size_t uncompressed_data_offset    = 0;
 	size_t uncompressed_data_size      = 0;
 	ssize_t read_count                 = 0;
 	ssize_t write_count                = 0;
 	off_t source_offset                = 0;
 	int decompression_method           = 2;
+	int decompression_result           = 0;
+	int gzip_format                    = 0;
+	int number_of_threads              = 1;
 	int print_count                    = 0;
 	int result                         = 0;
 	int verbose                        = 0;
@@ -105,7 +132,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12gho:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -131,6 +158,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'g':
+				gzip_format = 1;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -153,6 +185,14 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -178,6 +218,42 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( decompression_method != 2 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Threads are only supported by the internal decompression method.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( gzip_format != 0 )
+	 && ( decompression_method != 2 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Gzip is only supported by the internal decompression method.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -239,38 +315,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX / 16 )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	uncompressed_data_size = source_size * 16;
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -300,19 +344,36 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Read and decompress the data
+	/* Open the destination file
 	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( libcfile_file_initialize(
+	     &destination_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create destination file.\n" );
 
-	if( read_count != (ssize_t) source_size )
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          destination_file,
+	          destination,
+	          LIBCFILE_OPEN_WRITE,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          destination_file,
+	          destination,
+	          LIBCFILE_OPEN_WRITE,
+	          &error );
+#endif
+ 	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to open destination file.\n" );
 
 		goto on_error;
 	}
@@ -326,6 +387,54 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 
 #else
+		if( source_size > (size64_t) SSIZE_MAX / 16 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data_size = source_size * 16;
+
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		/* Read and decompress the data
+		 */
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      source_size,
+		              &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
 		zlib_uncompressed_data_size = (uLongf) uncompressed_data_size;
 
 		if( uncompress(
@@ -342,16 +451,127 @@ int main( int argc, char * const argv[] )
 		}
 		uncompressed_data_size = (size_t) zlib_uncompressed_data_size;
 
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
+
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 #endif /* !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL ) */
 	}
-	else if( decompression_method == 2 )
+	else if( ( decompression_method == 2 )
+	      && ( gzip_format != 0 ) )
 	{
-		if( deflate_decompress_zlib(
+		/* The member index is used to determine the uncompressed data size
+		 * and the boundaries of the members to decompress concurrently
+		 */
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      source_size,
+		              &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( gzip_member_index_initialize(
+		     &member_index,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create member index.\n" );
+
+			goto on_error;
+		}
+		if( gzip_member_index_build(
+		     member_index,
 		     buffer,
-		     source_size,
-		     uncompressed_data,
-		     &uncompressed_data_size,
+		     (size_t) source_size,
 		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to build member index.\n" );
+
+			goto on_error;
+		}
+		if( member_index->uncompressed_data_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid uncompressed data size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data_size = (size_t) member_index->uncompressed_data_size;
+
+		/* Allocate at least 1 byte so that gzip data without uncompressed data is supported
+		 */
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * ( uncompressed_data_size + 1 ) );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		if( number_of_threads > 1 )
+		{
+			result = parallel_deflate_decompress_gzip(
+			          member_index,
+			          buffer,
+			          (size_t) source_size,
+			          number_of_threads,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+		}
+		else
+		{
+			result = gzip_decompress(
+			          buffer,
+			          (size_t) source_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
@@ -359,53 +579,309 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( gzip_member_index_free(
+		     &member_index,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free member index.\n" );
+
+			goto on_error;
+		}
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
+
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 	}
-	/* Open the destination file
-	 */
-	if( libcfile_file_initialize(
-	     &destination_file,
-	     &error ) != 1 )
+	else if( ( decompression_method == 2 )
+	      && ( number_of_threads > 1 ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create destination file.\n" );
+		/* The chunks of the compressed data are decompressed concurrently
+		 * hence the source and uncompressed data are kept in memory
+		 */
+		if( source_size > (size64_t) ZDECOMPRESS_MAXIMUM_PARALLEL_DATA_SIZE )
+		{
+			result = 0;
+		}
+		else
+		{
+			buffer = (uint8_t *) memory_allocate(
+			                      sizeof( uint8_t ) * source_size );
 
-		goto on_error;
+			if( buffer == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create buffer.\n" );
+
+				goto on_error;
+			}
+			/* The uncompressed data buffer is resized as the chunks are decoded
+			 */
+			uncompressed_data_size = ZDECOMPRESS_MAXIMUM_PARALLEL_DATA_SIZE;
+
+			if( source_size < (size64_t) ( ZDECOMPRESS_MAXIMUM_PARALLEL_DATA_SIZE / 4 ) )
+			{
+				uncompressed_data_size = (size_t) source_size * 4;
+			}
+			uncompressed_data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+			if( uncompressed_data == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create uncompressed data buffer.\n" );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      source_size,
+			              &error );
+
+			if( read_count != (ssize_t) source_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			result = parallel_deflate_decompress_data(
+			          buffer,
+			          (size_t) source_size,
+			          PARALLEL_DEFLATE_DEFAULT_COMPRESSED_CHUNK_SIZE,
+			          number_of_threads,
+			          ZDECOMPRESS_MAXIMUM_PARALLEL_DATA_SIZE,
+			          &uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+		}
+		if( result == 1 )
+		{
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       uncompressed_data,
+				       uncompressed_data_size,
+				       &error );
+
+			if( write_count != (ssize_t) uncompressed_data_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write to destination file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Nothing has been written to the destination file yet, hence the
+			 * data is decompressed again in blocks with a single thread
+			 */
+			fprintf(
+			 stdout,
+			 "Data exceeds maximum size for multiple threads, decompressing with a single thread.\n" );
+
+			if( uncompressed_data != NULL )
+			{
+				memory_free(
+				 uncompressed_data );
+
+				uncompressed_data = NULL;
+			}
+			if( buffer != NULL )
+			{
+				memory_free(
+				 buffer );
+
+				buffer = NULL;
+			}
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     source_offset,
+			     SEEK_SET,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to seek offset in source file.\n" );
+
+				goto on_error;
+			}
+			number_of_threads = 1;
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#endif
- 	if( result != 1 )
+	if( ( decompression_method == 2 )
+	 && ( gzip_format == 0 )
+	 && ( number_of_threads == 1 ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open destination file.\n" );
+		/* Decompress the data in blocks so that the memory usage does not
+		 * depend on the size of the source or uncompressed data
+		 */
+		uncompressed_data_size = BLOCK_READER_DEFAULT_BLOCK_SIZE;
 
-		goto on_error;
-	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( deflate_stream_initialize(
+		     &deflate_stream,
+		     DEFLATE_STREAM_FORMAT_ZLIB,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create deflate stream.\n" );
+
+			goto on_error;
+		}
+		if( block_reader_initialize(
+		     &block_reader,
+		     BLOCK_READER_DEFAULT_BLOCK_SIZE,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create block reader.\n" );
+
+			goto on_error;
+		}
+		if( block_reader_open(
+		     block_reader,
+		     source_file,
+		     source_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open block reader.\n" );
+
+			goto on_error;
+		}
+		while( decompression_result == 0 )
+		{
+			result = block_reader_get_next_block(
+			          block_reader,
+			          &block_data,
+			          &block_data_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			block_data_offset = 0;
+
+			do
+			{
+				uncompressed_data_offset = 0;
+
+				decompression_result = deflate_stream_decompress(
+				                        deflate_stream,
+				                        block_data,
+				                        block_data_size,
+				                        &block_data_offset,
+				                        uncompressed_data,
+				                        uncompressed_data_size,
+				                        &uncompressed_data_offset,
+				                        &error );
+
+				if( decompression_result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to decompress data.\n" );
+
+					goto on_error;
+				}
+				if( uncompressed_data_offset > 0 )
+				{
+					write_count = libcfile_file_write_buffer(
+						       destination_file,
+						       uncompressed_data,
+						       uncompressed_data_offset,
+						       &error );
+
+					if( write_count != (ssize_t) uncompressed_data_offset )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to write to destination file.\n" );
+
+						goto on_error;
+					}
+				}
+			}
+			while( ( decompression_result == 0 )
+			    && ( ( block_data_offset < block_data_size )
+			      || ( uncompressed_data_offset == uncompressed_data_size ) ) );
+		}
+		if( decompression_result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress data: missing end of compressed data.\n" );
+
+			goto on_error;
+		}
+		if( block_reader_free(
+		     &block_reader,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free block reader.\n" );
+
+			goto on_error;
+		}
+		if( deflate_stream_free(
+		     &deflate_stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free deflate stream.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -449,12 +925,16 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
-	memory_free(
-	 buffer );
-
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
 	if( result == -1 )
 	{
 		fprintf(
@@ -477,6 +957,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( block_reader != NULL )
+	{
+		block_reader_free(
+		 &block_reader,
+		 NULL );
+	}
+	if( deflate_stream != NULL )
+	{
+		deflate_stream_free(
+		 &deflate_stream,
+		 NULL );
+	}
+	if( member_index != NULL )
+	{
+		gzip_member_index_free(
+		 &member_index,
+		 NULL );
+	}
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
@@ -142,6 +142,274 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the adler32_calculate_checksum_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_calculate_checksum_simd(
+     void )
+{
+	uint8_t *buffer          = NULL;
+	libcerror_error_t *error = NULL;
+	size_t buffer_index      = 0;
+	uint32_t checksum_value  = 0;
+	uint32_t expected_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculation of data larger than the 5552 bytes modulo window
+	 * with a size that is not a multiple of the SIMD block size
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 16411 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	for( buffer_index = 0;
+	     buffer_index < 16411;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = 0xff;
+	}
+	result = adler32_calculate_checksum_basic2(
+	          &expected_value,
+	          buffer,
+	          16411,
+	          0xfff0fff0UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          buffer,
+	          16411,
+	          0xfff0fff0UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	/* Test error cases
+	 */
+	result = adler32_calculate_checksum_simd(
+	          NULL,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          assorted_test_adler32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* Tests the adler32_combine_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_combine_checksums(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t checksum_value        = 0;
+	uint32_t first_checksum_value  = 0;
+	uint32_t second_checksum_value = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = adler32_calculate_checksum_basic1(
+	          &first_checksum_value,
+	          assorted_test_adler32_data,
+	          7,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = adler32_calculate_checksum_basic1(
+	          &second_checksum_value,
+	          &( assorted_test_adler32_data[ 7 ] ),
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = adler32_combine_checksums(
+	          &checksum_value,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = adler32_combine_checksums(
+	          NULL,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -189,7 +457,13 @@ int main(
 
 	/* TODO add tests for adler32_calculate_checksum_cpu_aligned */
 
-	/* TODO add tests for adler32_calculate_checksum_simd */
+	ASSORTED_TEST_RUN(
+	 "adler32_calculate_checksum_simd",
+	 assorted_test_adler32_calculate_checksum_simd );
+
+	ASSORTED_TEST_RUN(
+	 "adler32_combine_checksums",
+	 assorted_test_adler32_combine_checksums );
 
 #endif /* defined( __GNUC__ ) */
 
@@ -138,10 +138,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -173,10 +173,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x0000000000000007ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -208,10 +208,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -243,10 +243,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -359,6 +359,272 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the bit_stream_refill function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_refill(
+     void )
+{
+	uint8_t storage_types[ 3 ] = {
+		BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+		BIT_STREAM_STORAGE_TYPE_16BIT_LITTLE_ENDIAN };
+
+	bit_stream_t *bit_stream           = NULL;
+	bit_stream_t *reference_bit_stream = NULL;
+	libcerror_error_t *error           = NULL;
+	uint32_t reference_value_32bit     = 0;
+	uint32_t value_32bit               = 0;
+	uint8_t number_of_bits             = 0;
+	int remaining_number_of_bits       = 0;
+	int result                         = 0;
+	int storage_type_index             = 0;
+
+	/* Initialize test
+	 */
+	result = bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bit_stream_data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00db8f6d59bdda78ULL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	/* Test that refill with peek and consume returns the same values as bit_stream_get_value
+	 */
+	for( storage_type_index = 0;
+	     storage_type_index < 3;
+	     storage_type_index++ )
+	{
+		result = bit_stream_initialize(
+		          &reference_bit_stream,
+		          assorted_test_bit_stream_data,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		bit_stream->storage_type           = storage_types[ storage_type_index ];
+		bit_stream->byte_stream_offset     = 0;
+		bit_stream->bit_buffer             = 0;
+		bit_stream->bit_buffer_size        = 0;
+		reference_bit_stream->storage_type = storage_types[ storage_type_index ];
+
+		remaining_number_of_bits = 16 * 8;
+		number_of_bits           = 1;
+
+		while( remaining_number_of_bits > 0 )
+		{
+			if( number_of_bits > remaining_number_of_bits )
+			{
+				number_of_bits = (uint8_t) remaining_number_of_bits;
+			}
+			result = bit_stream_get_value(
+			          reference_bit_stream,
+			          number_of_bits,
+			          &reference_value_32bit,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( bit_stream->bit_buffer_size < number_of_bits )
+			{
+				result = bit_stream_refill(
+				          bit_stream,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+			 "bit_stream->bit_buffer_size",
+			 (int) bit_stream->bit_buffer_size,
+			 (int) number_of_bits - 1 );
+
+			if( bit_stream->storage_type == BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				value_32bit = bit_stream_back_to_front_peek_value(
+				               bit_stream,
+				               number_of_bits );
+
+				bit_stream_back_to_front_consume(
+				 bit_stream,
+				 number_of_bits );
+			}
+			else
+			{
+				value_32bit = bit_stream_front_to_back_peek_value(
+				               bit_stream,
+				               number_of_bits );
+
+				bit_stream_front_to_back_consume(
+				 bit_stream,
+				 number_of_bits );
+			}
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "value_32bit",
+			 value_32bit,
+			 reference_value_32bit );
+
+			remaining_number_of_bits -= number_of_bits;
+			number_of_bits            = ( number_of_bits % 13 ) + 1;
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "bit_stream->byte_stream_offset",
+		 bit_stream->byte_stream_offset,
+		 (size_t) 16 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "bit_stream->bit_buffer_size",
+		 bit_stream->bit_buffer_size,
+		 (uint8_t) 0 );
+
+		result = bit_stream_free(
+		          &reference_bit_stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = bit_stream_refill(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream->storage_type = BIT_STREAM_STORAGE_TYPE_UNKNOWN;
+
+	result = bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	bit_stream->storage_type = BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &reference_bit_stream,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -394,6 +660,10 @@ int main(
 
 	/* TODO add tests for bit_stream_read */
 
+	ASSORTED_TEST_RUN(
+	 "bit_stream_refill",
+	 assorted_test_bit_stream_refill );
+
 	ASSORTED_TEST_RUN(
 	 "bit_stream_get_value",
 	 assorted_test_bit_stream_get_value );
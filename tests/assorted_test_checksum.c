@@ -0,0 +1,869 @@
+/*
+ * Checksum functions testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/checksum.h"
+#include "../src/cpu_features.h"
+
+/* Define to make assorted_test_checksum generate verbose output
+#define ASSORTED_TEST_CHECKSUM_VERBOSE
+ */
+
+uint8_t assorted_test_checksum_data[ 16 ] = {
+	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
+
+#if defined( __GNUC__ )
+
+/* Tests the checksum_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases without CPU specific calculations
+	 */
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "none" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_initialize(
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_calculate_adler32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_calculate_crc32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with all supported CPU specific calculations
+	 */
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "auto" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_initialize(
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_calculate_adler32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_calculate_crc32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_adler32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_adler32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_adler32(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_adler32(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_crc32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_crc32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_crc32(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_crc32(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_crc64 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_crc64(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_crc64(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf82c10c90ffd6c65ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_crc64(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_crc64(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_fletcher32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_fletcher32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_fletcher32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_fletcher32(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_fletcher32(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_fletcher64 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_fletcher64(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_fletcher64(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x4002d864c6952c0dULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_fletcher64(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_fletcher64(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_xor32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_xor32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_xor32(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xa2646f11UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_xor32(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_xor32(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_xor64 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_calculate_xor64(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_xor64(
+	          &checksum_value,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x01a54b78a3c12469ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checksum_calculate_xor64(
+	          NULL,
+	          assorted_test_checksum_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checksum_calculate_xor64(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CHECKSUM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "checksum_initialize",
+	 assorted_test_checksum_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_adler32",
+	 assorted_test_checksum_calculate_adler32 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_crc32",
+	 assorted_test_checksum_calculate_crc32 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_crc64",
+	 assorted_test_checksum_calculate_crc64 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_fletcher32",
+	 assorted_test_checksum_calculate_fletcher32 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_fletcher64",
+	 assorted_test_checksum_calculate_fletcher64 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_xor32",
+	 assorted_test_checksum_calculate_xor32 );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_xor64",
+	 assorted_test_checksum_calculate_xor64 );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
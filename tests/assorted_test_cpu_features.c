@@ -0,0 +1,309 @@
+/*
+ * CPU feature functions testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/cpu_features.h"
+
+/* Define to make assorted_test_cpu_features generate verbose output
+#define ASSORTED_TEST_CPU_FEATURES_VERBOSE
+ */
+
+#if defined( __GNUC__ )
+
+/* Tests the cpu_features_set_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cpu_features_set_mask(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t feature_flags   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "none" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	feature_flags = cpu_features_get_flags();
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "feature_flags",
+	 feature_flags,
+	 (uint32_t) 0 );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "ssse3,pclmulqdq" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	feature_flags = cpu_features_get_flags();
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "feature_flags",
+	 feature_flags,
+	 ( cpu_features_detect() & ( CPU_FEATURE_FLAG_SSSE3 | CPU_FEATURE_FLAG_PCLMULQDQ ) ) );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "auto" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	feature_flags = cpu_features_get_flags();
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "feature_flags",
+	 feature_flags,
+	 cpu_features_detect() );
+
+	/* Test error cases
+	 */
+	result = cpu_features_set_mask(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "ssse3,bogus" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "ssse3," ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a failed set does not change the mask
+	 */
+	feature_flags = cpu_features_get_flags();
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "feature_flags",
+	 feature_flags,
+	 cpu_features_detect() );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cpu_features_has_support function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cpu_features_has_support(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "none" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpu_features_has_support(
+	          CPU_FEATURE_FLAG_SSSE3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = cpu_features_set_mask(
+	          _SYSTEM_STRING( "auto" ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpu_features_has_support(
+	          CPU_FEATURE_FLAG_SSSE3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 (int) ( ( cpu_features_detect() & CPU_FEATURE_FLAG_SSSE3 ) != 0 ) );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CPU_FEATURES_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "cpu_features_set_mask",
+	 assorted_test_cpu_features_set_mask );
+
+	ASSORTED_TEST_RUN(
+	 "cpu_features_has_support",
+	 assorted_test_cpu_features_has_support );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -72,7 +72,7 @@ int assorted_test_crc32_calculate_modulo2(
 	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
 	 "checksum_value",
 	 checksum_value,
-	 (uint32_t) 0xf8626102UL );
+	 (uint32_t) 0xf862619aUL );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -248,6 +248,637 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the crc32_calculate_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_8(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint32_t checksum_value    = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t random_value      = 0x12345678UL;
+	uint8_t weak_crc           = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the calculation matches the table lookup calculation
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	for( weak_crc = 0;
+	     weak_crc < 2;
+	     weak_crc++ )
+	{
+		for( data_size = 0;
+		     data_size < 1024;
+		     data_size += 7 )
+		{
+			data_offset = data_size % 13;
+
+			result = crc32_calculate(
+			          &expected_checksum,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x89abcdefUL,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc32_calculate_slicing_by_8(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x89abcdefUL,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_calculate_slicing_by_8(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc32_calculate_slicing_by_16 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_16(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint32_t checksum_value    = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t random_value      = 0x12345678UL;
+	uint8_t weak_crc           = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the calculation matches the table lookup calculation
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	for( weak_crc = 0;
+	     weak_crc < 2;
+	     weak_crc++ )
+	{
+		for( data_size = 0;
+		     data_size < 1024;
+		     data_size += 7 )
+		{
+			data_offset = data_size % 13;
+
+			result = crc32_calculate(
+			          &expected_checksum,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x89abcdefUL,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc32_calculate_slicing_by_16(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x89abcdefUL,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_calculate_slicing_by_16(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc32_calculate_folding function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_folding(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	uint32_t checksum_value  = 0;
+	uint32_t polynomials[ 2 ]  = { 0xedb88320UL, 0x82f63b78UL };
+	uint32_t expected_checksum = 0;
+	uint32_t random_value      = 0x12345678UL;
+	uint8_t polynomial_index   = 0;
+	uint8_t weak_crc           = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = crc32_calculate_folding(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the calculation matches the table lookup calculation
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	/* Test with both the default and a custom polynomial table
+	 */
+	for( polynomial_index = 0;
+	     polynomial_index < 2;
+	     polynomial_index++ )
+	{
+		initialize_crc32_table(
+		 polynomials[ polynomial_index ] );
+
+		for( weak_crc = 0;
+		     weak_crc < 2;
+		     weak_crc++ )
+		{
+			for( data_size = 0;
+			     data_size < 1024;
+			     data_size += 7 )
+			{
+				data_offset = data_size % 13;
+
+				result = crc32_calculate(
+				          &expected_checksum,
+				          &( data[ data_offset ] ),
+				          data_size - data_offset,
+				          0x89abcdefUL,
+				          weak_crc,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				result = crc32_calculate_folding(
+				          &checksum_value,
+				          &( data[ data_offset ] ),
+				          data_size - data_offset,
+				          0x89abcdefUL,
+				          weak_crc,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+				 "checksum_value",
+				 checksum_value,
+				 expected_checksum );
+			}
+		}
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_calculate_folding(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_folding(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_calculate_folding(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	return( 0 );
+}
+
+/* Tests the crc32_combine_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_combine_checksums(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t checksum_value        = 0;
+	uint32_t first_checksum_value  = 0;
+	uint32_t second_checksum_value = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = crc32_calculate(
+	          &first_checksum_value,
+	          assorted_test_crc32_data,
+	          7,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc32_calculate(
+	          &second_checksum_value,
+	          &( assorted_test_crc32_data[ 7 ] ),
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc32_combine_checksums(
+	          &checksum_value,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          0xedb88320UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_combine_checksums(
+	          NULL,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          0xedb88320UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -285,6 +916,22 @@ int main(
 	 "crc32_calculate",
 	 assorted_test_crc32_calculate );
 
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_slicing_by_8",
+	 assorted_test_crc32_calculate_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_slicing_by_16",
+	 assorted_test_crc32_calculate_slicing_by_16 );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_folding",
+	 assorted_test_crc32_calculate_folding );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_combine_checksums",
+	 assorted_test_crc32_combine_checksums );
+
 	/* TODO add tests for crc32_validate */
 
 	/* TODO add tests for crc32_locate_error_offset */
@@ -240,6 +240,505 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the crc64_calculate_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_slicing_by_8(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	uint64_t polynomials[ 3 ]  = { 0x9a6c9329ac4bc9b5ULL, 0xc96c5795d7870f42ULL, 0xd800000000000000ULL };
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint64_t checksum_value    = 0;
+	uint64_t expected_checksum = 0;
+	uint32_t random_value      = 0x12345678UL;
+	uint8_t polynomial_index   = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = crc64_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf82c10c90ffd6c65ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the calculation matches the table lookup calculation
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	/* Test with the default, ECMA-182 and ISO 3309 polynomial tables
+	 */
+	for( polynomial_index = 0;
+	     polynomial_index < 3;
+	     polynomial_index++ )
+	{
+		initialize_crc64_table(
+		 polynomials[ polynomial_index ] );
+
+		for( data_size = 0;
+		     data_size < 1024;
+		     data_size += 7 )
+		{
+			data_offset = data_size % 13;
+
+			result = crc64_calculate_2(
+			          &expected_checksum,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc64_calculate_slicing_by_8(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum );
+		}
+	}
+	/* Test the ECMA-182 check value as used by xz, which uses an initial
+	 * and final XOR with -1
+	 */
+	initialize_crc64_table(
+	 0xc96c5795d7870f42ULL );
+
+	result = crc64_calculate_slicing_by_8(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 (uint64_t) ( checksum_value ^ 0xffffffffffffffffULL ),
+	 (uint64_t) 0x995dc9bbdf1939faULL );
+
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc64_calculate_slicing_by_8(
+	          NULL,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc64_calculate_slicing_by_8(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc64_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	return( 0 );
+}
+
+/* Tests the crc64_calculate_folding function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_folding(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	uint64_t polynomials[ 3 ]  = { 0x9a6c9329ac4bc9b5ULL, 0xc96c5795d7870f42ULL, 0xd800000000000000ULL };
+	libcerror_error_t *error   = NULL;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+	uint64_t checksum_value    = 0;
+	uint64_t expected_checksum = 0;
+	uint32_t random_value      = 0x12345678UL;
+	uint8_t polynomial_index   = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = crc64_calculate_folding(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf82c10c90ffd6c65ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the calculation matches the table lookup calculation
+	 */
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	/* Test with the default, ECMA-182 and ISO 3309 polynomial tables
+	 */
+	for( polynomial_index = 0;
+	     polynomial_index < 3;
+	     polynomial_index++ )
+	{
+		initialize_crc64_table(
+		 polynomials[ polynomial_index ] );
+
+		for( data_size = 0;
+		     data_size < 1024;
+		     data_size += 7 )
+		{
+			data_offset = data_size % 13;
+
+			result = crc64_calculate_2(
+			          &expected_checksum,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc64_calculate_folding(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum );
+		}
+	}
+	/* Test the ECMA-182 check value as used by xz, which uses an initial
+	 * and final XOR with -1
+	 */
+	initialize_crc64_table(
+	 0xc96c5795d7870f42ULL );
+
+	result = crc64_calculate_folding(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 (uint64_t) ( checksum_value ^ 0xffffffffffffffffULL ),
+	 (uint64_t) 0x995dc9bbdf1939faULL );
+
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc64_calculate_folding(
+	          NULL,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc64_calculate_folding(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc64_calculate_folding(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	return( 0 );
+}
+
+/* Tests the crc64_combine_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_combine_checksums(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t checksum_value        = 0;
+	uint64_t first_checksum_value  = 0;
+	uint64_t second_checksum_value = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = crc64_calculate_2(
+	          &first_checksum_value,
+	          assorted_test_crc64_data,
+	          7,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc64_calculate_2(
+	          &second_checksum_value,
+	          &( assorted_test_crc64_data[ 7 ] ),
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc64_combine_checksums(
+	          &checksum_value,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          0x9a6c9329ac4bc9b5ULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf82c10c90ffd6c65ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc64_combine_checksums(
+	          NULL,
+	          first_checksum_value,
+	          second_checksum_value,
+	          9,
+	          0x9a6c9329ac4bc9b5ULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -277,6 +776,18 @@ int main(
 	 "crc64_calculate_2",
 	 assorted_test_crc64_calculate_2 );
 
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate_slicing_by_8",
+	 assorted_test_crc64_calculate_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate_folding",
+	 assorted_test_crc64_calculate_folding );
+
+	ASSORTED_TEST_RUN(
+	 "crc64_combine_checksums",
+	 assorted_test_crc64_combine_checksums );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
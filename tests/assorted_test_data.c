@@ -0,0 +1,75 @@
+/*
+ * Test data functions
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_test_data.h"
+
+/* Fills the data with literals and matches upto the maximum distance
+ * The first 64 bytes are literals, after which a quarter of the elements are matches
+ * of 3 upto the maximum match size bytes, where matches can overlap themselves
+ * The maximum distance and maximum match size must be larger than 0 and 2 respectively
+ */
+void assorted_test_data_generate(
+      uint8_t *data,
+      size_t data_size,
+      uint32_t seed,
+      size_t maximum_distance,
+      size_t maximum_match_size )
+{
+	size_t data_offset     = 0;
+	size_t match_distance  = 0;
+	size_t match_size      = 0;
+	uint32_t random_number = seed;
+
+	while( data_offset < data_size )
+	{
+		random_number = ( random_number * 1103515245UL ) + 12345UL;
+
+		if( ( data_offset < 64 )
+		 || ( ( ( random_number >> 16 ) & 0x03 ) != 0 ) )
+		{
+			data[ data_offset++ ] = (uint8_t) ( 'a' + ( ( random_number >> 20 ) & 0x0f ) );
+
+			continue;
+		}
+		match_distance = 1 + ( ( random_number >> 8 ) % maximum_distance );
+
+		if( match_distance > data_offset )
+		{
+			match_distance = data_offset;
+		}
+		random_number = ( random_number * 1103515245UL ) + 12345UL;
+
+		match_size = 3 + ( ( random_number >> 16 ) % ( maximum_match_size - 2 ) );
+
+		while( ( match_size > 0 )
+		    && ( data_offset < data_size ) )
+		{
+			data[ data_offset ] = data[ data_offset - match_distance ];
+
+			data_offset++;
+			match_size--;
+		}
+	}
+}
+
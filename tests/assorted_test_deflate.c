@@ -699,6 +699,7 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 	bit_stream_t *bit_stream               = NULL;
 	huffman_tree_t *distances_huffman_tree = NULL;
 	huffman_tree_t *literals_huffman_tree  = NULL;
+	huffman_tree_t *pre_codes_huffman_tree = NULL;
 	libcerror_error_t *error               = NULL;
 	int result                             = 0;
 
@@ -731,6 +732,25 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 /* TODO add byte stream seek function */
 	bit_stream->byte_stream_offset = 2;
 
+	result = huffman_tree_initialize(
+	          &pre_codes_huffman_tree,
+	          19,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "pre_codes_huffman_tree",
+	 pre_codes_huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = huffman_tree_initialize(
 	          &literals_huffman_tree,
 	          288,
@@ -776,6 +796,7 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 	 */
 	result = deflate_build_dynamic_huffman_trees(
 	          NULL,
+	          pre_codes_huffman_tree,
 	          literals_huffman_tree,
 	          distances_huffman_tree,
 	          &error );
@@ -794,6 +815,7 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 
 	result = deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          pre_codes_huffman_tree,
 	          NULL,
 	          distances_huffman_tree,
 	          &error );
@@ -812,6 +834,7 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 
 	result = deflate_build_dynamic_huffman_trees(
 	          bit_stream,
+	          pre_codes_huffman_tree,
 	          literals_huffman_tree,
 	          NULL,
 	          &error );
@@ -828,6 +851,25 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 	libcerror_error_free(
 	 &error );
 
+	result = deflate_build_dynamic_huffman_trees(
+	          bit_stream,
+	          NULL,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_ASSORTED_TEST_MEMORY )
 
 	for( test_number = 0;
@@ -840,6 +882,7 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 
 		result = deflate_build_dynamic_huffman_trees(
 		          bit_stream,
+		          pre_codes_huffman_tree,
 		          literals_huffman_tree,
 		          distances_huffman_tree,
 		          &error );
@@ -901,6 +944,23 @@ int assorted_test_deflate_build_dynamic_huffman_trees(
 	 "error",
 	 error );
 
+	result = huffman_tree_free(
+	          &pre_codes_huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "pre_codes_huffman_tree",
+	 pre_codes_huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = bit_stream_free(
 	          &bit_stream,
 	          &error );
@@ -933,6 +993,12 @@ on_error:
 		 &literals_huffman_tree,
 		 NULL );
 	}
+	if( pre_codes_huffman_tree != NULL )
+	{
+		huffman_tree_free(
+		 &pre_codes_huffman_tree,
+		 NULL );
+	}
 	if( bit_stream != NULL )
 	{
 		bit_stream_free(
@@ -1014,6 +1080,80 @@ int assorted_test_deflate_build_fixed_huffman_trees(
 	 "error",
 	 error );
 
+	/* The prebuilt fixed literals Huffman tree must match the one built at run-time
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "literals_huffman_tree->lookup_table_bits",
+	 literals_huffman_tree->lookup_table_bits,
+	 deflate_fixed_literals_huffman_tree.lookup_table_bits );
+
+	result = memory_compare(
+	          literals_huffman_tree->symbols,
+	          deflate_fixed_literals_huffman_tree.symbols,
+	          sizeof( int ) * 288 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          literals_huffman_tree->code_size_counts,
+	          deflate_fixed_literals_huffman_tree.code_size_counts,
+	          sizeof( int ) * 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          literals_huffman_tree->lookup_table,
+	          deflate_fixed_literals_huffman_tree.lookup_table,
+	          sizeof( uint32_t ) << literals_huffman_tree->lookup_table_bits );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The prebuilt fixed distances Huffman tree must match the one built at run-time
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "distances_huffman_tree->lookup_table_bits",
+	 distances_huffman_tree->lookup_table_bits,
+	 deflate_fixed_distances_huffman_tree.lookup_table_bits );
+
+	result = memory_compare(
+	          distances_huffman_tree->symbols,
+	          deflate_fixed_distances_huffman_tree.symbols,
+	          sizeof( int ) * 30 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          distances_huffman_tree->code_size_counts,
+	          deflate_fixed_distances_huffman_tree.code_size_counts,
+	          sizeof( int ) * 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          distances_huffman_tree->lookup_table,
+	          deflate_fixed_distances_huffman_tree.lookup_table,
+	          sizeof( uint32_t ) << distances_huffman_tree->lookup_table_bits );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = deflate_build_fixed_huffman_trees(
@@ -1425,6 +1565,119 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the deflate_decode_huffman_verbose function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decode_huffman_verbose(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t uncompressed_data_offset = 0;
+	size_t uncompressed_data_size   = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 * With verbose output enabled deflate_decode_huffman uses deflate_decode_huffman_verbose
+	 */
+	libcnotify_verbose_set(
+	 1 );
+
+	uncompressed_data_size = 8192;
+
+	result = deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	libcnotify_verbose_set(
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = deflate_decode_huffman_verbose(
+	          NULL,
+	          &deflate_fixed_literals_huffman_tree,
+	          &deflate_fixed_distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decode_huffman_verbose(
+	          NULL,
+	          &deflate_fixed_literals_huffman_tree,
+	          &deflate_fixed_distances_huffman_tree,
+	          NULL,
+	          8192,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	libcnotify_verbose_set(
+	 0 );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the deflate_calculate_adler32 function
  * Returns 1 if successful or 0 if not
  */
@@ -1523,23 +1776,105 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the deflate_decompress_zlib function
+/* Tests the deflate_compress function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_decompress_zlib(
+int assorted_test_deflate_compress(
      void )
 {
+	uint8_t compressed_data[ 8192 ];
 	uint8_t uncompressed_data[ 8192 ];
 
 	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int compression_level         = 0;
 	int result                    = 0;
 
 	/* Test regular cases
 	 */
+	for( compression_level = -1;
+	     compression_level <= 9;
+	     compression_level++ )
+	{
+		compressed_data_size = 8192;
+
+		result = deflate_compress(
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640,
+		          compression_level,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = 8192;
+
+		result = deflate_decompress_zlib(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test empty uncompressed data
+	 */
+	compressed_data_size = 8192;
+
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          0,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 8192;
+
 	result = deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
+	          compressed_data,
+	          compressed_data_size,
 	          uncompressed_data,
 	          &uncompressed_data_size,
 	          &error );
@@ -1552,21 +1887,22 @@ int assorted_test_deflate_decompress_zlib(
 	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
 	 "uncompressed_data_size",
 	 uncompressed_data_size,
-	 (size_t) 7640 );
+	 (size_t) 0 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-/* TODO: test uncompressed data too small */
-
 	/* Test error cases
 	 */
-	result = deflate_decompress_zlib(
+	compressed_data_size = 8192;
+
+	result = deflate_compress(
 	          NULL,
-	          2627,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	          7640,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1581,11 +1917,12 @@ int assorted_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_byte_stream,
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
 	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1600,11 +1937,12 @@ int assorted_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
-	          NULL,
-	          &uncompressed_data_size,
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          10,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1619,11 +1957,12 @@ int assorted_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
-	          uncompressed_data,
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
 	          NULL,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1638,21 +1977,578 @@ int assorted_test_deflate_decompress_zlib(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
+	          compressed_data,
+	          NULL,
+	          &error );
 
-on_error:
-	return( 0 );
-}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#endif /* defined( __GNUC__ ) */
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#else
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 64;
+
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decoder_initialize(
+     void )
+{
+	deflate_decoder_t *deflate_decoder = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_decoder_initialize(
+	          &deflate_decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_decoder",
+	 deflate_decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_decoder_free(
+	          &deflate_decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_decoder",
+	 deflate_decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_decoder_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	deflate_decoder = (deflate_decoder_t *) 0x12345678UL;
+
+	result = deflate_decoder_initialize(
+	          &deflate_decoder,
+	          &error );
+
+	deflate_decoder = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_decoder != NULL )
+	{
+		deflate_decoder_free(
+		 &deflate_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = deflate_decoder_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decoder_decompress and deflate_decoder_decompress_zlib functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decoder_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	deflate_decoder_t *deflate_decoder = NULL;
+	libcerror_error_t *error           = NULL;
+	size_t uncompressed_data_size      = 0;
+	int iteration                      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = deflate_decoder_initialize(
+	          &deflate_decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_decoder",
+	 deflate_decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The same decoder is used to decompress multiple streams
+	 */
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		uncompressed_data_size = 8192;
+
+		if( ( iteration % 2 ) == 0 )
+		{
+			result = deflate_decoder_decompress_zlib(
+			          deflate_decoder,
+			          assorted_test_deflate_compressed_byte_stream,
+			          2627,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+		}
+		else
+		{
+			/* The raw DEFLATE stream without the zlib header and Adler-32 checksum
+			 */
+			result = deflate_decoder_decompress(
+			          deflate_decoder,
+			          &( assorted_test_deflate_compressed_byte_stream[ 2 ] ),
+			          2627 - 6,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "deflate_decoder->bit_stream->byte_stream",
+		 deflate_decoder->bit_stream->byte_stream );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = deflate_decoder_decompress_zlib(
+	          NULL,
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decoder_decompress(
+	          NULL,
+	          &( assorted_test_deflate_compressed_byte_stream[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test checksum mismatch
+	 */
+	assorted_test_deflate_compressed_byte_stream[ 2627 - 1 ] ^= 0xff;
+
+	uncompressed_data_size = 8192;
+
+	result = deflate_decoder_decompress_zlib(
+	          deflate_decoder,
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_deflate_compressed_byte_stream[ 2627 - 1 ] ^= 0xff;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the decoder can be reused after an error
+	 */
+	uncompressed_data_size = 1024;
+
+	result = deflate_decoder_decompress_zlib(
+	          deflate_decoder,
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 8192;
+
+	result = deflate_decoder_decompress_zlib(
+	          deflate_decoder,
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = deflate_decoder_free(
+	          &deflate_decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_decoder",
+	 deflate_decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_decoder != NULL )
+	{
+		deflate_decoder_free(
+		 &deflate_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decompress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_zlib(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 7640;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+/* TODO: test uncompressed data too small */
+
+	/* Test error cases
+	 */
+	result = deflate_decompress_zlib(
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
 int main(
      int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
      char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
@@ -1683,15 +2579,35 @@ int main(
 	 "deflate_decode_huffman",
 	 assorted_test_deflate_decode_huffman );
 
+	ASSORTED_TEST_RUN(
+	 "deflate_decode_huffman_verbose",
+	 assorted_test_deflate_decode_huffman_verbose );
+
 	ASSORTED_TEST_RUN(
 	 "deflate_calculate_adler32",
 	 assorted_test_deflate_calculate_adler32 );
 
+	ASSORTED_TEST_RUN(
+	 "deflate_compress",
+	 assorted_test_deflate_compress );
+
 /* TODO add tests for deflate_read_data_header */
 /* TODO add tests for deflate_read_block_header */
 /* TODO add tests for deflate_read_block */
 /* TODO add tests for deflate_decompress */
 
+	ASSORTED_TEST_RUN(
+	 "deflate_decoder_initialize",
+	 assorted_test_deflate_decoder_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_decoder_free",
+	 assorted_test_deflate_decoder_free );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_decoder_decompress",
+	 assorted_test_deflate_decoder_decompress );
+
 	ASSORTED_TEST_RUN(
 	 "deflate_decompress_zlib",
 	 assorted_test_deflate_decompress_zlib );
@@ -0,0 +1,1175 @@
+/*
+ * Library deflate_index type test program
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_data.h"
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/deflate.h"
+#include "../src/deflate_index.h"
+#include "../src/deflate_stream.h"
+
+/* Define to make assorted_test_deflate_index generate verbose output
+#define ASSORTED_TEST_DEFLATE_INDEX_VERBOSE
+ */
+
+#define ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE	262144
+
+uint8_t assorted_test_deflate_index_uncompressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE ];
+
+uint8_t assorted_test_deflate_index_compressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE + 4096 ];
+
+uint8_t assorted_test_deflate_index_decompressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE ];
+
+size_t assorted_test_deflate_index_compressed_data_size = 0;
+
+/* Fills the uncompressed test data with literals and matches upto the maximum distance,
+ * where the short matches make the compressed data consist of multiple blocks, and compresses it
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_deflate_index_generate_data(
+     int compression_level,
+     libcerror_error_t **error )
+{
+	assorted_test_data_generate(
+	 assorted_test_deflate_index_uncompressed_data,
+	 ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE,
+	 0x87654321UL,
+	 32768,
+	 34 );
+
+	assorted_test_deflate_index_compressed_data_size = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE + 4096;
+
+	return( deflate_compress(
+	         assorted_test_deflate_index_uncompressed_data,
+	         ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE,
+	         compression_level,
+	         assorted_test_deflate_index_compressed_data,
+	         &assorted_test_deflate_index_compressed_data_size,
+	         error ) );
+}
+
+/* Reads the uncompressed data at a set of offsets and compares it with the original data
+ * Returns 1 if successful, 0 if the data differs or -1 on error
+ */
+int assorted_test_deflate_index_read_offsets(
+     deflate_index_t *deflate_index,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	size_t read_sizes[ 4 ]      = { 1, 1000, 40000, ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE };
+
+	size_t expected_read_size   = 0;
+	ssize_t read_count          = 0;
+	off64_t uncompressed_offset = 0;
+	int read_sizes_index        = 0;
+
+	for( read_sizes_index = 0;
+	     read_sizes_index < 4;
+	     read_sizes_index++ )
+	{
+		/* Read backwards to force restoring checkpoints
+		 */
+		for( uncompressed_offset = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - 1;
+		     uncompressed_offset >= 0;
+		     uncompressed_offset -= 12345 )
+		{
+			read_count = deflate_index_read_buffer_at_offset(
+			              deflate_index,
+			              compressed_data,
+			              compressed_data_size,
+			              assorted_test_deflate_index_decompressed_data,
+			              read_sizes[ read_sizes_index ],
+			              uncompressed_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				return( -1 );
+			}
+			expected_read_size = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - (size_t) uncompressed_offset;
+
+			if( expected_read_size > read_sizes[ read_sizes_index ] )
+			{
+				expected_read_size = read_sizes[ read_sizes_index ];
+			}
+			if( (size_t) read_count != expected_read_size )
+			{
+				return( 0 );
+			}
+			if( memory_compare(
+			     assorted_test_deflate_index_decompressed_data,
+			     &( assorted_test_deflate_index_uncompressed_data[ uncompressed_offset ] ),
+			     expected_read_size ) != 0 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	/* Read forwards to continue from the end of the previous read
+	 */
+	for( uncompressed_offset = 0;
+	     uncompressed_offset < ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE;
+	     uncompressed_offset += 7000 )
+	{
+		read_count = deflate_index_read_buffer_at_offset(
+		              deflate_index,
+		              compressed_data,
+		              compressed_data_size,
+		              assorted_test_deflate_index_decompressed_data,
+		              7000,
+		              uncompressed_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			return( -1 );
+		}
+		expected_read_size = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - (size_t) uncompressed_offset;
+
+		if( expected_read_size > 7000 )
+		{
+			expected_read_size = 7000;
+		}
+		if( (size_t) read_count != expected_read_size )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     assorted_test_deflate_index_decompressed_data,
+		     &( assorted_test_deflate_index_uncompressed_data[ uncompressed_offset ] ),
+		     expected_read_size ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the deflate_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_initialize(
+     void )
+{
+	deflate_index_t *deflate_index = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_index",
+	 deflate_index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_free(
+	          &deflate_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_index",
+	 deflate_index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_index_initialize(
+	          NULL,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	deflate_index = (deflate_index_t *) 0x12345678UL;
+
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	deflate_index = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_index",
+	 deflate_index );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_index != NULL )
+	{
+		deflate_index_free(
+		 &deflate_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = deflate_index_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_build and deflate_index_read_buffer_at_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_buffer_at_offset(
+     void )
+{
+	size64_t spacings[ 3 ]         = { 0, 65536, 1024 * 1024 };
+	int compression_levels[ 4 ]    = { 0, 1, 6, 9 };
+
+	deflate_index_t *deflate_index = NULL;
+	libcerror_error_t *error       = NULL;
+	size64_t uncompressed_size     = 0;
+	ssize_t read_count             = 0;
+	int compression_level_index    = 0;
+	int number_of_checkpoints      = 0;
+	int result                     = 0;
+	int spacings_index             = 0;
+
+	/* Initialize test
+	 */
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_index",
+	 deflate_index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 4;
+	     compression_level_index++ )
+	{
+		result = assorted_test_deflate_index_generate_data(
+		          compression_levels[ compression_level_index ],
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( spacings_index = 0;
+		     spacings_index < 3;
+		     spacings_index++ )
+		{
+			result = deflate_index_build(
+			          deflate_index,
+			          assorted_test_deflate_index_compressed_data,
+			          assorted_test_deflate_index_compressed_data_size,
+			          spacings[ spacings_index ],
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = deflate_index_get_uncompressed_data_size(
+			          deflate_index,
+			          &uncompressed_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "uncompressed_size",
+			 (uint64_t) uncompressed_size,
+			 (uint64_t) ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE );
+
+			result = deflate_index_get_number_of_checkpoints(
+			          deflate_index,
+			          &number_of_checkpoints,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The data is compressed in multiple blocks
+			 */
+			if( spacings[ spacings_index ] == 0 )
+			{
+				ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+				 "number_of_checkpoints",
+				 number_of_checkpoints,
+				 1 );
+			}
+			else if( spacings[ spacings_index ] >= ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE )
+			{
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "number_of_checkpoints",
+				 number_of_checkpoints,
+				 1 );
+			}
+			result = assorted_test_deflate_index_read_offsets(
+			          deflate_index,
+			          assorted_test_deflate_index_compressed_data,
+			          assorted_test_deflate_index_compressed_data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test reading beyond the end of the data
+	 */
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              (off64_t) ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = deflate_index_read_buffer_at_offset(
+	              NULL,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              0,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              NULL,
+	              assorted_test_deflate_index_compressed_data_size,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              0,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size - 1,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              0,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              -1,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test building the index of truncated compressed data
+	 */
+	result = deflate_index_build(
+	          deflate_index,
+	          assorted_test_deflate_index_compressed_data,
+	          assorted_test_deflate_index_compressed_data_size / 2,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_get_number_of_checkpoints(
+	          deflate_index,
+	          &number_of_checkpoints,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "number_of_checkpoints",
+	 number_of_checkpoints,
+	 0 );
+
+	read_count = deflate_index_read_buffer_at_offset(
+	              deflate_index,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              assorted_test_deflate_index_decompressed_data,
+	              16,
+	              0,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = deflate_index_free(
+	          &deflate_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a raw DEFLATE stream, which is the zlib stream without header and footer
+	 */
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          DEFLATE_STREAM_FORMAT_RAW,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_build(
+	          deflate_index,
+	          &( assorted_test_deflate_index_compressed_data[ 2 ] ),
+	          assorted_test_deflate_index_compressed_data_size - 6,
+	          16384,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_deflate_index_read_offsets(
+	          deflate_index,
+	          &( assorted_test_deflate_index_compressed_data[ 2 ] ),
+	          assorted_test_deflate_index_compressed_data_size - 6,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_free(
+	          &deflate_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_index != NULL )
+	{
+		deflate_index_free(
+		 &deflate_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_write_data and deflate_index_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_data(
+     void )
+{
+	deflate_index_t *deflate_index      = NULL;
+	deflate_index_t *read_deflate_index = NULL;
+	libcerror_error_t *error            = NULL;
+	uint8_t *index_data                 = NULL;
+	size_t index_data_size              = 0;
+	int number_of_checkpoints           = 0;
+	int read_number_of_checkpoints      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_test_deflate_index_generate_data(
+	          6,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_initialize(
+	          &deflate_index,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_initialize(
+	          &read_deflate_index,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_build(
+	          deflate_index,
+	          assorted_test_deflate_index_compressed_data,
+	          assorted_test_deflate_index_compressed_data_size,
+	          65536,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_get_data_size(
+	          deflate_index,
+	          &index_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "index_data",
+	 index_data );
+
+	/* Test regular cases
+	 */
+	result = deflate_index_write_data(
+	          deflate_index,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_get_number_of_checkpoints(
+	          deflate_index,
+	          &number_of_checkpoints,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_get_number_of_checkpoints(
+	          read_deflate_index,
+	          &read_number_of_checkpoints,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "read_number_of_checkpoints",
+	 read_number_of_checkpoints,
+	 number_of_checkpoints );
+
+	result = assorted_test_deflate_index_read_offsets(
+	          read_deflate_index,
+	          assorted_test_deflate_index_compressed_data,
+	          assorted_test_deflate_index_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_index_write_data(
+	          deflate_index,
+	          index_data,
+	          index_data_size - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          index_data,
+	          index_data_size - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_get_number_of_checkpoints(
+	          read_deflate_index,
+	          &read_number_of_checkpoints,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "read_number_of_checkpoints",
+	 read_number_of_checkpoints,
+	 0 );
+
+	/* Test an invalid number of bits in the first checkpoint
+	 */
+	index_data[ DEFLATE_INDEX_HEADER_SIZE + 20 ] = 8;
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	index_data[ DEFLATE_INDEX_HEADER_SIZE + 20 ] = 0;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an invalid signature
+	 */
+	index_data[ 0 ] = 'X';
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	index_data[ 0 ] = 'D';
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unsupported stream format
+	 */
+	index_data[ 10 ] = DEFLATE_STREAM_FORMAT_RAW;
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	index_data[ 10 ] = DEFLATE_STREAM_FORMAT_ZLIB;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_read_data(
+	          NULL,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_read_data(
+	          read_deflate_index,
+	          NULL,
+	          index_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 index_data );
+
+	index_data = NULL;
+
+	result = deflate_index_free(
+	          &read_deflate_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_free(
+	          &deflate_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	if( read_deflate_index != NULL )
+	{
+		deflate_index_free(
+		 &read_deflate_index,
+		 NULL );
+	}
+	if( deflate_index != NULL )
+	{
+		deflate_index_free(
+		 &deflate_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_DEFLATE_INDEX_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_initialize",
+	 assorted_test_deflate_index_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_free",
+	 assorted_test_deflate_index_free );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_read_buffer_at_offset",
+	 assorted_test_deflate_index_read_buffer_at_offset );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_read_data",
+	 assorted_test_deflate_index_read_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,910 @@
+/*
+ * DEFLATE streaming decompression testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_data.h"
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/deflate.h"
+#include "../src/deflate_stream.h"
+
+/* Define to make assorted_test_deflate_stream generate verbose output
+#define ASSORTED_TEST_DEFLATE_STREAM_VERBOSE
+ */
+
+#define ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE	98304
+
+uint8_t assorted_test_deflate_stream_uncompressed_data[ ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE ];
+
+uint8_t assorted_test_deflate_stream_compressed_data[ ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE + 4096 ];
+
+uint8_t assorted_test_deflate_stream_decompressed_data[ ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE ];
+
+/* Decompresses the compressed data in chunks of the input and output size
+ * Returns 1 if successful, 0 if the stream is incomplete or -1 on error
+ */
+int assorted_test_deflate_stream_decompress_chunks(
+     deflate_stream_t *deflate_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t input_chunk_size,
+     size_t output_chunk_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	size_t chunk_offset      = 0;
+	size_t chunk_size        = 0;
+	size_t data_offset       = 0;
+	size_t output_chunk_used = 0;
+	size_t output_size       = 0;
+	int result               = 0;
+
+	*compressed_data_offset = 0;
+
+	while( result == 0 )
+	{
+		chunk_size = compressed_data_size - *compressed_data_offset;
+
+		if( chunk_size > input_chunk_size )
+		{
+			chunk_size = input_chunk_size;
+		}
+		output_size = ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE - data_offset;
+
+		if( output_size > output_chunk_size )
+		{
+			output_size = output_chunk_size;
+		}
+		chunk_offset      = 0;
+		output_chunk_used = 0;
+
+		result = deflate_stream_decompress(
+		          deflate_stream,
+		          &( compressed_data[ *compressed_data_offset ] ),
+		          chunk_size,
+		          &chunk_offset,
+		          &( assorted_test_deflate_stream_decompressed_data[ data_offset ] ),
+		          output_size,
+		          &output_chunk_used,
+		          error );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		*compressed_data_offset += chunk_offset;
+		data_offset             += output_chunk_used;
+
+		if( ( result == 0 )
+		 && ( chunk_offset == 0 )
+		 && ( output_chunk_used == 0 )
+		 && ( chunk_size == 0 ) )
+		{
+			break;
+		}
+	}
+	*uncompressed_data_size = data_offset;
+
+	return( result );
+}
+
+/* Tests the deflate_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_stream_initialize(
+     void )
+{
+	deflate_stream_t *deflate_stream = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_stream_initialize(
+	          &deflate_stream,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_stream",
+	 deflate_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_stream_free(
+	          &deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_stream",
+	 deflate_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_stream_initialize(
+	          NULL,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	deflate_stream = (deflate_stream_t *) 0x12345678UL;
+
+	result = deflate_stream_initialize(
+	          &deflate_stream,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	deflate_stream = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_initialize(
+	          &deflate_stream,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "deflate_stream",
+	 deflate_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_stream != NULL )
+	{
+		deflate_stream_free(
+		 &deflate_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = deflate_stream_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_stream_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_stream_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 16 ];
+
+	size_t chunk_sizes[ 5 ][ 2 ] = {
+		{ 1, 1 }, { 7, 13 }, { 4096, 1000 }, { 1000, 65536 },
+		{ ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE + 4096, ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE } };
+
+	int compression_levels[ 4 ]      = { 0, 1, 6, 9 };
+
+	deflate_stream_t *deflate_stream = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t compressed_data_offset    = 0;
+	size_t compressed_data_size      = 0;
+	size_t uncompressed_data_offset  = 0;
+	size_t uncompressed_data_size    = 0;
+	int chunk_sizes_index            = 0;
+	int compression_level_index      = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_data_generate(
+	 assorted_test_deflate_stream_uncompressed_data,
+	 ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE,
+	 0x12345678UL,
+	 32768,
+	 302 );
+
+	result = deflate_stream_initialize(
+	          &deflate_stream,
+	          DEFLATE_STREAM_FORMAT_ZLIB,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_stream",
+	 deflate_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 4;
+	     compression_level_index++ )
+	{
+		compressed_data_size = ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE + 4096;
+
+		result = deflate_compress(
+		          assorted_test_deflate_stream_uncompressed_data,
+		          ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE,
+		          compression_levels[ compression_level_index ],
+		          assorted_test_deflate_stream_compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( chunk_sizes_index = 0;
+		     chunk_sizes_index < 5;
+		     chunk_sizes_index++ )
+		{
+			result = deflate_stream_reset(
+			          deflate_stream,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = assorted_test_deflate_stream_decompress_chunks(
+			          deflate_stream,
+			          assorted_test_deflate_stream_compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          chunk_sizes[ chunk_sizes_index ][ 0 ],
+			          chunk_sizes[ chunk_sizes_index ][ 1 ],
+			          &uncompressed_data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "compressed_data_offset",
+			 compressed_data_offset,
+			 compressed_data_size );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "uncompressed_data_size",
+			 uncompressed_data_size,
+			 (size_t) ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE );
+
+			result = memory_compare(
+			          assorted_test_deflate_stream_decompressed_data,
+			          assorted_test_deflate_stream_uncompressed_data,
+			          ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test that data trailing the stream is not consumed
+	 */
+	assorted_test_deflate_stream_compressed_data[ compressed_data_size ]     = 0xaa;
+	assorted_test_deflate_stream_compressed_data[ compressed_data_size + 1 ] = 0x55;
+
+	result = deflate_stream_reset(
+	          deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_deflate_stream_decompress_chunks(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size + 2,
+	          &compressed_data_offset,
+	          4096,
+	          4096,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 compressed_data_size );
+
+	/* Test an incomplete stream
+	 */
+	result = deflate_stream_reset(
+	          deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_deflate_stream_decompress_chunks(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size - 1,
+	          &compressed_data_offset,
+	          4096,
+	          4096,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a checksum mismatch
+	 */
+	assorted_test_deflate_stream_compressed_data[ compressed_data_size - 1 ] ^= 0xff;
+
+	result = deflate_stream_reset(
+	          deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_deflate_stream_decompress_chunks(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          4096,
+	          4096,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	assorted_test_deflate_stream_compressed_data[ compressed_data_size - 1 ] ^= 0xff;
+
+	/* Clean up
+	 */
+	result = deflate_stream_free(
+	          &deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the raw format without the zlib data header and footer
+	 */
+	result = deflate_stream_initialize(
+	          &deflate_stream,
+	          DEFLATE_STREAM_FORMAT_RAW,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_deflate_stream_decompress_chunks(
+	          deflate_stream,
+	          &( assorted_test_deflate_stream_compressed_data[ 2 ] ),
+	          compressed_data_size - 6,
+	          &compressed_data_offset,
+	          7,
+	          13,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 compressed_data_size - 6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE );
+
+	result = memory_compare(
+	          assorted_test_deflate_stream_decompressed_data,
+	          assorted_test_deflate_stream_uncompressed_data,
+	          ASSORTED_TEST_DEFLATE_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = deflate_stream_decompress(
+	          NULL,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          NULL,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          NULL,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset = compressed_data_size + 1;
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	compressed_data_offset = 0;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          NULL,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_offset = 17;
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          assorted_test_deflate_stream_compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          &error );
+
+	uncompressed_data_offset = 0;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an invalid block type
+	 */
+	uncompressed_data[ 0 ] = 0x07;
+
+	result = deflate_stream_reset(
+	          deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_stream_decompress(
+	          deflate_stream,
+	          uncompressed_data,
+	          1,
+	          &compressed_data_offset,
+	          &( uncompressed_data[ 8 ] ),
+	          8,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = deflate_stream_free(
+	          &deflate_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_stream != NULL )
+	{
+		deflate_stream_free(
+		 &deflate_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_DEFLATE_STREAM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "deflate_stream_initialize",
+	 assorted_test_deflate_stream_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_stream_free",
+	 assorted_test_deflate_stream_free );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_stream_decompress",
+	 assorted_test_deflate_stream_decompress );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
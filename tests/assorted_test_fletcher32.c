@@ -77,6 +77,41 @@ int assorted_test_fletcher32_calculate(
 	 "error",
 	 error );
 
+	/* Test calculation in multiple blocks using the previous key
+	 */
+	result = fletcher32_calculate(
+	          &checksum_value,
+	          assorted_test_fletcher32_data,
+	          8,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fletcher32_calculate(
+	          &checksum_value,
+	          &( assorted_test_fletcher32_data[ 8 ] ),
+	          8,
+	          checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = fletcher32_calculate(
@@ -77,6 +77,41 @@ int assorted_test_fletcher64_calculate(
 	 "error",
 	 error );
 
+	/* Test calculation in multiple blocks using the previous key
+	 */
+	result = fletcher64_calculate(
+	          &checksum_value,
+	          assorted_test_fletcher64_data,
+	          8,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fletcher64_calculate(
+	          &checksum_value,
+	          &( assorted_test_fletcher64_data[ 8 ] ),
+	          8,
+	          checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x4002d864c6952c0dULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = fletcher64_calculate(
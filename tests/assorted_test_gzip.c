@@ -0,0 +1,1476 @@
+/*
+ * Library gzip functions test program
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/gzip.h"
+
+/* Define to make assorted_test_gzip generate verbose output
+#define ASSORTED_TEST_GZIP_VERBOSE
+ */
+
+/* Contains 3 members, the first with a name, the second with an extra field,
+ * a comment and a header CRC and the third without uncompressed data
+ */
+uint8_t assorted_test_gzip_compressed_data[ 524 ] = {
+	0x1f, 0x8b, 0x08, 0x08, 0x00, 0x10, 0x5e, 0x5f, 0x02, 0x03, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+	0x31, 0x2e, 0x74, 0x78, 0x74, 0x00, 0x6d, 0x53, 0x5b, 0x12, 0x83, 0x30, 0x08, 0xbc, 0x4a, 0xae,
+	0x16, 0x0d, 0x56, 0xc7, 0x57, 0x47, 0xe3, 0xd8, 0xf1, 0xf4, 0x8d, 0xb0, 0x28, 0xb4, 0xfe, 0x84,
+	0x20, 0xec, 0xb2, 0x01, 0x4c, 0x31, 0xc7, 0x50, 0x0d, 0x73, 0xdd, 0xe3, 0xec, 0xa6, 0x44, 0x9f,
+	0xb0, 0x76, 0x07, 0x85, 0xbd, 0xdc, 0xe7, 0x3d, 0xbc, 0x8e, 0xee, 0xad, 0xf7, 0x44, 0xcd, 0x10,
+	0x33, 0x85, 0x74, 0xc2, 0x38, 0x50, 0xb7, 0xdb, 0xd4, 0x87, 0xdc, 0x2e, 0x14, 0x93, 0x7c, 0x9e,
+	0x9b, 0x66, 0xa5, 0x0c, 0xba, 0x35, 0x97, 0xc0, 0x18, 0xda, 0x12, 0xa5, 0x45, 0x0d, 0x32, 0x46,
+	0x1a, 0xab, 0xe2, 0x29, 0xa7, 0x00, 0xea, 0x96, 0xea, 0x7e, 0xdd, 0x46, 0x8d, 0x22, 0x17, 0x48,
+	0xd6, 0x95, 0x97, 0xd8, 0x0d, 0xc5, 0x81, 0x26, 0xc1, 0x39, 0x65, 0xa8, 0x2a, 0x11, 0x30, 0xc0,
+	0xb0, 0xe8, 0x2b, 0x19, 0x96, 0x69, 0x51, 0xc2, 0x36, 0x03, 0x15, 0xbc, 0x6c, 0x47, 0x74, 0x56,
+	0xe3, 0x43, 0x45, 0xa9, 0x85, 0x7c, 0x66, 0xf6, 0x2f, 0x04, 0xa9, 0x34, 0x5a, 0x4e, 0x14, 0x90,
+	0x5e, 0x0a, 0x9d, 0x69, 0x28, 0xee, 0x96, 0x51, 0x98, 0xbc, 0x2e, 0x3c, 0x5a, 0x05, 0xd8, 0x11,
+	0xf2, 0xfd, 0xea, 0x2c, 0x7b, 0xb6, 0xbc, 0x66, 0x81, 0xc0, 0x95, 0x53, 0x3a, 0xc9, 0x14, 0x85,
+	0x17, 0x93, 0x3c, 0xff, 0xa1, 0x89, 0x30, 0x1c, 0x07, 0x91, 0x40, 0x1f, 0xdb, 0x8f, 0x8a, 0x66,
+	0xf5, 0xf0, 0xe5, 0xea, 0x0b, 0xea, 0x99, 0x8d, 0x53, 0x3d, 0x88, 0x00, 0x70, 0xfb, 0x90, 0xcd,
+	0x08, 0xdb, 0x4c, 0xbb, 0x48, 0x7c, 0x70, 0x86, 0x21, 0x76, 0x6f, 0x52, 0xfb, 0xbf, 0xe5, 0x7e,
+	0xa6, 0x3f, 0xab, 0xec, 0x37, 0x42, 0x50, 0x6e, 0x64, 0x9e, 0xf7, 0xfe, 0x9b, 0x30, 0x02, 0x87,
+	0x07, 0x44, 0x5d, 0x4c, 0xdb, 0xaf, 0x26, 0x70, 0xba, 0x09, 0x66, 0xf4, 0xd2, 0xa7, 0xf9, 0x0b,
+	0x3a, 0xed, 0x14, 0xae, 0xe8, 0x03, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x16, 0x00, 0x10, 0x5e, 0x5f,
+	0x02, 0x03, 0x08, 0x00, 0x41, 0x50, 0x04, 0x00, 0x61, 0x62, 0x63, 0x64, 0x73, 0x65, 0x63, 0x6f,
+	0x6e, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x9d, 0xc3, 0x75, 0x51, 0x6d, 0x0e,
+	0xc2, 0x20, 0x0c, 0xbd, 0x0a, 0x57, 0x63, 0x50, 0x84, 0x00, 0x9b, 0x81, 0x2e, 0x33, 0x3b, 0xbd,
+	0x08, 0x0f, 0x04, 0x13, 0x7f, 0xd1, 0xa6, 0xef, 0xab, 0xc5, 0x98, 0x4c, 0x2c, 0xdc, 0xae, 0xe9,
+	0x25, 0x32, 0x27, 0x92, 0x51, 0x6c, 0xe1, 0x50, 0x5e, 0x28, 0x4b, 0xca, 0xe7, 0x33, 0xf6, 0x99,
+	0xbb, 0x09, 0xa5, 0x26, 0x13, 0x24, 0x93, 0xb8, 0x4a, 0x7b, 0x5c, 0xa3, 0xe5, 0x24, 0x5d, 0xa0,
+	0x34, 0x7a, 0x65, 0xcf, 0xdd, 0xcf, 0x6c, 0xc8, 0xb3, 0x2d, 0x8f, 0xee, 0xdd, 0xb0, 0x69, 0xf0,
+	0x2e, 0x62, 0x0b, 0x64, 0xd2, 0xaa, 0xfc, 0xaf, 0xf0, 0x42, 0x01, 0x14, 0x0f, 0xd4, 0xdb, 0x0e,
+	0x5d, 0x6d, 0x0a, 0x5f, 0xcb, 0x36, 0xd5, 0x92, 0x65, 0x2f, 0x21, 0x1d, 0x29, 0x6e, 0x05, 0xff,
+	0xb8, 0xdd, 0x13, 0x9e, 0x1f, 0x0c, 0x34, 0x9b, 0xdd, 0x70, 0xff, 0x89, 0x7a, 0x98, 0xe9, 0x92,
+	0x38, 0x0d, 0x76, 0x5c, 0x46, 0x68, 0x3a, 0x1b, 0x41, 0x9b, 0x03, 0x68, 0x4b, 0x6c, 0x68, 0x20,
+	0x19, 0xd8, 0x23, 0xc4, 0x9f, 0xbf, 0xa8, 0x0b, 0xb4, 0xec, 0xd0, 0x02, 0xbf, 0xda, 0xbd, 0x01,
+	0x1e, 0x65, 0xa0, 0x5f, 0xf4, 0x01, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x10, 0x5e, 0x5f,
+	0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Contains 3 BGZF members and a BGZF end-of-file member
+ */
+uint8_t assorted_test_gzip_bgzf_compressed_data[ 614 ] = {
+	0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+	0xc6, 0x00, 0x55, 0x51, 0x5b, 0x12, 0x84, 0x20, 0x0c, 0xbb, 0x4a, 0xaf, 0x86, 0x50, 0x17, 0x46,
+	0xd1, 0x1d, 0xc1, 0x71, 0xc7, 0xd3, 0x2f, 0xb6, 0xa9, 0x03, 0x3f, 0x7d, 0x98, 0x36, 0x09, 0x35,
+	0xb8, 0xea, 0x68, 0x5a, 0x77, 0xbf, 0x20, 0xa6, 0x2d, 0xf0, 0x8f, 0x4a, 0xba, 0x99, 0xae, 0x56,
+	0xef, 0x17, 0x7d, 0xee, 0xf4, 0xb5, 0x3a, 0xf0, 0xbc, 0xba, 0xca, 0x14, 0x9e, 0x35, 0x01, 0x7c,
+	0x3c, 0xb7, 0x85, 0x6a, 0x3c, 0xd8, 0x05, 0xfd, 0xbc, 0xcf, 0x73, 0xe1, 0x0a, 0xba, 0x52, 0x1b,
+	0x90, 0x29, 0x36, 0x94, 0x0f, 0x4b, 0x98, 0xc8, 0x9c, 0xa7, 0xd6, 0x19, 0xa7, 0x2e, 0xf8, 0xc8,
+	0x7e, 0x29, 0x67, 0x36, 0x14, 0xb3, 0xd8, 0x14, 0x5f, 0xf5, 0x70, 0x69, 0x6d, 0x0d, 0x3c, 0xe9,
+	0xde, 0xe0, 0x0c, 0xaa, 0x8a, 0x80, 0x01, 0x49, 0x4c, 0xbf, 0xc3, 0xc8, 0x42, 0x0b, 0x89, 0xfe,
+	0x18, 0x50, 0x18, 0x6d, 0x0f, 0x44, 0x8f, 0x9a, 0x04, 0x33, 0x65, 0x19, 0xf6, 0x85, 0x79, 0x7c,
+	0x21, 0x48, 0xf5, 0xd0, 0x1a, 0x21, 0xa0, 0xb7, 0x54, 0xba, 0xee, 0xa0, 0xa8, 0x7b, 0x46, 0x65,
+	0x1a, 0x7d, 0xe1, 0xd1, 0x66, 0xa0, 0xff, 0x85, 0x52, 0xbf, 0x97, 0x95, 0x0e, 0xf2, 0x7f, 0x53,
+	0x7f, 0x02, 0x51, 0x00, 0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0xcb, 0x00, 0x55, 0x51, 0x5b, 0x12, 0x83, 0x20, 0x0c,
+	0xbc, 0x4a, 0xae, 0x86, 0x10, 0x2b, 0xa3, 0x68, 0x47, 0x70, 0xec, 0x78, 0xfa, 0xa6, 0xc9, 0x86,
+	0xea, 0x0f, 0x19, 0xd8, 0x47, 0x36, 0x61, 0x4d, 0xfc, 0xa1, 0x33, 0xaf, 0x69, 0x3b, 0xa9, 0xb6,
+	0x9d, 0x43, 0xa1, 0x36, 0x49, 0x49, 0x54, 0xb8, 0x0c, 0xbc, 0x53, 0xdb, 0x43, 0x5e, 0xa4, 0x0a,
+	0x45, 0x98, 0x71, 0x3a, 0xd6, 0x59, 0x4e, 0x8e, 0x73, 0x3d, 0x0a, 0xa5, 0xd0, 0x02, 0x25, 0x1e,
+	0x97, 0xd0, 0x98, 0x6a, 0xbe, 0x98, 0x26, 0x91, 0x0a, 0x1b, 0x45, 0x71, 0x18, 0x99, 0xf4, 0x75,
+	0xe5, 0x77, 0x57, 0x78, 0x45, 0x47, 0x6b, 0xa1, 0x36, 0x78, 0x81, 0x4d, 0xef, 0xa7, 0x6a, 0x33,
+	0xf2, 0x3c, 0x40, 0x20, 0xf8, 0xdf, 0x11, 0x5b, 0x15, 0x00, 0x35, 0x0d, 0x2c, 0xb5, 0x8b, 0x1e,
+	0xca, 0xb8, 0x19, 0x3f, 0x66, 0xf2, 0x6a, 0xd0, 0xdd, 0xc7, 0x91, 0x61, 0xd9, 0xe2, 0xec, 0x33,
+	0x76, 0xd9, 0x8f, 0xe1, 0x11, 0xa0, 0x32, 0xa2, 0x2f, 0xe6, 0xe1, 0xab, 0x74, 0x8d, 0x80, 0x2f,
+	0x78, 0xe8, 0x21, 0xf1, 0xeb, 0x36, 0x8e, 0x95, 0x9b, 0xff, 0x99, 0x8f, 0x63, 0x3a, 0x60, 0x3a,
+	0x17, 0x08, 0xb6, 0x27, 0x00, 0xd8, 0xb0, 0x91, 0x35, 0xd0, 0x17, 0xae, 0xeb, 0x70, 0x93, 0x00,
+	0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42,
+	0x43, 0x02, 0x00, 0xb6, 0x00, 0x75, 0x51, 0xed, 0x0e, 0xc4, 0x10, 0x10, 0x7c, 0x15, 0xaf, 0xa6,
+	0xac, 0x23, 0xa5, 0x6d, 0xd8, 0xa6, 0x97, 0x3e, 0xfd, 0x39, 0x86, 0x72, 0xc9, 0xfd, 0xb2, 0x93,
+	0x9d, 0x2f, 0x08, 0x65, 0x49, 0xad, 0xe9, 0x0c, 0xc2, 0x6d, 0x9a, 0xde, 0x22, 0xb9, 0x9b, 0x30,
+	0x6a, 0x32, 0x5e, 0x32, 0x89, 0x2b, 0xc3, 0xfd, 0xea, 0x90, 0xa3, 0x74, 0x9e, 0x62, 0xc7, 0xca,
+	0x9e, 0xdb, 0x3a, 0xaa, 0x13, 0x47, 0x92, 0x41, 0xb0, 0xcd, 0x87, 0x6e, 0xa8, 0xc7, 0x54, 0x7a,
+	0x33, 0xb1, 0x99, 0x32, 0x78, 0x15, 0xfd, 0x63, 0x3c, 0x49, 0x40, 0xc5, 0x01, 0xf7, 0xc5, 0xef,
+	0xea, 0x71, 0x1b, 0xca, 0x97, 0xb1, 0x6e, 0xb5, 0x64, 0xd9, 0x46, 0x58, 0x07, 0x0a, 0x4b, 0xe6,
+	0xbf, 0x6e, 0x77, 0x20, 0xf3, 0xcb, 0x81, 0x67, 0x8d, 0xeb, 0xe9, 0x3f, 0x55, 0x77, 0x63, 0x12,
+	0x31, 0x52, 0xf0, 0x34, 0xb8, 0xe3, 0xb4, 0x02, 0x68, 0x6a, 0x14, 0xad, 0x09, 0x90, 0x4d, 0xb5,
+	0xe1, 0x81, 0x66, 0x50, 0xf7, 0x12, 0x7f, 0xfe, 0xa2, 0x5c, 0xa0, 0x76, 0x87, 0x17, 0xf4, 0x25,
+	0xee, 0x03, 0x34, 0xd5, 0x9b, 0x84, 0xdc, 0x01, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t assorted_test_gzip_uncompressed_data[ 1500 ] = {
+	0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x77, 0x69, 0x6e, 0x64,
+	0x6f, 0x77, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64,
+	0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x67, 0x7a, 0x69, 0x70,
+	0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
+	0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x6d, 0x65, 0x6d, 0x62,
+	0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+	0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73,
+	0x69, 0x7a, 0x65, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6e, 0x64,
+	0x6f, 0x77, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65,
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x62, 0x6c, 0x6f,
+	0x63, 0x6b, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74,
+	0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x64, 0x65,
+	0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
+	0x72, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x66, 0x73,
+	0x65, 0x74, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72,
+	0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x62, 0x6c, 0x6f,
+	0x63, 0x6b, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x63, 0x68, 0x75,
+	0x6e, 0x6b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x64,
+	0x61, 0x74, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+	0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61,
+	0x6d, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x77,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+	0x73, 0x75, 0x6d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69,
+	0x6e, 0x64, 0x65, 0x78, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x73, 0x74, 0x72, 0x65,
+	0x61, 0x6d, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+	0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x63,
+	0x68, 0x75, 0x6e, 0x6b, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x61,
+	0x74, 0x61, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20,
+	0x67, 0x7a, 0x69, 0x70, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x64, 0x65, 0x66,
+	0x6c, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65,
+	0x78, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x68, 0x65,
+	0x61, 0x64, 0x65, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x67, 0x7a,
+	0x69, 0x70, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x63,
+	0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x63,
+	0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20,
+	0x67, 0x7a, 0x69, 0x70, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x63, 0x68, 0x75, 0x6e,
+	0x6b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x64,
+	0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x72,
+	0x65, 0x61, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65,
+	0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x64, 0x65,
+	0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c,
+	0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x63,
+	0x68, 0x75, 0x6e, 0x6b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x20, 0x73,
+	0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c,
+	0x65, 0x72, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65,
+	0x72, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20,
+	0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x6f, 0x66,
+	0x66, 0x73, 0x65, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+	0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e,
+	0x64, 0x65, 0x78, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
+	0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61,
+	0x74, 0x65, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74,
+	0x65, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74,
+	0x65, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+	0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+	0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x68,
+	0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x73, 0x69,
+	0x7a, 0x65, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+	0x73, 0x75, 0x6d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+	0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x62,
+	0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a,
+	0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x62, 0x6c, 0x6f,
+	0x63, 0x6b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x64, 0x65,
+	0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x67, 0x7a, 0x69,
+	0x70, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65,
+	0x61, 0x64, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75,
+	0x6d, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+	0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x77, 0x69,
+	0x6e, 0x64, 0x6f, 0x77, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x6f, 0x66, 0x66, 0x73,
+	0x65, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+	0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x74, 0x68,
+	0x72, 0x65, 0x61, 0x64, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x74, 0x72, 0x61, 0x69,
+	0x6c, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x20,
+	0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x63, 0x68,
+	0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x77,
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x67, 0x7a,
+	0x69, 0x70, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x20,
+	0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b };
+
+uint8_t assorted_test_gzip_decompressed_data[ 2048 ];
+
+/* Tests the gzip_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_calculate_crc32(
+     void )
+{
+	uint8_t data[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_calculate_crc32(
+	          &checksum_value,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xcbf43926UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the CRC-32 in parts
+	 */
+	result = gzip_calculate_crc32(
+	          &checksum_value,
+	          data,
+	          4,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_calculate_crc32(
+	          &checksum_value,
+	          &( data[ 4 ] ),
+	          5,
+	          checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xcbf43926UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_calculate_crc32(
+	          NULL,
+	          data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_read_member_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_read_member_header(
+     void )
+{
+	uint8_t header_data[ 36 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	size_t member_size            = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_offset = 0;
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 22 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 296;
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 332 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 0;
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_bgzf_compressed_data,
+	          614,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 18 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 199 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+
+	result = gzip_read_member_header(
+	          NULL,
+	          524,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          NULL,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          9,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test name that is not terminated
+	 */
+	result = gzip_read_member_header(
+	          assorted_test_gzip_compressed_data,
+	          16,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test unsupported signature
+	 */
+	result = memory_copy(
+	          header_data,
+	          &( assorted_test_gzip_compressed_data[ 296 ] ),
+	          36 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	header_data[ 1 ] = 0x8c;
+
+	result = gzip_read_member_header(
+	          header_data,
+	          36,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test header checksum mismatch
+	 */
+	header_data[ 1 ]  = 0x8b;
+	header_data[ 22 ] = 'S';
+
+	result = gzip_read_member_header(
+	          header_data,
+	          36,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_read_member_footer function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_read_member_footer(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	uint32_t calculated_checksum  = 0;
+	uint32_t checksum             = 0;
+	uint32_t uncompressed_size    = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_calculate_crc32(
+	          &calculated_checksum,
+	          assorted_test_gzip_uncompressed_data,
+	          1000,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 288;
+
+	result = gzip_read_member_footer(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          &checksum,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 296 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 calculated_checksum );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_size",
+	 uncompressed_size,
+	 (uint32_t) 1000 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 520;
+
+	result = gzip_read_member_footer(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          &checksum,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset = 288;
+
+	result = gzip_read_member_footer(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          NULL,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_read_member_footer(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &compressed_data_offset,
+	          &checksum,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_decompress(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 1500 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_gzip_decompressed_data,
+	          assorted_test_gzip_uncompressed_data,
+	          1500 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_bgzf_compressed_data,
+	          614,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 1500 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_gzip_decompressed_data,
+	          assorted_test_gzip_uncompressed_data,
+	          1500 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the first member only
+	 */
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          296,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 1000 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_decompress(
+	          NULL,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = 1200;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test truncated member
+	 */
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          520,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test checksum mismatch
+	 */
+	assorted_test_gzip_compressed_data[ 288 ] ^= 0xff;
+
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_gzip_compressed_data[ 288 ] ^= 0xff;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed size mismatch
+	 */
+	assorted_test_gzip_compressed_data[ 292 ] ^= 0x01;
+
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_gzip_compressed_data[ 292 ] ^= 0x01;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test BGZF block size mismatch
+	 */
+	assorted_test_gzip_bgzf_compressed_data[ 16 ] ^= 0x01;
+
+	uncompressed_data_size = 2048;
+
+	result = gzip_decompress(
+	          assorted_test_gzip_bgzf_compressed_data,
+	          614,
+	          assorted_test_gzip_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_gzip_bgzf_compressed_data[ 16 ] ^= 0x01;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_member_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_member_index_initialize(
+     void )
+{
+	gzip_member_index_t *member_index = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_member_index_initialize(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "member_index",
+	 member_index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_member_index_free(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "member_index",
+	 member_index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_member_index_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	member_index = (gzip_member_index_t *) 0x12345678UL;
+
+	result = gzip_member_index_initialize(
+	          &member_index,
+	          &error );
+
+	member_index = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( member_index != NULL )
+	{
+		gzip_member_index_free(
+		 &member_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_member_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_member_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = gzip_member_index_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_member_index_build function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_member_index_build(
+     void )
+{
+	size_t bgzf_member_sizes[ 4 ] = { 199, 204, 183, 28 };
+
+	size64_t bgzf_uncompressed_sizes[ 4 ] = { 512, 512, 476, 0 };
+
+	gzip_member_index_t *member_index = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t compressed_offset        = 0;
+	uint64_t uncompressed_offset      = 0;
+	int member_index_value            = 0;
+	int result                        = 0;
+
+	result = gzip_member_index_initialize(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = gzip_member_index_build(
+	          member_index,
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "member_index->number_of_members",
+	 member_index->number_of_members,
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member_index->members[ 1 ].compressed_offset",
+	 member_index->members[ 1 ].compressed_offset,
+	 (uint64_t) 296 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member_index->members[ 1 ].uncompressed_offset",
+	 member_index->members[ 1 ].uncompressed_offset,
+	 (uint64_t) 1000 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member_index->members[ 2 ].uncompressed_offset",
+	 member_index->members[ 2 ].uncompressed_offset,
+	 (uint64_t) 1500 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member_index->compressed_data_size",
+	 member_index->compressed_data_size,
+	 (uint64_t) 524 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member_index->uncompressed_data_size",
+	 member_index->uncompressed_data_size,
+	 (uint64_t) 1500 );
+
+	result = gzip_member_index_build(
+	          member_index,
+	          assorted_test_gzip_bgzf_compressed_data,
+	          614,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "member_index->number_of_members",
+	 member_index->number_of_members,
+	 4 );
+
+	for( member_index_value = 0;
+	     member_index_value < 4;
+	     member_index_value++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "compressed_offset",
+		 member_index->members[ member_index_value ].compressed_offset,
+		 compressed_offset );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "compressed_size",
+		 member_index->members[ member_index_value ].compressed_size,
+		 (uint64_t) bgzf_member_sizes[ member_index_value ] );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "uncompressed_offset",
+		 member_index->members[ member_index_value ].uncompressed_offset,
+		 uncompressed_offset );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "uncompressed_size",
+		 member_index->members[ member_index_value ].uncompressed_size,
+		 bgzf_uncompressed_sizes[ member_index_value ] );
+
+		compressed_offset   += bgzf_member_sizes[ member_index_value ];
+		uncompressed_offset += bgzf_uncompressed_sizes[ member_index_value ];
+	}
+	/* Test error cases
+	 */
+	result = gzip_member_index_build(
+	          NULL,
+	          assorted_test_gzip_compressed_data,
+	          524,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test truncated member
+	 */
+	result = gzip_member_index_build(
+	          member_index,
+	          assorted_test_gzip_compressed_data,
+	          200,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "member_index->number_of_members",
+	 member_index->number_of_members,
+	 0 );
+
+	/* Test truncated BGZF member
+	 */
+	result = gzip_member_index_build(
+	          member_index,
+	          assorted_test_gzip_bgzf_compressed_data,
+	          600,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = gzip_member_index_free(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( member_index != NULL )
+	{
+		gzip_member_index_free(
+		 &member_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_GZIP_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "gzip_calculate_crc32",
+	 assorted_test_gzip_calculate_crc32 );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_read_member_header",
+	 assorted_test_gzip_read_member_header );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_read_member_footer",
+	 assorted_test_gzip_read_member_footer );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_decompress",
+	 assorted_test_gzip_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_member_index_initialize",
+	 assorted_test_gzip_member_index_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_member_index_free",
+	 assorted_test_gzip_member_index_free );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_member_index_build",
+	 assorted_test_gzip_member_index_build );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -732,6 +732,786 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the huffman_tree_get_symbol_from_bit_stream_canonical function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_get_symbol_from_bit_stream_canonical(
+     void )
+{
+	uint8_t code_size_array[ 318 ];
+
+	bit_stream_t *bit_stream     = NULL;
+	huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error     = NULL;
+	uint32_t symbol              = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_huffman_tree_data,
+	          2627,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_stream->byte_stream_offset = 2;
+
+	for( symbol = 0;
+	     symbol < 318;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size_array[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size_array[ symbol ] = 7;
+		}
+		else if( symbol < 288 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 5;
+		}
+	}
+	result = huffman_tree_initialize(
+	          &huffman_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	symbol = 0;
+
+	result = huffman_tree_get_symbol_from_bit_stream_canonical(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "symbol",
+	 symbol,
+	 (uint32_t) 141 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = huffman_tree_get_symbol_from_bit_stream_canonical(
+	          NULL,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = huffman_tree_get_symbol_from_bit_stream_canonical(
+	          huffman_tree,
+	          NULL,
+	          &symbol,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = huffman_tree_get_symbol_from_bit_stream_canonical(
+	          huffman_tree,
+	          bit_stream,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the huffman_tree_get_symbol_from_bit_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_get_symbol_from_bit_buffer(
+     void )
+{
+	uint8_t code_size_array[ 288 ];
+
+	bit_stream_t *bit_stream     = NULL;
+	huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error     = NULL;
+	uint32_t symbol              = 0;
+	uint8_t code_size            = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_huffman_tree_data,
+	          2627,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_stream->byte_stream_offset = 2;
+
+	result = bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( symbol = 0;
+	     symbol < 288;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size_array[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size_array[ symbol ] = 7;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 8;
+		}
+	}
+	result = huffman_tree_initialize(
+	          &huffman_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	symbol    = 0;
+	code_size = 0;
+
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          huffman_tree,
+	          bit_stream->bit_buffer,
+	          bit_stream->bit_buffer_size,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "symbol",
+	 symbol,
+	 (uint32_t) 141 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 (uint8_t) 8 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test insufficient bits
+	 */
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          huffman_tree,
+	          bit_stream->bit_buffer & 0x7f,
+	          7,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          NULL,
+	          bit_stream->bit_buffer,
+	          bit_stream->bit_buffer_size,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          huffman_tree,
+	          bit_stream->bit_buffer,
+	          65,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          huffman_tree,
+	          bit_stream->bit_buffer,
+	          bit_stream->bit_buffer_size,
+	          NULL,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = huffman_tree_get_symbol_from_bit_buffer(
+	          huffman_tree,
+	          bit_stream->bit_buffer,
+	          bit_stream->bit_buffer_size,
+	          &symbol,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests if the lookup table and the canonical Huffman code look up return the same symbols
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_lookup_table(
+     void )
+{
+	uint8_t code_size_array[ 288 ];
+
+	bit_stream_t *canonical_bit_stream = NULL;
+	bit_stream_t *lookup_bit_stream    = NULL;
+	huffman_tree_t *huffman_tree       = NULL;
+	libcerror_error_t *error           = NULL;
+	uint32_t canonical_symbol          = 0;
+	uint32_t lookup_symbol             = 0;
+	uint32_t symbol                    = 0;
+	int result                         = 0;
+	int symbol_index                   = 0;
+	int test_index                     = 0;
+
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		/* Initialize test
+		 */
+		for( symbol = 0;
+		     symbol < 288;
+		     symbol++ )
+		{
+			if( test_index == 0 )
+			{
+				/* Fixed Huffman code sizes that fit in the primary lookup table
+				 */
+				if( ( symbol < 144 )
+				 || ( ( symbol >= 280 ) && ( symbol < 288 ) ) )
+				{
+					code_size_array[ symbol ] = 8;
+				}
+				else if( symbol < 256 )
+				{
+					code_size_array[ symbol ] = 9;
+				}
+				else
+				{
+					code_size_array[ symbol ] = 7;
+				}
+			}
+			else
+			{
+				/* Code sizes of 1 - 15 that require sub tables
+				 */
+				if( symbol < 15 )
+				{
+					code_size_array[ symbol ] = (uint8_t) ( symbol + 1 );
+				}
+				else if( symbol == 15 )
+				{
+					code_size_array[ symbol ] = 15;
+				}
+				else
+				{
+					code_size_array[ symbol ] = 0;
+				}
+			}
+		}
+		result = huffman_tree_initialize(
+		          &huffman_tree,
+		          288,
+		          15,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "huffman_tree",
+		 huffman_tree );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = huffman_tree_build(
+		          huffman_tree,
+		          code_size_array,
+		          288,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "huffman_tree->lookup_table_bits",
+		 (int) huffman_tree->lookup_table_bits,
+		 0 );
+
+		result = bit_stream_initialize(
+		          &canonical_bit_stream,
+		          assorted_test_huffman_tree_data,
+		          2627,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = bit_stream_initialize(
+		          &lookup_bit_stream,
+		          assorted_test_huffman_tree_data,
+		          2627,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		canonical_bit_stream->byte_stream_offset = 2;
+		lookup_bit_stream->byte_stream_offset    = 2;
+
+		/* Test regular cases
+		 */
+		for( symbol_index = 0;
+		     symbol_index < 1024;
+		     symbol_index++ )
+		{
+			result = huffman_tree_get_symbol_from_bit_stream_canonical(
+			          huffman_tree,
+			          canonical_bit_stream,
+			          &canonical_symbol,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = huffman_tree_get_symbol_from_bit_stream(
+			          huffman_tree,
+			          lookup_bit_stream,
+			          &lookup_symbol,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "lookup_symbol",
+			 lookup_symbol,
+			 canonical_symbol );
+
+			/* The look up reads ahead hence compare the bit offsets
+			 */
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "lookup_bit_offset",
+			 ( lookup_bit_stream->byte_stream_offset * 8 ) - lookup_bit_stream->bit_buffer_size,
+			 ( canonical_bit_stream->byte_stream_offset * 8 ) - canonical_bit_stream->bit_buffer_size );
+		}
+		/* Clean up
+		 */
+		result = bit_stream_free(
+		          &lookup_bit_stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = bit_stream_free(
+		          &canonical_bit_stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = huffman_tree_free(
+		          &huffman_tree,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lookup_bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &lookup_bit_stream,
+		 NULL );
+	}
+	if( canonical_bit_stream != NULL )
+	{
+		bit_stream_free(
+		 &canonical_bit_stream,
+		 NULL );
+	}
+	if( huffman_tree != NULL )
+	{
+		huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -773,6 +1553,18 @@ int main(
 	 "huffman_tree_get_symbol_from_bit_stream",
 	 assorted_test_huffman_tree_get_symbol_from_bit_stream );
 
+	ASSORTED_TEST_RUN(
+	 "huffman_tree_get_symbol_from_bit_stream_canonical",
+	 assorted_test_huffman_tree_get_symbol_from_bit_stream_canonical );
+
+	ASSORTED_TEST_RUN(
+	 "huffman_tree_get_symbol_from_bit_buffer",
+	 assorted_test_huffman_tree_get_symbol_from_bit_buffer );
+
+	ASSORTED_TEST_RUN(
+	 "huffman_tree_lookup_table",
+	 assorted_test_huffman_tree_lookup_table );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_test_data.h"
 #include "assorted_test_libcerror.h"
 #include "assorted_test_libcnotify.h"
 #include "assorted_test_macros.h"
@@ -39,51 +40,711 @@
 #define ASSORTED_TEST_LZFU_VERBOSE
  */
 
+#define ASSORTED_TEST_LZFU_DATA_SIZE	16384
+
 uint8_t assorted_test_lzfu_compressed_data[ 16 ] = {
 	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
 
-#if defined( __GNUC__ )
+uint8_t assorted_test_lzfu_rtf_data[ 43 ] = {
+	0x7b, 0x5c, 0x72, 0x74, 0x66, 0x31, 0x5c, 0x61, 0x6e, 0x73, 0x69, 0x5c, 0x61, 0x6e, 0x73, 0x69,
+	0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x32, 0x5c, 0x70, 0x61, 0x72, 0x64, 0x20, 0x68, 0x65, 0x6c,
+	0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x7d, 0x0d, 0x0a };
+
+/* The compressed RTF data from the compressed RTF specification
+ */
+uint8_t assorted_test_lzfu_rtf_compressed_data[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xf1, 0xc5, 0xc7, 0xa7,
+	0x03, 0x00, 0x0a, 0x00, 0x72, 0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x42, 0x32, 0x0a, 0xf3, 0x20,
+	0x68, 0x65, 0x6c, 0x09, 0x00, 0x20, 0x62, 0x77, 0x05, 0xb0, 0x6c, 0x64, 0x7d, 0x0a, 0x80, 0x0f,
+	0xa0 };
+
+/* The sizes of the messages used to test batch decompression, which include
+ * messages for which the write position in the lz buffer does and does not wrap around
+ */
+size_t assorted_test_lzfu_message_sizes[ 8 ] = {
+	1, 43, 200, 3888, 3889, 4500, 3000, 700 };
+
+uint8_t assorted_test_lzfu_uncompressed_data[ ASSORTED_TEST_LZFU_DATA_SIZE ];
+
+uint8_t assorted_test_lzfu_compressed_data_buffer[ ASSORTED_TEST_LZFU_DATA_SIZE + 4096 ];
+
+/* The decompressed data contains 2 trailing bytes of the end of stream reference
+ */
+uint8_t assorted_test_lzfu_decompressed_data[ ASSORTED_TEST_LZFU_DATA_SIZE + 2 ];
+
+/* Fills the uncompressed test data with literals and matches with distances beyond
+ * the size of the lz buffer and overwrites parts of it with parts of the RTF dictionary
+ */
+void assorted_test_lzfu_generate_data(
+      void )
+{
+	size_t data_offset       = 0;
+	size_t dictionary_offset = 0;
+	size_t match_size        = 0;
+	uint32_t random_number   = 0x87654321UL;
+
+	assorted_test_data_generate(
+	 assorted_test_lzfu_uncompressed_data,
+	 ASSORTED_TEST_LZFU_DATA_SIZE,
+	 0x12345678UL,
+	 8192,
+	 33 );
+
+	while( data_offset < ASSORTED_TEST_LZFU_DATA_SIZE )
+	{
+		random_number = ( random_number * 1103515245UL ) + 12345UL;
+
+		data_offset      += 16 + ( ( random_number >> 16 ) & 0xff );
+		match_size        = 4 + ( ( random_number >> 24 ) & 0x0f );
+		dictionary_offset = ( random_number >> 8 ) % ( LZFU_DICTIONARY_SIZE - match_size );
+
+		while( ( match_size > 0 )
+		    && ( data_offset < ASSORTED_TEST_LZFU_DATA_SIZE ) )
+		{
+			assorted_test_lzfu_uncompressed_data[ data_offset++ ] = (uint8_t) lzfu_rtf_dictionary[ dictionary_offset++ ];
+
+			match_size--;
+		}
+	}
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the lzfu_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_read_header(
+     void )
+{
+	lzfu_header_t lzfu_header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfu_read_header(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          49,
+	          &lzfu_header,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "lzfu_header.compressed_data_size",
+	 lzfu_header.compressed_data_size,
+	 (uint32_t) 33 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "lzfu_header.uncompressed_data_size",
+	 lzfu_header.uncompressed_data_size,
+	 (uint32_t) 43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "lzfu_header.crc",
+	 lzfu_header.crc,
+	 (uint32_t) 0xa7c7c5f1UL );
+
+	/* Test error cases
+	 */
+	result = lzfu_read_header(
+	          NULL,
+	          49,
+	          &lzfu_header,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_read_header(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          8,
+	          &lzfu_header,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_read_header(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          49,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data size in header exceeding the compressed data
+	 */
+	result = lzfu_read_header(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          48,
+	          &lzfu_header,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test unsupported signature
+	 */
+	result = lzfu_read_header(
+	          assorted_test_lzfu_compressed_data,
+	          16,
+	          &lzfu_header,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfu_restore_lz_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_restore_lz_buffer(
+     void )
+{
+	uint8_t initialized_lz_buffer[ LZFU_LZ_BUFFER_SIZE ];
+	uint8_t lz_buffer[ LZFU_LZ_BUFFER_SIZE ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+	int size_index                = 0;
+
+	result = lzfu_initialize_lz_buffer(
+	          initialized_lz_buffer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lzfu_initialize_lz_buffer(
+	          lz_buffer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( size_index = 0;
+	     size_index < 8;
+	     size_index++ )
+	{
+		compressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 4096;
+
+		result = lzfu_compress(
+		          assorted_test_lzfu_uncompressed_data,
+		          assorted_test_lzfu_message_sizes[ size_index ],
+		          assorted_test_lzfu_compressed_data_buffer,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 2;
+
+		result = lzfu_decompress_with_lz_buffer(
+		          lz_buffer,
+		          &( assorted_test_lzfu_compressed_data_buffer[ 16 ] ),
+		          compressed_data_size - 16,
+		          assorted_test_lzfu_decompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = lzfu_restore_lz_buffer(
+		          lz_buffer,
+		          uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          lz_buffer,
+		          initialized_lz_buffer,
+		          LZFU_LZ_BUFFER_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = lzfu_restore_lz_buffer(
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfu_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_get_uncompressed_data_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+/* TODO add representative test data
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data,
+	          16,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 18 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+*/
+
+	/* Test error cases
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          NULL,
+	          16,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data,
+	          16,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data that is smaller than the compressed data size in the header
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          40,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the lzfu_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_compress(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 4096;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compressed_data_size",
+	 (uint64_t) compressed_data_size,
+	 (uint64_t) ASSORTED_TEST_LZFU_DATA_SIZE );
+
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data_buffer,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_LZFU_DATA_SIZE + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data_buffer,
+	          compressed_data_size,
+	          assorted_test_lzfu_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_LZFU_DATA_SIZE + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_lzfu_decompressed_data,
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test RTF data with matches in the RTF dictionary
+	 */
+	compressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 4096;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_rtf_data,
+	          43,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 50 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 45;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data_buffer,
+	          compressed_data_size,
+	          assorted_test_lzfu_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_lzfu_decompressed_data,
+	          assorted_test_lzfu_rtf_data,
+	          43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test empty uncompressed data
+	 */
+	compressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 4096;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          0,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 19 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = ASSORTED_TEST_LZFU_DATA_SIZE + 4096;
+
+	result = lzfu_compress(
+	          NULL,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the lzfu_get_uncompressed_data_size function
- * Returns 1 if successful or 0 if not
- */
-int assorted_test_lzfu_get_uncompressed_data_size(
-     void )
-{
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-/* TODO add representative test data
-	result = lzfu_get_uncompressed_data_size(
-	          assorted_test_lzfu_compressed_data,
-	          16,
-	          &uncompressed_data_size,
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          NULL,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 18 );
+	 -1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
-*/
 
-	/* Test error cases
-	 */
-	result = lzfu_get_uncompressed_data_size(
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          assorted_test_lzfu_compressed_data_buffer,
 	          NULL,
-	          16,
-	          &uncompressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -98,10 +759,13 @@ int assorted_test_lzfu_get_uncompressed_data_size(
 	libcerror_error_free(
 	 &error );
 
-	result = lzfu_get_uncompressed_data_size(
-	          assorted_test_lzfu_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	compressed_data_size = 8;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -116,10 +780,13 @@ int assorted_test_lzfu_get_uncompressed_data_size(
 	libcerror_error_free(
 	 &error );
 
-	result = lzfu_get_uncompressed_data_size(
-	          assorted_test_lzfu_compressed_data,
-	          16,
-	          NULL,
+	compressed_data_size = 64;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          ASSORTED_TEST_LZFU_DATA_SIZE,
+	          assorted_test_lzfu_compressed_data_buffer,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -137,6 +804,11 @@ int assorted_test_lzfu_get_uncompressed_data_size(
 	return( 1 );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
 	return( 0 );
 }
 
@@ -146,7 +818,8 @@ on_error:
 int assorted_test_lzfu_decompress(
      void )
 {
-	uint8_t uncompressed_data[ 16 ];
+	uint8_t compressed_data[ 49 ];
+	uint8_t uncompressed_data[ 64 ];
 
 	libcerror_error_t *error      = NULL;
 	size_t uncompressed_data_size = 0;
@@ -280,9 +953,354 @@ int assorted_test_lzfu_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Test compressed data that is smaller than the compressed data size in the header
+	 */
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          40,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_rtf_compressed_data,
+	          8,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data size in the header that exceeds the compressed data
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          assorted_test_lzfu_rtf_compressed_data,
+	          49 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data[ 0 ] = 0xff;
+	compressed_data[ 1 ] = 0xff;
+
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          compressed_data,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data size in the header that is smaller than the header
+	 */
+	compressed_data[ 0 ] = 0x04;
+	compressed_data[ 1 ] = 0x00;
+
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          compressed_data,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the lzfu_decompress_messages function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_decompress_messages(
+     void )
+{
+	lzfu_message_t messages[ 8 ];
+
+	int numbers_of_threads[ 3 ] = { 1, 3, 8 };
+
+	libcerror_error_t *error        = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	int message_index               = 0;
+	int number_of_threads_index     = 0;
+	int result                      = 0;
+
+	/* Compress consecutive parts of the uncompressed test data as messages
+	 */
+	for( message_index = 0;
+	     message_index < 8;
+	     message_index++ )
+	{
+		compressed_data_size = ( ASSORTED_TEST_LZFU_DATA_SIZE + 4096 ) - compressed_data_offset;
+
+		result = lzfu_compress(
+		          &( assorted_test_lzfu_uncompressed_data[ uncompressed_data_offset ] ),
+		          assorted_test_lzfu_message_sizes[ message_index ],
+		          &( assorted_test_lzfu_compressed_data_buffer[ compressed_data_offset ] ),
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		messages[ message_index ].compressed_data      = &( assorted_test_lzfu_compressed_data_buffer[ compressed_data_offset ] );
+		messages[ message_index ].compressed_data_size = compressed_data_size;
+
+		compressed_data_offset   += compressed_data_size;
+		uncompressed_data_offset += assorted_test_lzfu_message_sizes[ message_index ];
+	}
+	/* Test regular cases
+	 */
+	for( number_of_threads_index = 0;
+	     number_of_threads_index < 3;
+	     number_of_threads_index++ )
+	{
+		/* The uncompressed data of every message contains 2 trailing bytes
+		 */
+		uncompressed_data_offset = 0;
+
+		for( message_index = 0;
+		     message_index < 8;
+		     message_index++ )
+		{
+			messages[ message_index ].uncompressed_data      = &( assorted_test_lzfu_decompressed_data[ uncompressed_data_offset + ( 2 * message_index ) ] );
+			messages[ message_index ].uncompressed_data_size = assorted_test_lzfu_message_sizes[ message_index ] + 2;
+
+			uncompressed_data_offset += assorted_test_lzfu_message_sizes[ message_index ];
+		}
+		result = lzfu_decompress_messages(
+		          messages,
+		          8,
+		          numbers_of_threads[ number_of_threads_index ],
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_offset = 0;
+
+		for( message_index = 0;
+		     message_index < 8;
+		     message_index++ )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "messages[ message_index ].uncompressed_data_size",
+			 messages[ message_index ].uncompressed_data_size,
+			 assorted_test_lzfu_message_sizes[ message_index ] + 2 );
+
+			result = memory_compare(
+			          messages[ message_index ].uncompressed_data,
+			          &( assorted_test_lzfu_uncompressed_data[ uncompressed_data_offset ] ),
+			          assorted_test_lzfu_message_sizes[ message_index ] );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			uncompressed_data_offset += assorted_test_lzfu_message_sizes[ message_index ];
+		}
+	}
+	/* Test error cases
+	 */
+	result = lzfu_decompress_messages(
+	          NULL,
+	          8,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_decompress_messages(
+	          messages,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_decompress_messages(
+	          messages,
+	          8,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_decompress_messages(
+	          messages,
+	          8,
+	          LZFU_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test CRC mismatch in one of the messages
+	 */
+	compressed_data_offset = (size_t) ( messages[ 5 ].compressed_data - assorted_test_lzfu_compressed_data_buffer ) + 20;
+
+	assorted_test_lzfu_compressed_data_buffer[ compressed_data_offset ] ^= 0xff;
+
+	result = lzfu_decompress_messages(
+	          messages,
+	          8,
+	          1,
+	          &error );
+
+	assorted_test_lzfu_compressed_data_buffer[ compressed_data_offset ] ^= 0xff;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small in one of the messages
+	 */
+	messages[ 3 ].uncompressed_data_size = 16;
+
+	result = lzfu_decompress_messages(
+	          messages,
+	          8,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
 	return( 0 );
 }
 
@@ -313,16 +1331,32 @@ int main(
 
 #if defined( __GNUC__ )
 
+	assorted_test_lzfu_generate_data();
+
+	ASSORTED_TEST_RUN(
+	 "lzfu_read_header",
+	 assorted_test_lzfu_read_header );
+
+	ASSORTED_TEST_RUN(
+	 "lzfu_restore_lz_buffer",
+	 assorted_test_lzfu_restore_lz_buffer );
+
 	ASSORTED_TEST_RUN(
 	 "lzfu_get_uncompressed_data_size",
 	 assorted_test_lzfu_get_uncompressed_data_size );
 
-	/* TODO add tests for lzfu_compress */
+	ASSORTED_TEST_RUN(
+	 "lzfu_compress",
+	 assorted_test_lzfu_compress );
 
 	ASSORTED_TEST_RUN(
 	 "lzfu_decompress",
 	 assorted_test_lzfu_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "lzfu_decompress_messages",
+	 assorted_test_lzfu_decompress_messages );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_test_data.h"
 #include "assorted_test_libcerror.h"
 #include "assorted_test_libcnotify.h"
 #include "assorted_test_macros.h"
@@ -39,9 +40,24 @@
 #define ASSORTED_TEST_LZVN_VERBOSE
  */
 
+#define ASSORTED_TEST_LZVN_DATA_SIZE	131072
+
 uint8_t assorted_test_lzvn_compressed_data[ 16 ] = {
 	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
 
+/* The LZVN compressed data of "abcdefabcdefab" that consists of a literal oppcode,
+ * a small distance oppcode and the end of stream oppcode
+ */
+uint8_t assorted_test_lzvn_compressed_byte_stream[ 17 ] = {
+	0xe6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x28, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00 };
+
+uint8_t assorted_test_lzvn_uncompressed_data[ ASSORTED_TEST_LZVN_DATA_SIZE ];
+
+uint8_t assorted_test_lzvn_compressed_data_buffer[ ASSORTED_TEST_LZVN_DATA_SIZE + 4096 ];
+
+uint8_t assorted_test_lzvn_decompressed_data[ ASSORTED_TEST_LZVN_DATA_SIZE ];
+
 #if defined( __GNUC__ )
 
 /* Tests the lzvn_decompress function
@@ -58,12 +74,11 @@ int assorted_test_lzvn_decompress(
 
 	/* Test regular cases
 	 */
-/* TODO add representative test data
 	uncompressed_data_size = 16;
 
 	result = lzvn_decompress(
-	          assorted_test_lzvn_compressed_data,
-	          16,
+	          assorted_test_lzvn_compressed_byte_stream,
+	          17,
 	          uncompressed_data,
 	          &uncompressed_data_size,
 	          &error );
@@ -76,12 +91,21 @@ int assorted_test_lzvn_decompress(
 	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
 	 "uncompressed_data_size",
 	 uncompressed_data_size,
-	 (size_t) 18 );
+	 (size_t) 14 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-*/
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abcdefabcdefab",
+	          14 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
@@ -190,36 +214,962 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) */
-
-/* The main program
+/* Tests the lzvn_write_literals function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#endif
+int assorted_test_lzvn_write_literals(
+     void )
 {
-	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
-	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t compressed_data[ 512 ];
 
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZVN_VERBOSE )
-	libcnotify_verbose_set(
+	uint8_t expected_compressed_data[ 6 ] = {
+		0xe5, 0x61, 0x62, 0x63, 0x64, 0x65 };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_offset = 0;
+
+	result = lzvn_write_literals(
+	          compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-#endif
 
-#if defined( __GNUC__ )
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 6 );
 
-	ASSORTED_TEST_RUN(
-	 "lzvn_decompress",
-	 assorted_test_lzvn_decompress );
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          expected_compressed_data,
+	          6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test literals that are split into a large literal oppcode of 271 bytes and one of 29 bytes
+	 */
+	compressed_data_offset = 0;
+
+	result = lzvn_write_literals(
+	          compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_uncompressed_data,
+	          300,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 304 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 0xe0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 1 ]",
+	 compressed_data[ 1 ],
+	 0xff );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 273 ]",
+	 compressed_data[ 273 ],
+	 0xe0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 274 ]",
+	 compressed_data[ 274 ],
+	 0x0d );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+
+	result = lzvn_write_literals(
+	          NULL,
+	          512,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_write_literals(
+	          compressed_data,
+	          512,
+	          NULL,
+	          (uint8_t *) "abcde",
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_write_literals(
+	          compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          NULL,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	result = lzvn_write_literals(
+	          compressed_data,
+	          5,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_write_match function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_write_match(
+     void )
+{
+	uint8_t compressed_data[ 64 ];
+
+	/* The literal sizes, match sizes, match distances and expected compressed data
+	 * of a small distance, previous distance, match, medium distance, large distance
+	 * and literal oppcode sequence
+	 */
+	size_t literal_sizes[ 6 ] = { 2, 1, 0, 0, 3, 5 };
+
+	uint16_t match_sizes[ 6 ] = { 4, 5, 20, 7, 12, 3 };
+
+	uint16_t match_distances[ 6 ] = { 100, 100, 100, 5000, 40000, 2 };
+
+	size_t expected_compressed_data_sizes[ 6 ] = { 4, 2, 2, 3, 7, 8 };
+
+	uint8_t expected_compressed_data[ 6 ][ 8 ] = {
+		{ 0x88, 0x64, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00 },
+		{ 0x56, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0xf0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0xa1, 0x20, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		{ 0xcf, 0x40, 0x9c, 0x61, 0x62, 0x63, 0xf8, 0x00 },
+		{ 0xe4, 0x61, 0x62, 0x63, 0x64, 0x40, 0x02, 0x65 } };
+
+	libcerror_error_t *error         = NULL;
+	size_t compressed_data_offset    = 0;
+	uint16_t previous_match_distance = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 6;
+	     test_index++ )
+	{
+		compressed_data_offset = 0;
+
+		result = lzvn_write_match(
+		          compressed_data,
+		          64,
+		          &compressed_data_offset,
+		          (uint8_t *) "abcde",
+		          literal_sizes[ test_index ],
+		          match_sizes[ test_index ],
+		          match_distances[ test_index ],
+		          &previous_match_distance,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "compressed_data_offset",
+		 compressed_data_offset,
+		 expected_compressed_data_sizes[ test_index ] );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+		 "previous_match_distance",
+		 previous_match_distance,
+		 match_distances[ test_index ] );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          compressed_data,
+		          expected_compressed_data[ test_index ],
+		          expected_compressed_data_sizes[ test_index ] );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+
+	result = lzvn_write_match(
+	          NULL,
+	          64,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          2,
+	          4,
+	          100,
+	          &previous_match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_write_match(
+	          compressed_data,
+	          64,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          2,
+	          2,
+	          100,
+	          &previous_match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_write_match(
+	          compressed_data,
+	          64,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          2,
+	          4,
+	          0,
+	          &previous_match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_write_match(
+	          compressed_data,
+	          64,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          2,
+	          4,
+	          100,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	previous_match_distance = 0;
+
+	result = lzvn_write_match(
+	          compressed_data,
+	          3,
+	          &compressed_data_offset,
+	          (uint8_t *) "abcde",
+	          2,
+	          4,
+	          100,
+	          &previous_match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_compress(
+     void )
+{
+	int compression_levels[ 3 ] = { -1, LZVN_COMPRESSION_LEVEL_FAST, LZVN_COMPRESSION_LEVEL_LAZY };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int compression_level_index   = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 3;
+	     compression_level_index++ )
+	{
+		compressed_data_size = ASSORTED_TEST_LZVN_DATA_SIZE + 4096;
+
+		result = lzvn_compress(
+		          assorted_test_lzvn_uncompressed_data,
+		          ASSORTED_TEST_LZVN_DATA_SIZE,
+		          compression_levels[ compression_level_index ],
+		          assorted_test_lzvn_compressed_data_buffer,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "compressed_data_size",
+		 (uint64_t) compressed_data_size,
+		 (uint64_t) ASSORTED_TEST_LZVN_DATA_SIZE );
+
+		uncompressed_data_size = ASSORTED_TEST_LZVN_DATA_SIZE;
+
+		result = lzvn_decompress(
+		          assorted_test_lzvn_compressed_data_buffer,
+		          compressed_data_size,
+		          assorted_test_lzvn_decompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_LZVN_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          assorted_test_lzvn_decompressed_data,
+		          assorted_test_lzvn_uncompressed_data,
+		          ASSORTED_TEST_LZVN_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test empty uncompressed data
+	 */
+	compressed_data_size = ASSORTED_TEST_LZVN_DATA_SIZE + 4096;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          0,
+	          LZVN_COMPRESSION_LEVEL_FAST,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 8 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = ASSORTED_TEST_LZVN_DATA_SIZE + 4096;
+
+	result = lzvn_compress(
+	          NULL,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          LZVN_COMPRESSION_LEVEL_FAST,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          3,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          LZVN_COMPRESSION_LEVEL_FAST,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          LZVN_COMPRESSION_LEVEL_FAST,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 1024;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          LZVN_COMPRESSION_LEVEL_FAST,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_decompress_fast function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_decompress_fast(
+     void )
+{
+	uint8_t invalid_compressed_data[ 512 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	uint16_t distance               = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = ASSORTED_TEST_LZVN_DATA_SIZE + 4096;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          LZVN_COMPRESSION_LEVEL_LAZY,
+	          assorted_test_lzvn_compressed_data_buffer,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lzvn_decompress_fast(
+	          assorted_test_lzvn_compressed_data_buffer,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "uncompressed_data_offset",
+	 (int) uncompressed_data_offset,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "uncompressed_data_offset",
+	 (uint64_t) uncompressed_data_offset,
+	 (uint64_t) ASSORTED_TEST_LZVN_DATA_SIZE );
+
+	result = memory_compare(
+	          assorted_test_lzvn_decompressed_data,
+	          assorted_test_lzvn_uncompressed_data,
+	          uncompressed_data_offset );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that no oppcodes are decoded within the margin
+	 */
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+	distance                 = 0;
+
+	result = lzvn_decompress_fast(
+	          assorted_test_lzvn_compressed_byte_stream,
+	          17,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = memory_set(
+	          invalid_compressed_data,
+	          0x70,
+	          512 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = lzvn_decompress_fast(
+	          invalid_compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = lzvn_decompress_fast(
+	          NULL,
+	          512,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_decompress_fast(
+	          invalid_compressed_data,
+	          512,
+	          NULL,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_decompress_fast(
+	          invalid_compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          NULL,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_decompress_fast(
+	          invalid_compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          NULL,
+	          &distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_decompress_fast(
+	          invalid_compressed_data,
+	          512,
+	          &compressed_data_offset,
+	          assorted_test_lzvn_decompressed_data,
+	          ASSORTED_TEST_LZVN_DATA_SIZE,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZVN_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	assorted_test_data_generate(
+	 assorted_test_lzvn_uncompressed_data,
+	 ASSORTED_TEST_LZVN_DATA_SIZE,
+	 0x12345678UL,
+	 65536,
+	 578 );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_decompress",
+	 assorted_test_lzvn_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_write_literals",
+	 assorted_test_lzvn_write_literals );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_write_match",
+	 assorted_test_lzvn_write_match );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_compress",
+	 assorted_test_lzvn_compress );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_decompress_fast",
+	 assorted_test_lzvn_decompress_fast );
 
 #endif /* defined( __GNUC__ ) */
 
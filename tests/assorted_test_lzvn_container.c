@@ -0,0 +1,1360 @@
+/*
+ * LZFSE container and chunked LZVN decompression testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/lzvn_container.h"
+
+/* Define to make assorted_test_lzvn_container generate verbose output
+#define ASSORTED_TEST_LZVN_CONTAINER_VERBOSE
+ */
+
+/* The LZFSE container of "xyzabcdefabcdefab" that consists of an uncompressed block
+ * of "xyz", a LZVN compressed block of "abcdefabcdefab" and the end of stream block
+ */
+uint8_t assorted_test_lzvn_container_compressed_data[ 44 ] = {
+	'b', 'v', 'x', '-', 0x03, 0x00, 0x00, 0x00, 'x', 'y', 'z',
+	'b', 'v', 'x', 'n', 0x0e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0xe6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x28, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+	'b', 'v', 'x', '$' };
+
+/* The chunked LZVN compressed data of "xyzabcdefabcdefab" that consists of a chunk table,
+ * an uncompressed chunk of "xyz" and a LZVN compressed chunk of "abcdefabcdefab"
+ */
+uint8_t assorted_test_lzvn_container_chunked_data[ 33 ] = {
+	0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x06, 'x', 'y', 'z',
+	0xe6, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x28, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00 };
+
+#if defined( __GNUC__ )
+
+/* Tests the lzvn_container_read_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_read_block_header(
+     void )
+{
+	uint8_t lzfse_block_header[ 12 ] = {
+		'b', 'v', 'x', '2', 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error         = NULL;
+	size_t block_header_size         = 0;
+	uint32_t compressed_block_size   = 0;
+	uint32_t uncompressed_block_size = 0;
+	uint8_t block_type               = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) LZVN_CONTAINER_BLOCK_TYPE_UNCOMPRESSED );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_header_size",
+	 block_header_size,
+	 (size_t) 8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_block_size",
+	 uncompressed_block_size,
+	 (uint32_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "compressed_block_size",
+	 compressed_block_size,
+	 (uint32_t) 0 );
+
+	result = lzvn_container_read_block_header(
+	          &( assorted_test_lzvn_container_compressed_data[ 11 ] ),
+	          33,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) LZVN_CONTAINER_BLOCK_TYPE_LZVN );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_header_size",
+	 block_header_size,
+	 (size_t) 12 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_block_size",
+	 uncompressed_block_size,
+	 (uint32_t) 14 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "compressed_block_size",
+	 compressed_block_size,
+	 (uint32_t) 17 );
+
+	result = lzvn_container_read_block_header(
+	          &( assorted_test_lzvn_container_compressed_data[ 40 ] ),
+	          4,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) LZVN_CONTAINER_BLOCK_TYPE_END_OF_STREAM );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_header_size",
+	 block_header_size,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = lzvn_container_read_block_header(
+	          NULL,
+	          44,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          NULL,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          &block_type,
+	          NULL,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          &block_type,
+	          &block_header_size,
+	          NULL,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block header is truncated
+	 */
+	result = lzvn_container_read_block_header(
+	          &( assorted_test_lzvn_container_compressed_data[ 11 ] ),
+	          8,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is LZFSE compressed
+	 */
+	result = lzvn_container_read_block_header(
+	          lzfse_block_header,
+	          12,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block signature is not supported
+	 */
+	result = lzvn_container_read_block_header(
+	          assorted_test_lzvn_container_chunked_data,
+	          33,
+	          &block_type,
+	          &block_header_size,
+	          &uncompressed_block_size,
+	          &compressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_container_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 32 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 32;
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 17 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "xyzabcdefabcdefab",
+	          17 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 32;
+
+	result = lzvn_container_decompress(
+	          NULL,
+	          44,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = (size_t) SSIZE_MAX + 1;
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	uncompressed_data_size = 16;
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          44,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the end of stream block is missing
+	 */
+	uncompressed_data_size = 32;
+
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          40,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a compressed block is truncated
+	 */
+	result = lzvn_container_decompress(
+	          assorted_test_lzvn_container_compressed_data,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_container_get_number_of_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_get_number_of_chunks(
+     void )
+{
+	uint8_t invalid_chunk_table_data[ 4 ] = {
+		0x06, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	int number_of_chunks     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzvn_container_get_number_of_chunks(
+	          assorted_test_lzvn_container_chunked_data,
+	          4,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = lzvn_container_get_number_of_chunks(
+	          NULL,
+	          4,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_number_of_chunks(
+	          assorted_test_lzvn_container_chunked_data,
+	          3,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_number_of_chunks(
+	          assorted_test_lzvn_container_chunked_data,
+	          4,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the first chunk offset is invalid
+	 */
+	result = lzvn_container_get_number_of_chunks(
+	          invalid_chunk_table_data,
+	          4,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_container_get_chunk_range function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_get_chunk_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t chunk_offset    = 0;
+	uint32_t chunk_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          0,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_offset",
+	 chunk_offset,
+	 (uint32_t) 12 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_size",
+	 chunk_size,
+	 (uint32_t) 4 );
+
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          1,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_offset",
+	 chunk_offset,
+	 (uint32_t) 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_size",
+	 chunk_size,
+	 (uint32_t) 17 );
+
+	/* Test error cases
+	 */
+	result = lzvn_container_get_chunk_range(
+	          NULL,
+	          12,
+	          0,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          -1,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          2,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          0,
+	          NULL,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          12,
+	          0,
+	          &chunk_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the chunk table is truncated
+	 */
+	result = lzvn_container_get_chunk_range(
+	          assorted_test_lzvn_container_chunked_data,
+	          8,
+	          1,
+	          &chunk_offset,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_container_decompress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_decompress_chunk(
+     void )
+{
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 16;
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 12 ] ),
+	          4,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "xyz",
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 16;
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 16 ] ),
+	          17,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 14 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abcdefabcdefab",
+	          14 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 16;
+
+	result = lzvn_container_decompress_chunk(
+	          NULL,
+	          4,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 12 ] ),
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 12 ] ),
+	          4,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 12 ] ),
+	          4,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	uncompressed_data_size = 2;
+
+	result = lzvn_container_decompress_chunk(
+	          &( assorted_test_lzvn_container_chunked_data[ 12 ] ),
+	          4,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzvn_container_decompress_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_container_decompress_chunks(
+     void )
+{
+	lzvn_container_chunk_t chunks[ 2 ];
+	uint8_t uncompressed_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		chunks[ 0 ].compressed_data        = &( assorted_test_lzvn_container_chunked_data[ 12 ] );
+		chunks[ 0 ].compressed_data_size   = 4;
+		chunks[ 0 ].uncompressed_data      = uncompressed_data;
+		chunks[ 0 ].uncompressed_data_size = 16;
+		chunks[ 1 ].compressed_data        = &( assorted_test_lzvn_container_chunked_data[ 16 ] );
+		chunks[ 1 ].compressed_data_size   = 17;
+		chunks[ 1 ].uncompressed_data      = &( uncompressed_data[ 16 ] );
+		chunks[ 1 ].uncompressed_data_size = 16;
+
+		result = lzvn_container_decompress_chunks(
+		          chunks,
+		          2,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "chunks[ 0 ].uncompressed_data_size",
+		 chunks[ 0 ].uncompressed_data_size,
+		 (size_t) 3 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "chunks[ 1 ].uncompressed_data_size",
+		 chunks[ 1 ].uncompressed_data_size,
+		 (size_t) 14 );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          "xyz",
+		          3 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( uncompressed_data[ 16 ] ),
+		          "abcdefabcdefab",
+		          14 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = lzvn_container_decompress_chunks(
+	          NULL,
+	          2,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress_chunks(
+	          chunks,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_container_decompress_chunks(
+	          chunks,
+	          2,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a chunk cannot be decompressed
+	 */
+	chunks[ 0 ].uncompressed_data_size = 16;
+	chunks[ 1 ].compressed_data        = assorted_test_lzvn_container_chunked_data;
+	chunks[ 1 ].compressed_data_size   = 12;
+	chunks[ 1 ].uncompressed_data_size = 16;
+
+	result = lzvn_container_decompress_chunks(
+	          chunks,
+	          2,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZVN_CONTAINER_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_read_block_header",
+	 assorted_test_lzvn_container_read_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_decompress",
+	 assorted_test_lzvn_container_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_get_number_of_chunks",
+	 assorted_test_lzvn_container_get_number_of_chunks );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_get_chunk_range",
+	 assorted_test_lzvn_container_get_chunk_range );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_decompress_chunk",
+	 assorted_test_lzvn_container_decompress_chunk );
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_container_decompress_chunks",
+	 assorted_test_lzvn_container_decompress_chunks );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
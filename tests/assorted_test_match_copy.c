@@ -0,0 +1,299 @@
+/*
+ * Overlapping match copy testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/match_copy.h"
+
+/* Define to make assorted_test_match_copy generate verbose output
+#define ASSORTED_TEST_MATCH_COPY_VERBOSE
+ */
+
+/* Tests the match_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_match_copy(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t expected_buffer[ 512 ];
+
+	size_t slack_sizes[ 5 ]  = { 0, 1, 31, 32, 100 };
+
+	libcerror_error_t *error = NULL;
+	size_t buffer_index      = 0;
+	size_t buffer_size       = 0;
+	size_t distance          = 0;
+	size_t size              = 0;
+	uint32_t random_number   = 0x12345678UL;
+	int result               = 0;
+	int slack_sizes_index    = 0;
+
+	/* Test regular cases
+	 */
+	for( distance = 1;
+	     distance <= 64;
+	     distance++ )
+	{
+		for( size = 0;
+		     size <= 258;
+		     size++ )
+		{
+			for( slack_sizes_index = 0;
+			     slack_sizes_index < 5;
+			     slack_sizes_index++ )
+			{
+				buffer_size = 64 + size + slack_sizes[ slack_sizes_index ];
+
+				for( buffer_index = 0;
+				     buffer_index < 512;
+				     buffer_index++ )
+				{
+					random_number = ( random_number * 1103515245UL ) + 12345UL;
+
+					buffer[ buffer_index ]          = (uint8_t) ( random_number >> 16 );
+					expected_buffer[ buffer_index ] = buffer[ buffer_index ];
+				}
+				for( buffer_index = 64;
+				     buffer_index < 64 + size;
+				     buffer_index++ )
+				{
+					expected_buffer[ buffer_index ] = expected_buffer[ buffer_index - distance ];
+				}
+				result = match_copy(
+				          buffer,
+				          buffer_size,
+				          64,
+				          distance,
+				          size,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				/* The data after the end of the match can be overwritten upto the buffer size
+				 */
+				result = memory_compare(
+				          buffer,
+				          expected_buffer,
+				          64 + size );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				result = memory_compare(
+				          &( buffer[ buffer_size ] ),
+				          &( expected_buffer[ buffer_size ] ),
+				          512 - buffer_size );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = match_copy(
+	          NULL,
+	          512,
+	          64,
+	          1,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_copy(
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          64,
+	          1,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_copy(
+	          buffer,
+	          512,
+	          513,
+	          1,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_copy(
+	          buffer,
+	          512,
+	          64,
+	          0,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_copy(
+	          buffer,
+	          512,
+	          64,
+	          65,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_copy(
+	          buffer,
+	          512,
+	          64,
+	          1,
+	          449,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_MATCH_COPY_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "match_copy",
+	 assorted_test_match_copy );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
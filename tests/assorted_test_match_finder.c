@@ -0,0 +1,586 @@
+/*
+ * Hash chain match finder testing program
+ *
+ * Copyright (C) 2009-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/match_finder.h"
+
+/* Define to make assorted_test_match_finder generate verbose output
+#define ASSORTED_TEST_MATCH_FINDER_VERBOSE
+ */
+
+/* Tests the match_finder_find_longest_match function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_match_finder_find_longest_match(
+     void )
+{
+	/* The candidates of offset 16 are offset 8, which matches 4 bytes,
+	 * and offset 0, which matches the remaining 8 bytes
+	 */
+	uint8_t data[ 24 ] = {
+		'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'a', 'b', 'c', 'd', 'X', 'X', 'X', 'X',
+		'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h' };
+
+	uint8_t long_data[ 40 ] = {
+		'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p',
+		'q', 'r', 's', 't', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l',
+		'm', 'n', 'o', 'p', 'q', 'r', 's', 't' };
+
+	/* The hash chain contains the previous offset + 1 of offset 8, which is offset 0
+	 */
+	size_t hash_chain[ 32 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libcerror_error_t *error = NULL;
+	uint16_t match_distance  = 0;
+	uint16_t match_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	match_size     = 0;
+	match_distance = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 16 );
+
+	/* Test that the search stops at the nice match size
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          4,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 8 );
+
+	/* Test that the search stops at the maximum chain length
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          1,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 8 );
+
+	/* Test that candidates at or beyond the window size are ignored
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          16,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 8 );
+
+	/* Test the maximum match size
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          6,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 16 );
+
+	/* Test that a match is only returned if it is longer than the match size
+	 */
+	match_size     = 8;
+	match_distance = 0;
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 0 );
+
+	/* Test a match that is compared 8 bytes at a time
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          long_data,
+	          40,
+	          20,
+	          hash_chain,
+	          1,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_size",
+	 match_size,
+	 20 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "match_distance",
+	 match_distance,
+	 20 );
+
+	/* Test error cases
+	 */
+	match_size = 0;
+
+	result = match_finder_find_longest_match(
+	          NULL,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          24,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          NULL,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          0,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          24,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          131072,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          NULL,
+	          &match_distance,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = match_finder_find_longest_match(
+	          data,
+	          24,
+	          16,
+	          hash_chain,
+	          9,
+	          32,
+	          258,
+	          8,
+	          258,
+	          &match_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_MATCH_FINDER_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "match_finder_find_longest_match",
+	 assorted_test_match_finder_find_longest_match );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1311 @@
+/*
+ * Library parallel_deflate functions test program
+ *
+ * Copyright (C) 2008-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_data.h"
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/deflate.h"
+#include "../src/gzip.h"
+#include "../src/parallel_deflate.h"
+
+#define ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE	262144
+
+uint8_t assorted_test_parallel_deflate_uncompressed_data[ ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE ];
+
+uint8_t assorted_test_parallel_deflate_compressed_data[ ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096 ];
+
+uint8_t assorted_test_parallel_deflate_decompressed_data[ ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE ];
+
+/* Tests the parallel_deflate_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_parallel_deflate_compress(
+     void )
+{
+	size_t chunk_sizes[ 4 ] = { 1000, 32768, 100000, PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE };
+
+	int compression_levels[ 4 ] = { 0, 1, 6, 9 };
+
+	int numbers_of_threads[ 3 ] = { 1, 3, 4 };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	uint32_t checksum             = 0;
+	uint32_t stored_checksum      = 0;
+	int chunk_size_index          = 0;
+	int compression_level_index   = 0;
+	int number_of_threads_index   = 0;
+	int result                    = 0;
+
+	assorted_test_data_generate(
+	 assorted_test_parallel_deflate_uncompressed_data,
+	 ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	 0x12345678UL,
+	 32768,
+	 66 );
+
+	result = deflate_calculate_adler32(
+	          &checksum,
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( chunk_size_index = 0;
+	     chunk_size_index < 4;
+	     chunk_size_index++ )
+	{
+		for( compression_level_index = 0;
+		     compression_level_index < 4;
+		     compression_level_index++ )
+		{
+			for( number_of_threads_index = 0;
+			     number_of_threads_index < 3;
+			     number_of_threads_index++ )
+			{
+				compressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096;
+
+				result = parallel_deflate_compress(
+				          assorted_test_parallel_deflate_uncompressed_data,
+				          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+				          compression_levels[ compression_level_index ],
+				          chunk_sizes[ chunk_size_index ],
+				          numbers_of_threads[ number_of_threads_index ],
+				          assorted_test_parallel_deflate_compressed_data,
+				          &compressed_data_size,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				byte_stream_copy_to_uint32_big_endian(
+				 &( assorted_test_parallel_deflate_compressed_data[ compressed_data_size - 4 ] ),
+				 stored_checksum );
+
+				ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+				 "stored_checksum",
+				 stored_checksum,
+				 checksum );
+
+				uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+				result = deflate_decompress_zlib(
+				          assorted_test_parallel_deflate_compressed_data,
+				          compressed_data_size,
+				          assorted_test_parallel_deflate_decompressed_data,
+				          &uncompressed_data_size,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+				 "uncompressed_data_size",
+				 uncompressed_data_size,
+				 (size_t) ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = memory_compare(
+				          assorted_test_parallel_deflate_decompressed_data,
+				          assorted_test_parallel_deflate_uncompressed_data,
+				          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+	}
+	/* Test empty uncompressed data
+	 */
+	compressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096;
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          0,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = deflate_decompress_zlib(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096;
+
+	result = parallel_deflate_compress(
+	          NULL,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          10,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          0,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          0,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          PARALLEL_DEFLATE_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 1024;
+
+	result = parallel_deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          0,
+	          PARALLEL_DEFLATE_DEFAULT_CHUNK_SIZE,
+	          4,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the parallel_deflate_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_parallel_deflate_decompress(
+     void )
+{
+	size_t chunk_sizes[ 3 ] = { 4096, 10000, PARALLEL_DEFLATE_DEFAULT_COMPRESSED_CHUNK_SIZE };
+
+	int compression_levels[ 4 ] = { 0, 1, 6, 9 };
+
+	int numbers_of_threads[ 3 ] = { 1, 3, 4 };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int chunk_size_index          = 0;
+	int compression_level_index   = 0;
+	int number_of_threads_index   = 0;
+	int parallel_compression      = 0;
+	int result                    = 0;
+
+	assorted_test_data_generate(
+	 assorted_test_parallel_deflate_uncompressed_data,
+	 ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	 0x12345678UL,
+	 32768,
+	 66 );
+
+	/* Test regular cases
+	 */
+	for( parallel_compression = 0;
+	     parallel_compression < 2;
+	     parallel_compression++ )
+	{
+		for( compression_level_index = 0;
+		     compression_level_index < 4;
+		     compression_level_index++ )
+		{
+			compressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096;
+
+			if( parallel_compression == 0 )
+			{
+				result = deflate_compress(
+				          assorted_test_parallel_deflate_uncompressed_data,
+				          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+				          compression_levels[ compression_level_index ],
+				          assorted_test_parallel_deflate_compressed_data,
+				          &compressed_data_size,
+				          &error );
+			}
+			else
+			{
+				result = parallel_deflate_compress(
+				          assorted_test_parallel_deflate_uncompressed_data,
+				          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+				          compression_levels[ compression_level_index ],
+				          32768,
+				          4,
+				          assorted_test_parallel_deflate_compressed_data,
+				          &compressed_data_size,
+				          &error );
+			}
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( chunk_size_index = 0;
+			     chunk_size_index < 3;
+			     chunk_size_index++ )
+			{
+				for( number_of_threads_index = 0;
+				     number_of_threads_index < 3;
+				     number_of_threads_index++ )
+				{
+					uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+					result = parallel_deflate_decompress(
+					          assorted_test_parallel_deflate_compressed_data,
+					          compressed_data_size,
+					          chunk_sizes[ chunk_size_index ],
+					          numbers_of_threads[ number_of_threads_index ],
+					          assorted_test_parallel_deflate_decompressed_data,
+					          &uncompressed_data_size,
+					          &error );
+
+					ASSORTED_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+					 "uncompressed_data_size",
+					 uncompressed_data_size,
+					 (size_t) ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+					ASSORTED_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+
+					result = memory_compare(
+					          assorted_test_parallel_deflate_decompressed_data,
+					          assorted_test_parallel_deflate_uncompressed_data,
+					          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+					ASSORTED_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 0 );
+				}
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress(
+	          NULL,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          0,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          0,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE / 2;
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test truncated compressed data
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size / 2,
+	          4096,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test corrupted checksum
+	 */
+	assorted_test_parallel_deflate_compressed_data[ compressed_data_size - 1 ] ^= 0xff;
+
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_parallel_deflate_compressed_data[ compressed_data_size - 1 ] ^= 0xff;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the parallel_deflate_decompress_data function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_parallel_deflate_decompress_data(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	assorted_test_data_generate(
+	 assorted_test_parallel_deflate_uncompressed_data,
+	 ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	 0x12345678UL,
+	 32768,
+	 66 );
+
+	compressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096;
+
+	result = deflate_compress(
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          6,
+	          assorted_test_parallel_deflate_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases where the uncompressed data is resized
+	 */
+	uncompressed_data_size = 1024;
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = parallel_deflate_decompress_data(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_parallel_deflate_uncompressed_data,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test uncompressed data exceeds maximum size
+	 */
+	uncompressed_data_size = 1024;
+
+	result = parallel_deflate_decompress_data(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE / 2,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress_data(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE / 2,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress_data(
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4096,
+	          4,
+	          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests the parallel_deflate_decompress_gzip function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_parallel_deflate_decompress_gzip(
+     void )
+{
+	int numbers_of_threads[ 3 ] = { 1, 3, 4 };
+
+	gzip_member_index_t *member_index = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t compressed_data_size       = 0;
+	size_t member_data_size           = 0;
+	size_t uncompressed_data_offset   = 0;
+	size_t uncompressed_data_size     = 0;
+	uint32_t checksum                 = 0;
+	int number_of_threads_index       = 0;
+	int result                        = 0;
+
+	assorted_test_data_generate(
+	 assorted_test_parallel_deflate_uncompressed_data,
+	 ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE,
+	 0x12345678UL,
+	 32768,
+	 66 );
+
+	/* Create members of 20000 bytes of uncompressed data, where the deflate
+	 * compressed data is written over the zlib header and checksum
+	 */
+	while( uncompressed_data_offset < ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE )
+	{
+		uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE - uncompressed_data_offset;
+
+		if( uncompressed_data_size > 20000 )
+		{
+			uncompressed_data_size = 20000;
+		}
+		member_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE + 4096 - ( compressed_data_size + 8 );
+
+		result = deflate_compress(
+		          &( assorted_test_parallel_deflate_uncompressed_data[ uncompressed_data_offset ] ),
+		          uncompressed_data_size,
+		          6,
+		          &( assorted_test_parallel_deflate_compressed_data[ compressed_data_size + 8 ] ),
+		          &member_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = gzip_calculate_crc32(
+		          &checksum,
+		          &( assorted_test_parallel_deflate_uncompressed_data[ uncompressed_data_offset ] ),
+		          uncompressed_data_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_set(
+		          &( assorted_test_parallel_deflate_compressed_data[ compressed_data_size ] ),
+		          0,
+		          GZIP_MEMBER_HEADER_SIZE ) != NULL;
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		assorted_test_parallel_deflate_compressed_data[ compressed_data_size ]     = gzip_signature[ 0 ];
+		assorted_test_parallel_deflate_compressed_data[ compressed_data_size + 1 ] = gzip_signature[ 1 ];
+		assorted_test_parallel_deflate_compressed_data[ compressed_data_size + 2 ] = 8;
+		assorted_test_parallel_deflate_compressed_data[ compressed_data_size + 9 ] = 0xff;
+
+		compressed_data_size += member_data_size + 4;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( assorted_test_parallel_deflate_compressed_data[ compressed_data_size ] ),
+		 checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( assorted_test_parallel_deflate_compressed_data[ compressed_data_size + 4 ] ),
+		 (uint32_t) uncompressed_data_size );
+
+		compressed_data_size     += 8;
+		uncompressed_data_offset += uncompressed_data_size;
+	}
+	result = gzip_member_index_initialize(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_member_index_build(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "member_index->number_of_members",
+	 member_index->number_of_members,
+	 14 );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads_index = 0;
+	     number_of_threads_index < 3;
+	     number_of_threads_index++ )
+	{
+		uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+		result = parallel_deflate_decompress_gzip(
+		          member_index,
+		          assorted_test_parallel_deflate_compressed_data,
+		          compressed_data_size,
+		          numbers_of_threads[ number_of_threads_index ],
+		          assorted_test_parallel_deflate_decompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          assorted_test_parallel_deflate_decompressed_data,
+		          assorted_test_parallel_deflate_uncompressed_data,
+		          ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress_gzip(
+	          NULL,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          NULL,
+	          compressed_data_size,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          0,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data size that does not match the member index
+	 */
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size - 1,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE - 1;
+
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test corrupted checksum
+	 */
+	assorted_test_parallel_deflate_compressed_data[ compressed_data_size - 8 ] ^= 0xff;
+
+	uncompressed_data_size = ASSORTED_TEST_PARALLEL_DEFLATE_DATA_SIZE;
+
+	result = parallel_deflate_decompress_gzip(
+	          member_index,
+	          assorted_test_parallel_deflate_compressed_data,
+	          compressed_data_size,
+	          4,
+	          assorted_test_parallel_deflate_decompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_parallel_deflate_compressed_data[ compressed_data_size - 8 ] ^= 0xff;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = gzip_member_index_free(
+	          &member_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( member_index != NULL )
+	{
+		gzip_member_index_free(
+		 &member_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "parallel_deflate_compress",
+	 assorted_test_parallel_deflate_compress );
+
+	ASSORTED_TEST_RUN(
+	 "parallel_deflate_decompress",
+	 assorted_test_parallel_deflate_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "parallel_deflate_decompress_data",
+	 assorted_test_parallel_deflate_decompress_data );
+
+	ASSORTED_TEST_RUN(
+	 "parallel_deflate_decompress_gzip",
+	 assorted_test_parallel_deflate_decompress_gzip );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -71,7 +71,7 @@ int assorted_test_xor64_calculate_checksum_little_endian_basic(
 	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "checksum_value",
 	 checksum_value,
-	 (uint64_t) 0x42a7717ce1665515ULL );
+	 (uint64_t) 0x01a54b78a3c12469ULL );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -169,7 +169,7 @@ int assorted_test_xor64_calculate_checksum_little_endian_cpu_aligned(
 	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "checksum_value",
 	 checksum_value,
-	 (uint64_t) 0xa2646f11ULL );
+	 (uint64_t) 0x01a54b78a3c12469ULL );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="adler32 ascii7 bit_stream crc32 crc64 deflate fletcher32 fletcher64 huffman_tree lzfu lzvn xor32 xor64";
+LIBRARY_TESTS="adler32 ascii7 bit_stream checksum cpu_features crc32 crc64 deflate deflate_index deflate_stream fletcher32 fletcher64 gzip huffman_tree lzfu lzvn lzvn_container match_copy match_finder parallel_deflate xor32 xor64";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 